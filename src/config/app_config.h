@@ -66,6 +66,20 @@ static inline void snapshotbus_maybe_yield()
 #define SNAPSHOTBUS_YIELD() snapshotbus_maybe_yield()
 #endif
 
+// ---- Tracing ---- //
+
+#ifndef TRACING
+// True → task/bus trace buffer compiled in (see Trace.h); false → every hook compiles to nothing.
+#define TRACING false
+#endif
+
+// ---- RC receiver protocol ---- //
+
+#ifndef RC_PROTOCOL
+// Ibus, Sbus or Crsf (names in cfg::rc::Protocol); -D RC_PROTOCOL=Sbus builds another receiver without editing this file.
+#define RC_PROTOCOL Ibus
+#endif
+
 // ---- Timebase ---- //
 
 /**
@@ -89,6 +103,9 @@ namespace cfg
         constexpr uint32_t LOOP_MS = 10;                   ///< Standard loop cadence.
         constexpr uint32_t LOOP_INTERVAL_TEST_SHORT = 100; ///< Short test ms.
         constexpr uint32_t LOOP_INTERVAL_TEST_LONG = 1000; ///< Long test ms.
+        constexpr uint32_t CMD_STALE_MS = 100;             ///< Older control commands make the drive brake to a stop.
+        constexpr uint32_t EVENT_LOG_MS = 100;             ///< EventLogger poll: how late an edge event is printed.
+        constexpr uint32_t GAIN_SAVE_MS = 500;             ///< GainSaver poll for a new autotune result.
     } ///< Namespace tick.
 
     // ---- Button Timings ---- //
@@ -105,23 +122,249 @@ namespace cfg
         constexpr int RPWM_PIN = 37;
         constexpr int LPWM_PIN = 38;
         constexpr int EN_PIN = 39;
+        constexpr size_t MAX_MOTORS = 4;             ///< Upper bound for multi-motor builds (PowerDriveHandler).
+        constexpr int MCPWM_UNIT = 0;                ///< MCPWM unit the drive Motors run on (unit 1 captures obstacle echoes).
+        constexpr size_t MCPWM_TIMERS = 3;           ///< Timers per unit: one H-bridge each, synced to timer 0.
+
+        /// @brief Which side of the car a motor drives (for differential mixing).
+        enum class Side : uint8_t
+        {
+            Both = 0, ///< Solid axle / single motor: throttle only.
+            Left,     ///< Left wheel(s).
+            Right     ///< Right wheel(s).
+        };
+
+        /// @brief One BTS7960 H-bridge; entry i runs on MCPWM_UNIT, timer i.
+        struct Wheel
+        {
+            int rpwm_pin; ///< Forward PWM.
+            int lpwm_pin; ///< Reverse PWM.
+            int en_pin;   ///< Enable (may be shared between bridges).
+            Side side;    ///< Mixing side.
+        };
+
+        /// @brief Driven motors. Left/right build: {RPWM_PIN, LPWM_PIN, EN_PIN, Side::Left}, {40, 41, EN_PIN, Side::Right}.
+        /// Two motors on one side get the same duty, so wire both bridges to that side's pins.
+        constexpr Wheel WHEELS[] = {
+            {RPWM_PIN, LPWM_PIN, EN_PIN, Side::Both},
+        };
+        constexpr size_t WHEEL_COUNT = sizeof(WHEELS) / sizeof(WHEELS[0]); ///< Entries in WHEELS.
+        static_assert(WHEEL_COUNT >= 1 && WHEEL_COUNT <= MCPWM_TIMERS && WHEEL_COUNT <= MAX_MOTORS,
+                      "One MCPWM timer per wheel, all on MCPWM_UNIT.");
+        constexpr uint32_t PWM_LOW_DUTY_HZ = 20000;  ///< Carrier at low duty: inaudible, low ripple at crawl.
+        constexpr uint32_t PWM_HIGH_DUTY_HZ = 10000; ///< Carrier at high duty: halves switching loss.
+        constexpr float PWM_UP_PCT = 60.0f;          ///< Duty above which the slower carrier is used...
+        constexpr float PWM_DOWN_PCT = 45.0f;        ///< ...and below which the fast one returns.
+        constexpr uint16_t PWM_MIN_DWELL = 20;       ///< Drive ticks between carrier changes.
     } ///< Namespace motor.
 
+    // ---- Wheel encoder (PCNT) ---- //
+    namespace encoder
+    {
+        constexpr bool ENABLED = false;           ///< True → WheelEncoder feeds PowerDriveHandler.
+        constexpr int PIN = 4;                    ///< Encoder / hall pulse input.
+        constexpr int PIN_B = -1;                 ///< Quadrature B for direction (−1 → none; hill-hold needs it).
+        constexpr float COUNTS_PER_REV = 20.0f;   ///< Rising edges per wheel revolution.
+        constexpr uint16_t GLITCH_CYCLES = 1000;  ///< PCNT glitch filter (APB cycles, 1000 ≈ 12.5 µs).
+        constexpr uint16_t MIN_WINDOW_COUNTS = 4; ///< Speed window closes after this many pulses...
+        constexpr float MAX_WINDOW_S = 0.1f;      ///< ...or this long (0 RPM reported after it).
+        constexpr float SMOOTHING = 0.5f;         ///< One-pole smoothing per window (1 = off).
+    } ///< Namespace encoder.
+
+    // ---- Closed-loop speed control ---- //
+    namespace speed
+    {
+        constexpr bool CLOSED_LOOP = false;     ///< True → throttle % is a speed setpoint (needs encoder).
+        constexpr float MAX_RPM = 300.0f;       ///< Wheel RPM at 100 % throttle.
+        constexpr float KP = 0.15f;             ///< % duty per RPM of error.
+        constexpr float KI = 0.60f;             ///< % duty per RPM·s.
+        constexpr float KD = 0.0f;              ///< % duty per RPM/s.
+        constexpr float KFF = 100.0f / MAX_RPM; ///< Open-loop duty per RPM of setpoint.
+        constexpr float I_BAND_RPM = 20.0f;     ///< Integrate only this close to the setpoint (launch lag → no windup).
+        constexpr bool TUNE_ENABLED = false;    ///< Autotune: true → RC::override held up (car stopped) runs it.
+        constexpr float TUNE_SP_PCT = 50.0f;    ///< Autotune: relay centre (% of MAX_RPM).
+        constexpr float TUNE_RELAY_PCT = 15.0f; ///< Autotune: relay swing (± % duty).
+        constexpr float TUNE_HYST_RPM = 3.0f;   ///< Autotune: switching band (above encoder noise).
+        constexpr float TUNE_TIMEOUT_S = 20.0f; ///< Autotune: give up after this long.
+    } ///< Namespace speed.
+
+    // ---- Traction control (needs a motor-side encoder, ≳ 500 counts/rev) ---- //
+    namespace traction
+    {
+        constexpr bool ENABLED = false;           ///< True → inner-loop slip control (encoder required).
+        constexpr uint32_t SUBSTEP_MS = 1;        ///< Inner step (must divide tick::LOOP_MS).
+        constexpr size_t WINDOW_STEPS = 16;       ///< Substeps per speed window.
+        constexpr float TAU_S = 0.6f;             ///< Loaded drivetrain time constant (grip).
+        constexpr float MARGIN_RPM_S = 400.0f;    ///< Excess acceleration that marks slip onset.
+        constexpr float CUT_FACTOR = 0.6f;        ///< Duty scale at onset.
+        constexpr float REF_ACCEL_RPM_S = 60.0f;  ///< Vehicle acceleration assumed while slipping (≈ wet grass).
+        constexpr float SLIP_BAND_RPM = 15.0f;    ///< Wheel speed allowed above the reference.
+        constexpr float SLIP_GAIN = 0.3f;         ///< Scale removed per s per RPM over the band.
+        constexpr float RECOVER_PER_S = 1.0f;     ///< Scale regained per s once inside the band.
+        constexpr float MIN_SCALE = 0.2f;         ///< Lowest duty scale.
+    } ///< Namespace traction.
+
+    // ---- Hill-hold (needs a direction-sensing encoder: encoder::PIN_B) ---- //
+    namespace hillhold
+    {
+        constexpr bool ENABLED = false;     ///< True → hold against rollback at zero throttle.
+        constexpr float ROLL_COUNTS = 1.0f; ///< Rollback (counts) that engages the hold.
+        constexpr float KP_PCT = 24.0f;     ///< Holding duty per count rolled back (%).
+        constexpr float KI_PCT_S = 10.0f;   ///< Holding duty added per count per second (%/s).
+        constexpr float MAX_PCT = 45.0f;    ///< Holding duty ceiling (≈ 14° for a 45 kg car).
+        constexpr float MAX_HOLD_S = 8.0f;  ///< Then release to the short-circuit brake.
+    } ///< Namespace hillhold.
+
+    // ---- Battery (ADC) ---- //
+    namespace battery
+    {
+        constexpr bool ENABLED = false;                           ///< True → BatteryMonitor feeds PowerDriveHandler (divider fitted).
+        constexpr uint8_t PIN = 1;                                ///< ADC1 input from the divider.
+        constexpr float DIVIDER_RATIO = (100.0f + 22.0f) / 22.0f; ///< (R_top + R_bottom) / R_bottom.
+        constexpr uint8_t OVERSAMPLE = 16;                        ///< ADC reads averaged per sample.
+        constexpr uint32_t PERIOD_MS = 20;                        ///< Sample cadence.
+        constexpr float FILTER_ALPHA = 0.1f;                      ///< One-pole per sample (τ ≈ 190 ms at 20 ms).
+        constexpr uint8_t SETTLE_SAMPLES = 10;                    ///< Samples (≈ τ) before a reading is marked valid.
+        constexpr bool COMPENSATE = true;                         ///< Scale duty by NOMINAL_V / volts.
+        constexpr float NOMINAL_V = 12.0f;                        ///< Pack voltage that 100 % duty is tuned for (12 V SLA).
+        constexpr float LIMIT_START_V = 11.4f;                    ///< Power cap starts falling here...
+        constexpr float LIMIT_END_V = 10.8f;                      ///< ...reaching LIMIT_FLOOR_PCT here.
+        constexpr float LIMIT_FLOOR_PCT = 30.0f;                  ///< Crawl-home output at a flat pack.
+        constexpr float MIN_VALID_V = 3.0f;                       ///< Below this: no pack / USB power, skip scaling.
+        constexpr uint32_t STALE_MS = 200;                        ///< Older readings are ignored by the drive.
+    } ///< Namespace battery.
+
+    // ---- IMU (MPU-6050 over I²C, read from its FIFO) ---- //
+    namespace imu
+    {
+        constexpr bool ENABLED = false;       ///< True → ImuService publishes attitude.
+        constexpr bool FAKE = false;          ///< True → synthetic samples (no sensor fitted).
+        constexpr int SDA_PIN = 11;           ///< I²C data.
+        constexpr int SCL_PIN = 12;           ///< I²C clock.
+        constexpr uint32_t I2C_HZ = 400000;   ///< Fast-mode I²C.
+        constexpr uint8_t ADDR = 0x68;        ///< AD0 low.
+        constexpr uint16_t RATE_HZ = 400;     ///< Requested sample rate (1 kHz / integer divider).
+        constexpr uint32_t PERIOD_MS = 20;    ///< FIFO drain cadence (FIFO holds 85 samples).
+        constexpr size_t MAX_BATCH = 64;      ///< Samples drained per wake-up at most.
+        constexpr float FILTER_TAU_S = 0.5f;  ///< Complementary-filter crossover.
+        constexpr float ACCEL_GATE_G = 0.15f; ///< Ignore accel further than this from 1 g.
+        constexpr float TIP_DEG = 45.0f;      ///< Tilt that reports tipped.
+    } ///< Namespace imu.
+
+    // ---- Obstacle ranging (HC-SR04 style ultrasonic, front-facing) ---- //
+    namespace obstacle
+    {
+        constexpr bool ENABLED = false;         ///< True → ranger runs and the drive honours it.
+        constexpr int TRIG_PIN = 13;            ///< Trigger out (RMT pulse).
+        constexpr int ECHO_PIN = 14;            ///< Echo in (MCPWM capture; 5 V sensors need a divider).
+        constexpr uint32_t PERIOD_MS = 60;      ///< Ping spacing (lets the last ping's echoes die away).
+        constexpr float MAX_RANGE_M = 4.0f;     ///< Longer echoes (or none) read as clear.
+        constexpr float SOUND_MPS = 343.0f;     ///< Speed of sound (20 °C).
+        constexpr float SLOW_M = 1.5f;          ///< Forward throttle cap starts falling here...
+        constexpr float STOP_M = 0.5f;          ///< ...and is zero (short-circuit brake) here.
+        constexpr float BRAKE_S = 0.9f;         ///< Brake BRAKE_S × closing m/s before STOP_M (brake τ + a ping).
+        constexpr uint32_t STALE_MS = 200;      ///< Older readings mean the sensor has gone quiet...
+        constexpr float LIMP_PCT = 30.0f;       ///< ...and forward throttle is capped here instead.
+        constexpr bool GUARD_WITHOUT_RC = true; ///< Guard on when no RC switch is available (link down).
+    } ///< Namespace obstacle.
+
+    // ---- Drive modes (RC::mode switch) and power cap (RC::power knob) ---- //
+    namespace drivemode
+    {
+        constexpr size_t COUNT = 3;                  ///< Switch positions: toddler, normal, sport.
+        constexpr float TODDLER_MAX_PCT = 40.0f;     ///< Toddler: walking pace...
+        constexpr float TODDLER_ACCEL_PCT_S = 15.0f; ///< ...and a slow pull-away.
+        constexpr float NORMAL_MAX_PCT = 100.0f;     ///< Normal: full speed...
+        constexpr float NORMAL_ACCEL_PCT_S = 40.0f;  ///< ...at the original ramp (0→100 % in 2.5 s).
+        constexpr float SPORT_MAX_PCT = 100.0f;      ///< Sport: full speed...
+        constexpr float SPORT_ACCEL_PCT_S = 80.0f;   ///< ...reached twice as fast.
+        constexpr uint8_t NO_RC_MODE = 1;            ///< Mode with no receiver fitted, or none heard since boot.
+        constexpr uint8_t FAILSAFE_MODE = 0;         ///< Mode once a live RC link has dropped into failsafe.
+    } ///< Namespace drivemode.
+
+    // ---- Thermal derating (I²t estimate) ---- //
+    namespace thermal
+    {
+        constexpr float AMBIENT_C = 30.0f;        ///< Assumed ambient (no sensor; err warm).
+        constexpr float STALL_A = 40.0f;          ///< Motor stall current at 100 % duty.
+        constexpr float FULL_LOAD_A = 15.0f;      ///< Current assumed at 100 % duty without a speed sensor.
+        constexpr float MOTOR_R_OHM = 0.30f;      ///< Winding resistance.
+        constexpr float MOTOR_RTH = 1.5f;         ///< Winding → ambient (K/W).
+        constexpr float MOTOR_TAU_S = 240.0f;     ///< Winding time constant.
+        constexpr float MOTOR_DERATE_C = 90.0f;   ///< Motor: start derating...
+        constexpr float MOTOR_MAX_C = 120.0f;     ///< ...floor reached here.
+        constexpr float DRIVER_R_OHM = 0.016f;    ///< BTS7960 high + low side Rds(on) at temperature.
+        constexpr float DRIVER_RTH = 40.0f;       ///< Junction → ambient on the module heatsink (K/W).
+        constexpr float DRIVER_TAU_S = 60.0f;     ///< Heatsink time constant.
+        constexpr float DRIVER_DERATE_C = 100.0f; ///< Driver: start derating...
+        constexpr float DRIVER_MAX_C = 140.0f;    ///< ...floor reached here.
+        constexpr float FLOOR_PCT = 25.0f;        ///< Output left at the top of either band.
+    } ///< Namespace thermal.
+
+    // ---- Task and bus trace (TRACING builds only) ---- //
+    namespace trace
+    {
+        constexpr bool ENABLED = TRACING;   ///< Compile-time gate for every trace hook.
+        constexpr size_t EVENTS = 4096;     ///< Capture buffer (8 bytes each; a few seconds of a busy car).
+        constexpr size_t MAX_TASKS = 16;    ///< Distinct FreeRTOS tasks the task sampler can name.
+        constexpr uint32_t SAMPLE_US = 100; ///< Task sampler period: which task each core runs (switch resolution).
+        constexpr int SAMPLE_GROUP = 1;     ///< Timer group for the sampler (timer 0 of it; nothing else here uses group 1).
+        constexpr uint32_t START_MS = 3000; ///< Capture starts this long after boot (skip setup).
+        constexpr uint32_t REARM_MS = 0;    ///< Gap before the next capture after a dump (0 → one shot).
+    } ///< Namespace trace.
+
+    // ---- Binary telemetry (TelemetryStreamer, shares the USB CDC port with debug text) ---- //
+    namespace telemetry
+    {
+        constexpr bool ENABLED = false;         ///< True → stream COBS-framed records on Serial.
+        constexpr uint32_t RATE_HZ = 50;        ///< Records per second per stream (runtime adjustable).
+        constexpr uint8_t STREAMS = 0x07;       ///< Bit per telemetry::Stream: motor, control, battery.
+        constexpr uint16_t KEYFRAME_EVERY = 50; ///< Delta records between absolute ones (resync point).
+        constexpr uint32_t STATS_MS = 1000;     ///< Sent/dropped counter record cadence.
+    } ///< Namespace telemetry.
+
+    // ---- Non-volatile storage ---- //
+    namespace nvs
+    {
+        constexpr const char *NAMESPACE = "drive";     ///< Preferences namespace for tuned values.
+        constexpr const char *SPEED_GAINS = "spd_pid"; ///< Key: speed-loop PidGains.
+    } ///< Namespace nvs.
+
     // ---- Remote Control (RCLink) ---- //
     namespace rc
     {
-        constexpr int UART_RX = 18;       ///< iBUS data in.
-        constexpr int UART_TX = -1;       ///< Not required for iBUS (disabled).
-        constexpr uint32_t BAUD = 115200; ///< iBUS baud rate.
+        /// @brief Receiver protocol on UART_RX.
+        enum class Protocol : uint8_t
+        {
+            Ibus, ///< FlySky iBUS (115200, ~7 ms frames).
+            Sbus, ///< Futaba SBUS (100000 8E2 inverted, 7–14 ms frames).
+            Crsf  ///< TBS/ELRS CRSF (420000, up to 500 Hz, link statistics).
+        };
+
+        constexpr Protocol PROTOCOL = Protocol::RC_PROTOCOL; ///< Selected receiver protocol (see RC_PROTOCOL).
+        constexpr int UART_RX = 18;                          ///< Receiver data in.
+        constexpr int UART_TX = -1;                          ///< Not required for iBUS/SBUS (disabled).
+        constexpr uint32_t BAUD = (PROTOCOL == Protocol::Crsf)   ? 420000u
+                                  : (PROTOCOL == Protocol::Sbus) ? 100000u
+                                                                 : 115200u; ///< Protocol baud rate.
+        constexpr uint32_t LINK_TIMEOUT_MS = 50; ///< No valid frame for this long → failsafe.
+        constexpr bool DIVERSITY = false;        ///< True → second receiver on Serial1, freshest frame wins.
+        constexpr int UART2_RX = 17;             ///< Secondary receiver data in.
+        constexpr int UART2_TX = -1;             ///< Secondary receiver TX (unused).
+        constexpr uint32_t FRAME_US = (PROTOCOL == Protocol::Crsf)   ? 4000u
+                                      : (PROTOCOL == Protocol::Sbus) ? 14000u
+                                                                     : 7000u; ///< Expected frame period (seeds the measured interval).
+        constexpr uint8_t PREDICT_FRAMES = 2; ///< Overdue frames to extrapolate axes across (0 → hold).
     } ///< Namepsace rc.
 } ///< Namespace cfg.
 
 // ---- Application button mapping ---- //
-#define BUTTON_LIST(X)  \
-    X(Accelerator, 6)   \
-    X(Horn, 7)          \
-    X(IndicatorLeft, 8) \
-    X(IndicatorRight, 9)
+#define BUTTON_LIST(X)   \
+    X(Accelerator, 6)    \
+    X(Horn, 7)           \
+    X(IndicatorLeft, 8)  \
+    X(IndicatorRight, 9) \
+    X(Reverse, 10)
 
 // ---- Remote control channel mapping ---- //
 #define RC_ROLES(X)             \
@@ -0,0 +1,45 @@
+/**
+ * MIT License
+ *
+ * @brief Snapshot payload and bus for battery voltage (BatteryMonitor output).
+ *
+ * @file BatteryBus.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <SnapshotBus.h>
+#include <Trace.h>
+
+/**
+ * @brief Filtered pack voltage, published at the monitor cadence.
+ */
+struct BatterySnapshot
+{
+    float volts{0.0f};         ///< Filtered pack voltage (V).
+    float raw_volts{0.0f};     ///< Oversampled but unfiltered voltage this sample (V).
+    bool low{false};           ///< Below cfg::battery::LIMIT_START_V (power limit active).
+    bool valid{false};         ///< False until the filter has settled (cfg::battery::SETTLE_SAMPLES).
+    std::uint64_t stamp_us{0}; ///< Timestamp (µs since boot).
+};
+
+/**
+ * @brief Type alias for the SnapshotBus that transports battery frames.
+ */
+using BatteryBus = trace::TracedBus<BatterySnapshot, trace::Bus::Battery>;
+
+/**
+ * @brief Single, shared BatteryBus instance.
+ */
+namespace buses
+{
+    inline BatteryBus &battery() noexcept ///< Return reference to the shared BatteryBus.
+    {
+        static BatteryBus bus{}; ///< One (only) BatteryBus instance.
+        return bus;              ///< Return reference to shared bus.
+    }
+}
@@ -13,6 +13,7 @@
 
 #include <cstdint>
 #include <SnapshotBus.h>
+#include <Trace.h>
 
 /**
  * @brief High-level intent produced by ControlCore.
@@ -32,7 +33,23 @@ struct ControlSnapshot
         Hazard
     };
 
+    /// @brief Requested direction of travel.
+    enum class Direction : std::uint8_t
+    {
+        Forward = 0,
+        Reverse
+    };
+
     float throttle_cmd_pct{0.0f};            ///< 0..100 (%). Services may clamp.
+    float max_pct{100.0f};                   ///< Throttle ceiling from drive mode × power knob (%).
+    float accel_pct_s{40.0f};                ///< Fastest throttle rise for the drive mode (%/s).
+    float decel_pct_s{0.0f};                 ///< Throttle release rate (%/s); 0 → the drive's default.
+    std::uint8_t drive_mode{1};              ///< Drive mode index (0 toddler, 1 normal, 2 sport).
+    float steer_cmd_pct{0.0f};               ///< -100 (left) .. +100 (right). Used for differential drive.
+    Direction dir_cmd{Direction::Forward};   ///< Requested direction (drive sequences the change).
+    bool brake_cmd{false};                   ///< True → actively brake to 0 % instead of coasting down.
+    bool autotune_cmd{false};                ///< Run the speed-loop autotune (RC::override held; released → abort).
+    bool obstacle_guard{false};              ///< True → drive limits forward throttle by obstacle distance.
     bool horn_cmd{false};                    ///< True if horn is pressed.
     Indicator indicator_cmd{Indicator::Off}; ///< Indicator mode.
     std::uint32_t stamp_ms{0};               ///< Timestamp (ms).
@@ -41,7 +58,7 @@ struct ControlSnapshot
 /**
  * @brief Type alias for the SnapshotBus that transports control frames.
  */
-using ControlBus = snapshot::SnapshotBus<ControlSnapshot>;
+using ControlBus = trace::TracedBus<ControlSnapshot, trace::Bus::Control>;
 
 /**
  * @brief Single, shared ControlBus instance.
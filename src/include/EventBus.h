@@ -0,0 +1,108 @@
+/**
+ * MIT License
+ *
+ * @brief Snapshot payload and buses for edge events raised inside the control tasks.
+ *
+ * The RC and drive tasks must not format text or block on Serial on the
+ * edges whose latency they are measured by (failsafe, obstacle cut), nor
+ * anywhere else in their tick (autotune progress). They
+ * publish a counter and the raw numbers here instead; EventLogger prints
+ * them from a priority-0 task.
+ *
+ * @file EventBus.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <SnapshotBus.h>
+#include <Trace.h>
+
+/**
+ * @brief Events with a bus each (one writer per event).
+ */
+enum class Event : std::uint8_t
+{
+    RcLinkLost = 0, ///< RcPublisher: frame watchdog expired (latency_us: since the last frame).
+    ObstacleStop,   ///< PowerDriveHandler: obstacle guard cut to 0 % (value: distance m, closing m/s; latency_us: since the echo).
+    AutotuneStarted, ///< PowerDriveHandler: relay experiment began (value: setpoint rpm, relay amplitude %).
+    AutotuneAborted, ///< PowerDriveHandler: request dropped mid-experiment (value: rpm at the abort).
+    AutotuneDone,    ///< PowerDriveHandler: gains applied and published on TuneBus (value: Ku, Tu s).
+    AutotuneFailed,  ///< PowerDriveHandler: no clean oscillation before the timeout.
+    DriveMode,       ///< ControlCore: drive mode changed (code: new mode, previous mode << 8; value: max %, ramp %/s).
+    Count
+};
+
+/**
+ * @brief The latest occurrence of one event, plus how many there have been.
+ */
+struct EventSnapshot
+{
+    std::uint32_t count{0};      ///< Occurrences since boot (a jump > 1 means the logger missed some).
+    std::uint32_t latency_us{0}; ///< Event-specific delay (see Event).
+    float value[2]{};            ///< Event-specific values (see Event).
+    std::uint32_t code{0};       ///< Event-specific index or state (see Event).
+    std::uint64_t stamp_us{0};   ///< When it happened (µs since boot).
+};
+
+/**
+ * @brief Type alias for the SnapshotBus that carries one event (every event shares one trace id).
+ */
+using EventBus = trace::TracedBus<EventSnapshot, trace::Bus::Event>;
+
+/**
+ * @brief Record one occurrence: bump the count and publish. Call only from the event's one writer task.
+ *
+ * @param bus Event's bus.
+ * @param stamp_us When it happened.
+ * @param latency_us Event-specific delay.
+ * @param v0 First value.
+ * @param v1 Second value.
+ * @param code Event-specific index or state.
+ */
+inline void record_event(EventBus &bus, std::uint64_t stamp_us, std::uint32_t latency_us, float v0 = 0.0f,
+                         float v1 = 0.0f, std::uint32_t code = 0) noexcept
+{
+    EventSnapshot e = bus.peek();
+    ++e.count;
+    e.latency_us = latency_us;
+    e.value[0] = v0;
+    e.value[1] = v1;
+    e.code = code;
+    e.stamp_us = stamp_us;
+    bus.publish(e);
+}
+
+/**
+ * @brief One bus per Event, indexed by the event.
+ */
+struct EventBuses
+{
+    static constexpr std::size_t kCount = static_cast<std::size_t>(Event::Count); ///< Buses held.
+
+    EventBus bus[kCount]{}; ///< One bus per event.
+
+    EventBus &operator[](Event e) noexcept { return bus[static_cast<std::size_t>(e)]; }
+    const EventBus &operator[](Event e) const noexcept { return bus[static_cast<std::size_t>(e)]; }
+};
+
+/**
+ * @brief Shared event buses (created on first use).
+ */
+namespace buses
+{
+    inline EventBuses &events() noexcept ///< Return reference to the shared event buses.
+    {
+        static EventBuses set{};
+        return set;
+    }
+
+    inline EventBus &event(Event e) noexcept ///< Return reference to the shared bus for @p e.
+    {
+        return events()[e];
+    }
+}
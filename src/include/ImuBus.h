@@ -0,0 +1,50 @@
+/**
+ * MIT License
+ *
+ * @brief Snapshot payload and bus for vehicle attitude (ImuService output).
+ *
+ * @file ImuBus.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <SnapshotBus.h>
+#include <Trace.h>
+
+/**
+ * @brief Filtered attitude, published once per FIFO drain.
+ */
+struct ImuSnapshot
+{
+    float pitch_deg{0.0f};         ///< Nose-up positive (slope when stopped on a hill).
+    float roll_deg{0.0f};          ///< Right-side-down positive.
+    float tilt_deg{0.0f};          ///< Angle from upright, any direction.
+    float yaw_rate_dps{0.0f};      ///< Mean yaw rate over the batch (°/s).
+    bool tipped{false};            ///< tilt_deg beyond cfg::imu::TIP_DEG.
+    std::uint16_t batch{0};        ///< Samples folded in for this snapshot.
+    std::uint32_t overflows{0};    ///< FIFO overflows since boot (samples lost).
+    std::uint32_t cpu_us_per_s{0}; ///< Service busy time over the last second (µs/s).
+    bool valid{false};             ///< False until the filter has a gravity fix.
+    std::uint64_t stamp_us{0};     ///< Timestamp of the drain (µs since boot).
+};
+
+/**
+ * @brief Type alias for the SnapshotBus that transports attitude frames.
+ */
+using ImuBus = trace::TracedBus<ImuSnapshot, trace::Bus::Imu>;
+
+/**
+ * @brief Single, shared ImuBus instance.
+ */
+namespace buses
+{
+    inline ImuBus &imu() noexcept ///< Return reference to the shared ImuBus.
+    {
+        static ImuBus bus{}; ///< One (only) ImuBus instance.
+        return bus;          ///< Return reference to shared bus.
+    }
+}
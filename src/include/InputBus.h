@@ -17,15 +17,16 @@
 #include <Universal_Button.h>
 #include <ButtonHandler_Config.h>
 #include <SnapshotBus.h>
+#include <Trace.h>
 #include <InputModel.h>
 
 // ---- Aliases ---- //
 
-using Button = ButtonHandler<NUM_BUTTONS>;              ///< Concrete button handler bound to NUM_BUTTONS.
-using InputState = snapshot::input::State<NUM_BUTTONS>; ///< Snapshot payload: bitset of button states + timestamp.
-using InputBus = snapshot::SnapshotBus<InputState>;     ///< Snapshot bus that transports InputState frames.
-using snapshot::input::for_each_edge;                   ///< Import edge-iteration helper for brevity.
-using snapshot::input::idx;                             ///< Import generic enum→index caster for brevity.
+using Button = ButtonHandler<NUM_BUTTONS>;                        ///< Concrete button handler bound to NUM_BUTTONS.
+using InputState = snapshot::input::State<NUM_BUTTONS>;           ///< Snapshot payload: bitset of button states + timestamp.
+using InputBus = trace::TracedBus<InputState, trace::Bus::Input>; ///< Snapshot bus that transports InputState frames.
+using snapshot::input::for_each_edge;                             ///< Import edge-iteration helper for brevity.
+using snapshot::input::idx;                                       ///< Import generic enum→index caster for brevity.
 
 // ---- Names table (generated from BUTTON_LIST) ---- //
 
@@ -0,0 +1,86 @@
+/**
+ * MIT License
+ *
+ * @brief Snapshot payload and bus for actual motor state (PowerDriveHandler feedback).
+ *
+ * @file MotorStateBus.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <app_config.h>
+#include <ESP32_MCPWM.h>
+#include <SnapshotBus.h>
+#include <Trace.h>
+
+/**
+ * @brief What the drive is actually doing, published every drive tick.
+ *
+ * ControlBus carries the commanded throttle; this carries the ramped duty that
+ * reaches the H-bridge, so consumers (sound, lights, telemetry) never need to
+ * re-simulate the ramp.
+ */
+struct MotorStateSnapshot
+{
+    /// @brief Where the ramp is relative to its target.
+    enum class RampPhase : std::uint8_t
+    {
+        Idle = 0,     ///< At rest (0 % and target 0 %).
+        Accelerating, ///< Ramping up towards target.
+        Cruising,     ///< Holding a non-zero target.
+        Decelerating, ///< Ramping down towards target.
+        Braking,      ///< Active brake ramp (brake command or reversal).
+        Reversing,    ///< At 0 % in the dead time before a direction flip.
+        Tuning,       ///< Relay autotune driving the output.
+        Holding       ///< Hill-hold: zero command, holding duty against rollback.
+    };
+
+    /// @brief Active limiter bits (OR-ed into limits).
+    enum Limit : std::uint8_t
+    {
+        kLimitNone = 0,             ///< Nothing limiting output.
+        kLimitCmdClamp = 1u << 0,   ///< Command was outside 0..100 % and got clamped.
+        kLimitLowVoltage = 1u << 1, ///< Battery below LIMIT_START_V: output capped.
+        kLimitThermal = 1u << 2,    ///< Motor or driver estimate in its derate band.
+        kLimitTraction = 1u << 3,   ///< Traction control cutting duty (wheel slip).
+        kLimitObstacle = 1u << 4,   ///< Obstacle guard capping forward throttle.
+        kLimitMode = 1u << 5,       ///< Drive mode or power knob ceiling.
+        kLimitStale = 1u << 6,      ///< Control command too old: braking to a stop.
+    };
+
+    float duty_pct{0.0f};                                  ///< Duty written to the H-bridge, highest wheel (0..100 %).
+    std::array<float, cfg::motor::MAX_MOTORS> wheel_pct{}; ///< Duty written per motor (0..100 %).
+    std::uint8_t motors{0};                                ///< Number of valid wheel_pct entries.
+    float battery_v{0.0f};                                 ///< Pack voltage used for compensation (0 = none).
+    float motor_temp_c{0.0f};                              ///< Estimated winding temperature (°C).
+    float driver_temp_c{0.0f};                             ///< Estimated BTS7960 temperature (°C).
+    std::uint32_t pwm_hz{0};                               ///< Carrier frequency in use (0 = library default).
+    float speed_rpm{0.0f};                                 ///< Measured wheel speed (0 without a sensor).
+    bool closed_loop{false};                               ///< True → duty is set by the speed PID.
+    Dir dir{Dir::CW};                                      ///< Direction applied to the H-bridge(s).
+    RampPhase phase{RampPhase::Idle};                      ///< Ramp phase this tick.
+    std::uint8_t limits{kLimitNone};                       ///< Active limiters (Limit bits).
+    std::uint64_t stamp_us{0};                             ///< Timestamp (µs since boot).
+};
+
+/**
+ * @brief Type alias for the SnapshotBus that transports motor state frames.
+ */
+using MotorStateBus = trace::TracedBus<MotorStateSnapshot, trace::Bus::MotorState>;
+
+/**
+ * @brief Single, shared MotorStateBus instance.
+ */
+namespace buses
+{
+    inline MotorStateBus &motor_state() noexcept ///< Return reference to the shared MotorStateBus.
+    {
+        static MotorStateBus bus{}; ///< One (only) MotorStateBus instance.
+        return bus;                 ///< Return reference to shared bus.
+    }
+}
@@ -0,0 +1,45 @@
+/**
+ * MIT License
+ *
+ * @brief Snapshot payload and bus for forward obstacle distance (ranger output).
+ *
+ * @file ObstacleBus.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <SnapshotBus.h>
+#include <Trace.h>
+
+/**
+ * @brief One ranging result, published as soon as its echo ends.
+ */
+struct ObstacleSnapshot
+{
+    float distance_m{0.0f};    ///< Distance to the nearest reflector (m); MAX_RANGE_M when clear.
+    bool clear{true};          ///< No echo within MAX_RANGE_M.
+    bool valid{false};         ///< False until the first ping completes.
+    std::uint32_t seq{0};      ///< Ping counter.
+    std::uint64_t stamp_us{0}; ///< When the echo ended, i.e. when the distance became knowable (µs since boot).
+};
+
+/**
+ * @brief Type alias for the SnapshotBus that transports ranging frames.
+ */
+using ObstacleBus = trace::TracedBus<ObstacleSnapshot, trace::Bus::Obstacle>;
+
+/**
+ * @brief Single, shared ObstacleBus instance.
+ */
+namespace buses
+{
+    inline ObstacleBus &obstacle() noexcept ///< Return reference to the shared ObstacleBus.
+    {
+        static ObstacleBus bus{}; ///< One (only) ObstacleBus instance.
+        return bus;               ///< Return reference to shared bus.
+    }
+}
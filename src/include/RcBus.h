@@ -16,6 +16,17 @@
 #include <array>
 #include <app_config.h>
 #include <SnapshotBus.h>
+#include <Trace.h>
+
+/**
+ * @brief Receiver that supplied an RcSnapshot.
+ */
+enum class RcSource : uint8_t
+{
+    None = 0, ///< No receiver (link lost / failsafe frame).
+    Primary,  ///< Receiver on cfg::rc::UART_RX.
+    Secondary ///< Receiver on cfg::rc::UART2_RX (diversity).
+};
 
 /**
  * @brief Application-owned RC snapshot payload transported on SnapshotBus.
@@ -24,6 +35,10 @@ struct RcSnapshot
 {
     std::array<float, static_cast<size_t>(RC::Count)> out{}; ///< Per-role mapped outputs (engineering units).
     bool failsafe{false};                                    ///< True if the link is in failsafe state.
+    bool linked{false};                                      ///< True once any valid frame has arrived (failsafe + !linked → no receiver).
+    uint8_t link_quality{255};                               ///< Uplink quality 0–100 % (255 = not reported by protocol).
+    RcSource source{RcSource::None};                         ///< Receiver this frame came from.
+    bool predicted{false};                                   ///< True if axes were extrapolated across a missed frame.
     uint64_t stamp_us{0};                                    ///< Snapshot timestamp (µs since boot).
 };
 
@@ -32,7 +47,7 @@ struct RcSnapshot
  *
  * @param f Snapshot frame to read from.
  * @param role Logical RC role (enum value).
- * @return float Engineering-unit value for role (raw input units).
+ * @return float Engineering-unit value for role (mapped via the publisher LUT).
  */
 [[nodiscard]] inline float rc_get(const RcSnapshot &f, RC role) noexcept
 {
@@ -42,7 +57,7 @@ struct RcSnapshot
 /**
  * @brief Type alias for the snapshotbus that transports RC input frames.
  */
-using RcBus = snapshot::SnapshotBus<RcSnapshot>;
+using RcBus = trace::TracedBus<RcSnapshot, trace::Bus::Rc>;
 
 /**
  * @brief Single, shared RcBus instance (created on first use).
@@ -0,0 +1,281 @@
+/**
+ * MIT License
+ *
+ * @brief Telemetry wire format: stream/field tables and the delta record encoder/decoder.
+ *
+ * Shared by the firmware streamer and the host decoder (no Arduino dependency).
+ *
+ * @file TelemetryFormat.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <Cobs.h>
+
+namespace telemetry
+{
+    /**
+     * @brief Record streams (4-bit id on the wire).
+     */
+    enum class Stream : std::uint8_t
+    {
+        Motor = 0, ///< MotorStateBus.
+        Control,   ///< ControlBus.
+        Battery,   ///< BatteryBus.
+        Imu,       ///< ImuBus.
+        Obstacle,  ///< ObstacleBus.
+        Stats,     ///< Streamer counters.
+        Count
+    };
+
+    /// @brief One field: fixed-point integer on the wire, value = raw / 10^decimals.
+    struct Field
+    {
+        const char *name;      ///< CSV column.
+        std::uint8_t decimals; ///< Fixed-point places.
+    };
+
+    /// @brief One stream: CSV name and its fields in wire order.
+    struct StreamSpec
+    {
+        const char *name;    ///< Stream name (CSV file suffix).
+        const Field *fields; ///< Fields.
+        std::uint8_t count;  ///< Number of fields.
+    };
+
+    // ---- Field tables (append only: the decoder reads these too) ---- //
+
+    inline constexpr Field kMotorFields[] = {{"duty_pct", 2},  {"speed_rpm", 1},     {"battery_v", 3},
+                                             {"motor_c", 1},   {"driver_c", 1},      {"phase", 0},
+                                             {"limits", 0},    {"dir", 0},           {"closed_loop", 0}};
+    inline constexpr Field kControlFields[] = {{"throttle_pct", 2}, {"max_pct", 2}, {"accel_pct_s", 1}, {"drive_mode", 0},
+                                               {"dir", 0},          {"brake", 0},   {"obstacle_guard", 0}};
+    inline constexpr Field kBatteryFields[] = {{"volts", 3}, {"raw_volts", 3}, {"low", 0}, {"valid", 0}};
+    inline constexpr Field kImuFields[] = {{"pitch_deg", 2}, {"roll_deg", 2}, {"yaw_rate_dps", 2},
+                                           {"tipped", 0},    {"overflows", 0}, {"valid", 0}};
+    inline constexpr Field kObstacleFields[] = {{"distance_m", 3}, {"clear", 0}, {"valid", 0}};
+    inline constexpr Field kStatsFields[] = {{"sent", 0}, {"dropped", 0}, {"bytes", 0}};
+
+    template <size_t N>
+    constexpr StreamSpec spec(const char *name, const Field (&f)[N]) noexcept
+    {
+        return {name, f, static_cast<std::uint8_t>(N)};
+    }
+
+    inline constexpr std::array<StreamSpec, static_cast<size_t>(Stream::Count)> kStreams = {
+        spec("motor", kMotorFields), spec("control", kControlFields),   spec("battery", kBatteryFields),
+        spec("imu", kImuFields),     spec("obstacle", kObstacleFields), spec("stats", kStatsFields)};
+
+    constexpr size_t kMaxFields = 12;                               ///< Widest stream allowed.
+    constexpr size_t kMaxPayload = 1 + 1 + 10 + kMaxFields * 5 + 1; ///< Header, seq, time, fields, CRC.
+    constexpr size_t kMaxFrame = ctl::cobs_max(kMaxPayload) + 2;    ///< Encoded plus a 0x00 either side.
+    constexpr std::uint8_t kKeyBit = 0x80;                          ///< Header: absolute values follow.
+
+    /// @brief Round to the field's fixed point.
+    constexpr std::int32_t fixed(float v, std::uint8_t decimals) noexcept
+    {
+        float s = v;
+        for (std::uint8_t i = 0; i < decimals; ++i)
+            s *= 10.0f;
+        return static_cast<std::int32_t>(s >= 0.0f ? s + 0.5f : s - 0.5f);
+    }
+
+    /**
+     * @brief Record encoder: one frame per sample, deltas against the last sample of the same stream.
+     *
+     * Payload: header (stream | kKeyBit), u8 sequence (every frame), time
+     * (keyframe: absolute µs; otherwise µs since the stream's last record) and
+     * each field as a zig-zag varint (keyframe: value; otherwise change). A
+     * CRC-8 closes the payload, then COBS with a 0x00 either side: debug text
+     * printed between frames then lands in its own (rejected) frame instead
+     * of corrupting the next record. Keyframes go out every key_every records
+     * and after invalidate(), so a receiver that joins late or loses a frame
+     * resynchronises.
+     */
+    class Encoder
+    {
+    public:
+        /**
+         * @brief Construct with the keyframe cadence.
+         *
+         * @param key_every Records per stream between keyframes (≥ 1).
+         */
+        explicit Encoder(std::uint16_t key_every = 50) noexcept : key_every_(key_every ? key_every : 1) {}
+
+        /**
+         * @brief Encode one record.
+         *
+         * @param s Stream.
+         * @param t_us Sample time (µs).
+         * @param v kStreams[s].count fixed-point values.
+         * @param out kMaxFrame bytes.
+         * @return Frame length including both delimiters.
+         */
+        size_t encode(Stream s, std::uint64_t t_us, const std::int32_t *v, std::uint8_t *out) noexcept
+        {
+            State &st = state_[static_cast<size_t>(s)];
+            const size_t n = kStreams[static_cast<size_t>(s)].count;
+            const bool key = !st.synced || st.since_key >= key_every_;
+
+            std::uint8_t p[kMaxPayload];
+            size_t len = 0;
+            p[len++] = static_cast<std::uint8_t>(static_cast<std::uint8_t>(s) | (key ? kKeyBit : 0));
+            p[len++] = seq_++;
+            len += ctl::put_varint(key ? t_us : t_us - st.t_us, p + len);
+            for (size_t i = 0; i < n; ++i)
+            {
+                const std::int32_t d = key ? v[i] : static_cast<std::int32_t>(static_cast<std::uint32_t>(v[i]) -
+                                                                            static_cast<std::uint32_t>(st.v[i]));
+                len += ctl::put_varint(ctl::zigzag(d), p + len);
+                st.v[i] = v[i];
+            }
+            p[len] = ctl::crc8(p, len);
+            ++len;
+
+            st.t_us = t_us;
+            st.synced = true;
+            st.since_key = key ? 1 : static_cast<std::uint16_t>(st.since_key + 1);
+
+            out[0] = 0;
+            const size_t m = ctl::cobs_encode(p, len, out + 1);
+            out[m + 1] = 0;
+            return m + 2;
+        }
+
+        /**
+         * @brief The last frame of s never left: send a keyframe next (and keep the sequence contiguous).
+         *
+         * @param s Stream.
+         */
+        void invalidate(Stream s) noexcept
+        {
+            state_[static_cast<size_t>(s)].synced = false;
+            --seq_;
+        }
+
+    private:
+        /// @brief Per-stream reference.
+        struct State
+        {
+            std::uint64_t t_us{0};                    ///< Last record time.
+            std::array<std::int32_t, kMaxFields> v{}; ///< Last values.
+            std::uint16_t since_key{0};               ///< Records since the last keyframe.
+            bool synced{false};                       ///< A keyframe has gone out.
+        };
+
+        std::array<State, static_cast<size_t>(Stream::Count)> state_{}; ///< Streams.
+        std::uint16_t key_every_{50};                                   ///< Keyframe cadence.
+        std::uint8_t seq_{0};                                           ///< Frame sequence.
+    };
+
+    /**
+     * @brief Record decoder: frames in, absolute samples out.
+     */
+    class Decoder
+    {
+    public:
+        /// @brief Why a frame produced no sample.
+        enum class Result : std::uint8_t
+        {
+            Ok = 0,   ///< Sample decoded.
+            Corrupt,  ///< COBS, CRC or layout error.
+            Unsynced, ///< Delta for a stream without a keyframe since the last loss.
+        };
+
+        /**
+         * @brief Decode one frame (delimiter stripped; decoded in place).
+         *
+         * @param f Frame bytes (overwritten).
+         * @param n Frame length.
+         * @param s Stream decoded.
+         * @param t_us Sample time.
+         * @param v kStreams[s].count values.
+         * @return Ok when s, t_us and v are valid.
+         */
+        Result decode(std::uint8_t *f, size_t n, Stream &s, std::uint64_t &t_us, std::int32_t *v) noexcept
+        {
+            std::uint8_t crc = 0;
+            const size_t len = ctl::cobs_decode_crc8(f, n, f, crc);
+            if (len < 4 || crc != 0)
+                return Result::Corrupt; ///< Text or line noise; a real frame lost here shows as a sequence gap.
+            const std::uint8_t id = f[0] & 0x0F;
+            const bool key = (f[0] & kKeyBit) != 0;
+            if (id >= static_cast<std::uint8_t>(Stream::Count))
+                return Result::Corrupt;
+
+            if (have_seq_ && f[1] != static_cast<std::uint8_t>(seq_ + 1))
+                lost(); ///< A whole frame vanished: every delta chain is suspect.
+            seq_ = f[1];
+            have_seq_ = true;
+
+            s = static_cast<Stream>(id);
+            State &st = state_[id];
+            if (!key && !st.synced)
+                return Result::Unsynced;
+
+            const std::uint8_t *p = f + 2;
+            const std::uint8_t *end = f + len - 1;
+            std::uint64_t x = 0;
+            if (!ctl::get_varint(p, end, x))
+                return corrupt(st);
+            st.t_us = key ? x : st.t_us + x;
+
+            const size_t count = kStreams[id].count;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!ctl::get_varint(p, end, x))
+                    return corrupt(st);
+                const std::int32_t d = ctl::unzigzag(static_cast<std::uint32_t>(x));
+                st.v[i] = key ? d
+                              : static_cast<std::int32_t>(static_cast<std::uint32_t>(st.v[i]) + static_cast<std::uint32_t>(d));
+                v[i] = st.v[i];
+            }
+            if (p != end)
+                return corrupt(st);
+            st.synced = true;
+            t_us = st.t_us;
+            return Result::Ok;
+        }
+
+    private:
+        /// @brief Per-stream reference.
+        struct State
+        {
+            std::uint64_t t_us{0};                    ///< Last record time.
+            std::array<std::int32_t, kMaxFields> v{}; ///< Last values.
+            bool synced{false};                       ///< Holding a keyframe-based reference.
+        };
+
+        /// @brief Drop every reference until the next keyframes.
+        void lost() noexcept
+        {
+            for (State &st : state_)
+                st.synced = false;
+        }
+
+        Result corrupt(State &st) noexcept
+        {
+            st.synced = false;
+            return Result::Corrupt;
+        }
+
+        std::array<State, static_cast<size_t>(Stream::Count)> state_{}; ///< Streams.
+        std::uint8_t seq_{0};                                           ///< Last sequence seen.
+        bool have_seq_{false};                                          ///< seq_ valid.
+    };
+
+    static_assert([]
+                  {
+                      for (const StreamSpec &s : kStreams)
+                          if (s.count > kMaxFields)
+                              return false;
+                      return true;
+                  }(),
+                  "Stream wider than kMaxFields.");
+} ///< Namespace telemetry.
@@ -0,0 +1,293 @@
+/**
+ * MIT License
+ *
+ * @brief Task and bus trace: event capture buffer, bus wrapper and the binary dump format.
+ *
+ * @file Trace.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <app_config.h>
+#include <SnapshotBus.h>
+
+namespace trace
+{
+    /// @brief What an event records; the id field means a different thing for each.
+    enum class Kind : std::uint8_t
+    {
+        TaskIn = 0, ///< Task sampler saw a task start running on the event's core (id: task slot).
+        TaskOut,    ///< Task sampler saw the task leave the event's core (id: task slot).
+        Begin,      ///< Work span opened (id: Track).
+        End,        ///< Work span closed (id: Track).
+        Publish,    ///< SnapshotBus publish (id: Bus).
+        Peek        ///< SnapshotBus peek (id: Bus).
+    };
+
+    /// @brief Work spans: one loop iteration of a task (or a drive sub-step).
+    enum class Track : std::uint8_t
+    {
+        StateManager = 0, ///< Button scan + InputBus publish.
+        ControlCore,      ///< Input → control command.
+        PDHandler,        ///< Drive tick.
+        Traction,         ///< Traction inner step.
+        RcPub,            ///< Receiver poll + RcBus publish.
+        Count
+    };
+
+    /// @brief The shared buses.
+    enum class Bus : std::uint8_t
+    {
+        Input = 0,
+        Control,
+        MotorState,
+        Battery,
+        Rc,
+        Imu,
+        Obstacle,
+        Tune,
+        Event,
+        Count
+    };
+
+    /// @brief One captured event (8 bytes on the wire, little-endian).
+    struct Event
+    {
+        std::uint32_t t_us{0};  ///< now_us() low 32 bits (the converter unwraps).
+        Kind kind{Kind::Begin}; ///< Event kind.
+        std::uint8_t core{0};   ///< CPU the event happened on.
+        std::uint16_t id{0};    ///< Task slot, Track or Bus (see Kind).
+    };
+    static_assert(sizeof(Event) == 8, "Event is the 8-byte wire record.");
+
+    /**
+     * @brief Fixed capture buffer: fills once from start(), then drops until the next start().
+     *
+     * Writers claim a slot with one atomic add, so tasks on both cores and the
+     * task sampler's timer interrupt can record without a lock. Nothing is overwritten:
+     * once the buffer is full the rest are only counted, and the buffer is read
+     * out after stop(), when no writer can be mid-record.
+     */
+    class Recorder
+    {
+    public:
+        static constexpr size_t kEvents = cfg::trace::ENABLED ? cfg::trace::EVENTS : 1; ///< Nothing reserved when off.
+        static constexpr size_t kNameLen = 16;                                          ///< FreeRTOS task name limit.
+
+        /// @brief Empty the buffer and start capturing.
+        void start() noexcept
+        {
+            head_.store(0, std::memory_order_relaxed);
+            armed_.store(true, std::memory_order_release);
+        }
+
+        /// @brief Stop capturing (events already claimed still land).
+        void stop() noexcept { armed_.store(false, std::memory_order_release); }
+
+        [[nodiscard]] bool armed() const noexcept { return armed_.load(std::memory_order_relaxed); }
+        [[nodiscard]] bool full() const noexcept { return head_.load(std::memory_order_relaxed) >= kEvents; }
+        [[nodiscard]] size_t count() const noexcept
+        {
+            const size_t n = head_.load(std::memory_order_relaxed);
+            return (n < kEvents) ? n : kEvents;
+        }
+        [[nodiscard]] uint32_t dropped() const noexcept
+        {
+            const size_t n = head_.load(std::memory_order_relaxed);
+            return static_cast<uint32_t>((n > kEvents) ? n - kEvents : 0);
+        }
+
+        /**
+         * @brief Append one event (safe from any task, either core, or the sampler interrupt).
+         *
+         * @param kind Event kind.
+         * @param id Task slot, Track or Bus.
+         */
+        void record(Kind kind, std::uint16_t id) noexcept
+        {
+            record(kind, id, static_cast<std::uint8_t>(xPortGetCoreID()));
+        }
+
+        /**
+         * @brief Append one event observed on @p core (the task sampler reads both cores from one).
+         *
+         * @param kind Event kind.
+         * @param id Task slot, Track or Bus.
+         * @param core CPU the event happened on.
+         */
+        void record(Kind kind, std::uint16_t id, std::uint8_t core) noexcept
+        {
+            if (!armed_.load(std::memory_order_relaxed))
+                return;
+            const size_t i = head_.fetch_add(1, std::memory_order_relaxed);
+            if (i >= kEvents)
+                return; ///< Full: counted in dropped().
+            ring_[i] = Event{static_cast<std::uint32_t>(now_us()), kind, core, id};
+        }
+
+        /**
+         * @brief Slot for a scheduler task handle, naming it on first sight.
+         *
+         * @param handle Task handle (any stable pointer).
+         * @param name Task name (copied).
+         * @return Slot, or MAX_TASKS when the table is full.
+         */
+        std::uint16_t task_slot(const void *handle, const char *name) noexcept
+        {
+            const size_t n = tasks_.load(std::memory_order_acquire);
+            for (size_t i = 0; i < n; ++i)
+                if (task_[i].handle == handle)
+                    return static_cast<std::uint16_t>(i);
+
+            const size_t i = tasks_claim_.fetch_add(1, std::memory_order_relaxed);
+            if (i >= cfg::trace::MAX_TASKS)
+                return static_cast<std::uint16_t>(cfg::trace::MAX_TASKS);
+            task_[i].handle = handle;
+            strncpy(task_[i].name, (name != nullptr) ? name : "?", kNameLen - 1);
+            tasks_.store(i + 1, std::memory_order_release); ///< Two new tasks at once may name twice; harmless.
+            return static_cast<std::uint16_t>(i);
+        }
+
+        /**
+         * @brief Write the capture in the dump format.
+         *
+         * "LMTRACE1", u32 count, u32 dropped, u8 names; per name: u8 kind
+         * (0 task slot, 1 track, 2 bus), u8 id, u8 length, bytes; then count
+         * 8-byte events; then "LMTREND\n". All integers little-endian.
+         *
+         * @param out Callable as out(const uint8_t *data, size_t len).
+         */
+        template <typename Sink>
+        void dump(Sink &&out) const
+        {
+            static constexpr const char *kTracks[] = {"StateManager", "ControlCore", "PDHandler", "Traction", "RcPub"};
+            static constexpr const char *kBuses[] = {"InputBus",   "ControlBus", "MotorStateBus", "BatteryBus",
+                                                     "RcBus",      "ImuBus",     "ObstacleBus",   "TuneBus",
+                                                     "EventBus"};
+            static_assert(sizeof(kTracks) / sizeof(kTracks[0]) == static_cast<size_t>(Track::Count), "Name every Track.");
+            static_assert(sizeof(kBuses) / sizeof(kBuses[0]) == static_cast<size_t>(Bus::Count), "Name every Bus.");
+
+            auto u8 = [&out](std::uint8_t v) { out(&v, 1); };
+            auto u32 = [&out](std::uint32_t v)
+            {
+                const std::uint8_t b[4] = {static_cast<std::uint8_t>(v), static_cast<std::uint8_t>(v >> 8),
+                                           static_cast<std::uint8_t>(v >> 16), static_cast<std::uint8_t>(v >> 24)};
+                out(b, 4);
+            };
+            auto name = [&](std::uint8_t kind, size_t id, const char *s)
+            {
+                const size_t len = strnlen(s, kNameLen);
+                u8(kind);
+                u8(static_cast<std::uint8_t>(id));
+                u8(static_cast<std::uint8_t>(len));
+                out(reinterpret_cast<const std::uint8_t *>(s), len);
+            };
+
+            const size_t n = count();
+            const size_t tasks = tasks_.load(std::memory_order_acquire);
+            out(reinterpret_cast<const std::uint8_t *>("LMTRACE1"), 8);
+            u32(static_cast<std::uint32_t>(n));
+            u32(dropped());
+            u8(static_cast<std::uint8_t>(tasks + static_cast<size_t>(Track::Count) + static_cast<size_t>(Bus::Count)));
+            for (size_t i = 0; i < tasks; ++i)
+                name(0, i, task_[i].name);
+            for (size_t i = 0; i < static_cast<size_t>(Track::Count); ++i)
+                name(1, i, kTracks[i]);
+            for (size_t i = 0; i < static_cast<size_t>(Bus::Count); ++i)
+                name(2, i, kBuses[i]);
+
+            for (size_t i = 0; i < n; ++i)
+            {
+                const Event &e = ring_[i];
+                u32(e.t_us);
+                u8(static_cast<std::uint8_t>(e.kind));
+                u8(e.core);
+                u8(static_cast<std::uint8_t>(e.id));
+                u8(static_cast<std::uint8_t>(e.id >> 8));
+            }
+            out(reinterpret_cast<const std::uint8_t *>("LMTREND\n"), 8);
+        }
+
+    private:
+        /// @brief Task seen by the sampler.
+        struct TaskName
+        {
+            const void *handle{nullptr}; ///< Task handle.
+            char name[kNameLen]{};       ///< Copied name (the TCB may be freed before the dump).
+        };
+
+        std::array<Event, kEvents> ring_{};                  ///< Capture.
+        std::atomic<size_t> head_{0};                        ///< Next slot (keeps counting past full).
+        std::atomic<bool> armed_{false};                     ///< Capturing.
+        std::array<TaskName, cfg::trace::MAX_TASKS> task_{}; ///< Task slots.
+        std::atomic<size_t> tasks_{0};                       ///< Slots published to readers.
+        std::atomic<size_t> tasks_claim_{0};                 ///< Slots handed out.
+    };
+
+    /// @brief The one recorder (a namespace-scope object, so the sampler interrupt never hits a static-init guard).
+    inline Recorder recorder{};
+
+    /// @brief Record one event; compiles to nothing unless TRACING.
+    inline void record(Kind kind, std::uint16_t id) noexcept
+    {
+        if constexpr (cfg::trace::ENABLED)
+            recorder.record(kind, id);
+    }
+
+    /// @brief Open a work span (use Span; it pairs this with end()).
+    inline void begin(Track t) noexcept { record(Kind::Begin, static_cast<std::uint16_t>(t)); }
+
+    /// @brief Close a work span.
+    inline void end(Track t) noexcept { record(Kind::End, static_cast<std::uint16_t>(t)); }
+
+    /**
+     * @brief begin()/end() around a scope.
+     */
+    class Span
+    {
+    public:
+        explicit Span(Track t) noexcept : t_(t) { begin(t_); }
+        ~Span() { end(t_); }
+        Span(const Span &) = delete;
+        Span &operator=(const Span &) = delete;
+
+    private:
+        Track t_; ///< Span track.
+    };
+
+    /**
+     * @brief SnapshotBus that records every publish and peek.
+     *
+     * Drop-in for snapshot::SnapshotBus<T> (the bus aliases use it); without
+     * TRACING the calls forward straight through.
+     */
+    template <typename T, Bus B>
+    class TracedBus : public snapshot::SnapshotBus<T>
+    {
+        using Base = snapshot::SnapshotBus<T>;
+
+    public:
+        template <typename... A>
+        decltype(auto) publish(A &&...a) noexcept
+        {
+            record(Kind::Publish, static_cast<std::uint16_t>(B));
+            return Base::publish(std::forward<A>(a)...);
+        }
+
+        template <typename... A>
+        [[nodiscard]] decltype(auto) peek(A &&...a) const noexcept
+        {
+            record(Kind::Peek, static_cast<std::uint16_t>(B));
+            return Base::peek(std::forward<A>(a)...);
+        }
+    };
+} ///< Namespace trace.
@@ -0,0 +1,46 @@
+/**
+ * MIT License
+ *
+ * @brief Snapshot payload and bus for speed-loop autotune results (PowerDriveHandler → GainSaver).
+ *
+ * @file TuneBus.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <SnapshotBus.h>
+#include <Trace.h>
+#include <Pid.h>
+
+/**
+ * @brief The latest completed relay autotune.
+ */
+struct TuneSnapshot
+{
+    ctl::PidGains gains{};     ///< Gains now in the speed loop.
+    float ku{0.0f};            ///< Ultimate gain measured.
+    float tu_s{0.0f};          ///< Ultimate period measured (s).
+    std::uint32_t seq{0};      ///< Completed tunes since boot (0 → none yet).
+    std::uint64_t stamp_us{0}; ///< When the tune finished (µs since boot).
+};
+
+/**
+ * @brief Type alias for the SnapshotBus that transports autotune results.
+ */
+using TuneBus = trace::TracedBus<TuneSnapshot, trace::Bus::Tune>;
+
+/**
+ * @brief Single, shared TuneBus instance.
+ */
+namespace buses
+{
+    inline TuneBus &tune() noexcept ///< Return reference to the shared TuneBus.
+    {
+        static TuneBus bus{}; ///< One (only) TuneBus instance.
+        return bus;           ///< Return reference to shared bus.
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of BatteryMonitor (pack voltage sampling).
+ *
+ * @file BatteryMonitor.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "BatteryMonitor.h"
+
+// Configure the ADC input (full 0–3.1 V range).
+void BatteryMonitor::begin() noexcept
+{
+    analogReadResolution(12);
+    analogSetPinAttenuation(cfg::battery::PIN, ADC_11db);
+}
+
+// One oversampled reading.
+float BatteryMonitor::sample_volts() const noexcept
+{
+    uint32_t sum_mv = 0;
+    for (uint8_t i = 0; i < cfg::battery::OVERSAMPLE; ++i)
+        sum_mv += analogReadMilliVolts(cfg::battery::PIN);
+
+    const float pin_v = static_cast<float>(sum_mv) / (1000.0f * static_cast<float>(cfg::battery::OVERSAMPLE));
+    return pin_v * cfg::battery::DIVIDER_RATIO;
+}
+
+// Main run loop.
+void BatteryMonitor::run() noexcept
+{
+    configASSERT(bus_ != nullptr); ///< Sanity check: bus_ must be valid.
+    configASSERT(loop_ticks_ > 0); ///< Timing must be configured.
+
+    TickType_t last_wake = xTaskGetTickCount();
+
+    for (;;)
+    {
+        const float v = sample_volts();
+
+        if (samples_ == 0)
+            volts_ = v; ///< Seed: no start-up ramp from 0 V.
+        else
+            volts_ += cfg::battery::FILTER_ALPHA * (v - volts_);
+        if (samples_ < cfg::battery::SETTLE_SAMPLES)
+            ++samples_;
+
+        BatterySnapshot s{};
+        s.volts = volts_;
+        s.raw_volts = v;
+        s.low = volts_ < cfg::battery::LIMIT_START_V;
+        s.valid = samples_ >= cfg::battery::SETTLE_SAMPLES; ///< One seed read is noisy; wait about τ.
+        s.stamp_us = now_us();
+        bus_->publish(s);
+
+        vTaskDelayUntil(&last_wake, loop_ticks_);
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * MIT License
+ *
+ * @brief Battery voltage sampling (ADC → BatteryBus).
+ *
+ * @file BatteryMonitor.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <BatteryBus.h>
+
+/**
+ * @brief Samples the pack voltage through a resistor divider and publishes it.
+ *
+ * Each tick averages OVERSAMPLE calibrated ADC reads (analogReadMilliVolts uses
+ * the eFuse calibration), then a one-pole low-pass removes motor PWM ripple
+ * while still following load sag within a few hundred milliseconds.
+ */
+class BatteryMonitor
+{
+public:
+    /**
+     * @brief Construct with output bus.
+     *
+     * @param bus Battery bus (non-owning).
+     * @param period_ms Sample period (milliseconds).
+     */
+    explicit BatteryMonitor(BatteryBus &bus, uint32_t period_ms = cfg::battery::PERIOD_MS) noexcept
+        : bus_(&bus), loop_ticks_(to_ticks_ms(period_ms)) {}
+
+    /**
+     * @brief Configure the ADC pin (call once before the task starts).
+     */
+    void begin() noexcept;
+
+    /**
+     * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
+     */
+    static inline void task(void *self) noexcept
+    {
+        static_cast<BatteryMonitor *>(self)->run();
+    }
+
+private:
+    /// @brief Main run loop.
+    void run() noexcept;
+
+    /// @brief One oversampled reading at the pack (V).
+    [[nodiscard]] float sample_volts() const noexcept;
+
+    // ---- Internal state ---- //
+    BatteryBus *bus_{nullptr}; ///< Non-owning output bus.
+    TickType_t loop_ticks_{0}; ///< Delay (in ticks) between samples.
+    float volts_{0.0f};        ///< Filter state (V).
+    uint8_t samples_{0};       ///< Samples filtered, saturating at cfg::battery::SETTLE_SAMPLES.
+};
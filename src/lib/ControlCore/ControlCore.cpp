@@ -11,6 +11,59 @@
 
 #include "ControlCore.h"
 
+// Mode table lookup, then the knob.
+ctl::DriveLimits ControlCore::drive_limits(const RcSnapshot &f) noexcept
+{
+    uint8_t mode = cfg::drivemode::NO_RC_MODE;
+    float power = 100.0f; ///< Knob ignored unless the link is live.
+    if (f.failsafe && f.linked)
+        mode = cfg::drivemode::FAILSAFE_MODE; ///< Lost link never lands in a faster mode.
+    else if (f.failsafe)
+        mode = cfg::drivemode::NO_RC_MODE; ///< Nothing since boot: no receiver fitted (or not bound).
+    else if (f.stamp_us != 0)
+    {
+        mode = ctl::mode_index(rc_get(f, RC::mode), kModes.size());
+        power = rc_get(f, RC::power);
+    }
+
+    if (mode != mode_)
+    {
+        if (events_ != nullptr) ///< EventLogger prints it, off this task.
+            record_event((*events_)[Event::DriveMode], now_us(), 0, kModes[mode].max_pct, kModes[mode].accel_pct_s,
+                         (static_cast<uint32_t>(mode_) << 8) | mode);
+        mode_ = mode;
+    }
+    return ctl::apply_power(kModes[mode], power);
+}
+
+// Steering: parent's stick only.
+float ControlCore::steer_cmd(const RcSnapshot &f) const noexcept
+{
+    if (f.stamp_us == 0 || f.failsafe)
+        return 0.0f; ///< Lost link: straight ahead.
+    return fminf(fmaxf(rc_get(f, RC::steering), -kMaxPct), kMaxPct);
+}
+
+// Obstacle guard policy.
+bool ControlCore::obstacle_guard(const RcSnapshot &f) const noexcept
+{
+    if (!features_.obstacle)
+        return false;
+    if (f.stamp_us == 0 || f.failsafe)
+        return cfg::obstacle::GUARD_WITHOUT_RC; ///< Switch position unknown.
+    return rc_get(f, RC::obstacle) > 0.5f;
+}
+
+// Autotune: parent's switch only.
+bool ControlCore::autotune_request(const RcSnapshot &f, bool pedals) const noexcept
+{
+    if (!features_.autotune || pedals)
+        return false;
+    if (f.stamp_us == 0 || f.failsafe)
+        return false; ///< Lost link: release, and the drive aborts.
+    return rc_get(f, RC::override) > 0.5f;
+}
+
 // Main run loop.
 void ControlCore::run() noexcept
 {
@@ -21,34 +74,53 @@ void ControlCore::run() noexcept
 
     for (;;)
     {
-        const InputState cur = in_->peek();
+        step();
+        vTaskDelayUntil(&last_wake, loop_ticks_);
+    }
+}
 
-        // Input event logging.
-        if (has_prev_)
-        {
-            logButtonEvents(prev_, cur);
-        }
+// One control tick.
+void ControlCore::step() noexcept
+{
+    const trace::Span span(trace::Track::ControlCore);
+    const InputState cur = in_->peek();
+    const RcSnapshot rc = (rc_ != nullptr) ? rc_->peek() : RcSnapshot{}; ///< One frame per tick; unstamped reads as no receiver.
 
-        // Build control commands.
-        ControlSnapshot out{};
-        out.throttle_cmd_pct = cur.buttons.test(idx(kBtnAccel)) ? kMaxPct : kMinPct;
-        out.horn_cmd = cur.buttons.test(idx(kBtnHorn));
+    // Input event logging.
+    if (has_prev_)
+    {
+        logButtonEvents(prev_, cur);
+    }
 
-        out.indicator_cmd = ControlSnapshot::Indicator::Off;
+    // Build control commands.
+    ControlSnapshot out{};
+    const bool accel = cur.buttons.test(idx(kBtnAccel));
+    const bool reverse = cur.buttons.test(idx(kBtnReverse));
+    const bool horn = cur.buttons.test(idx(kBtnHorn));
+    out.autotune_cmd = autotune_request(rc, accel || reverse);
+    out.throttle_cmd_pct = accel ? kMaxPct : kMinPct;
+    const ctl::DriveLimits lim = drive_limits(rc); ///< Caps ride along; the drive enforces them.
+    out.max_pct = lim.max_pct;
+    out.accel_pct_s = lim.accel_pct_s;
+    out.drive_mode = mode_;
+    out.steer_cmd_pct = steer_cmd(rc);
+    out.dir_cmd = reverse ? ControlSnapshot::Direction::Reverse : ControlSnapshot::Direction::Forward;
+    out.brake_cmd = kBrakeOnRelease && !accel;
+    out.horn_cmd = horn;
+    out.obstacle_guard = obstacle_guard(rc);
 
-        if (cur.buttons.test(idx(kBtnLeft)))
-            out.indicator_cmd = ControlSnapshot::Indicator::Left;
-        else if (cur.buttons.test(idx(kBtnRight)))
-            out.indicator_cmd = ControlSnapshot::Indicator::Right;
+    out.indicator_cmd = ControlSnapshot::Indicator::Off;
 
-        out.stamp_ms = cur.stamp_ms;
+    if (cur.buttons.test(idx(kBtnLeft)))
+        out.indicator_cmd = ControlSnapshot::Indicator::Left;
+    else if (cur.buttons.test(idx(kBtnRight)))
+        out.indicator_cmd = ControlSnapshot::Indicator::Right;
 
-        out_->publish(out);
+    out.stamp_ms = cur.stamp_ms;
 
-        // Update previous snapshot for next edge detection.
-        prev_ = cur;
-        has_prev_ = true;
+    out_->publish(out);
 
-        vTaskDelayUntil(&last_wake, loop_ticks_);
-    }
+    // Update previous snapshot for next edge detection.
+    prev_ = cur;
+    has_prev_ = true;
 }
\ No newline at end of file
@@ -15,6 +15,9 @@
 #include <cmath>
 #include <InputBus.h>
 #include <ControlBus.h>
+#include <RcBus.h>
+#include <EventBus.h>
+#include <DriveMode.h>
 
 /**
  * @brief Applies control policy to raw inputs and emits resolved commands.
@@ -25,6 +28,13 @@
 class ControlCore
 {
 public:
+    /// @brief Policy switches (cfg defaults; see set_features()).
+    struct Features
+    {
+        bool obstacle{cfg::obstacle::ENABLED};   ///< Raise ControlSnapshot::obstacle_guard (RC switch / no-RC default).
+        bool autotune{cfg::speed::TUNE_ENABLED}; ///< Let RC::override request the speed-loop autotune.
+    };
+
     /**
      * @brief Construct with input bus and output bus.
      *
@@ -35,6 +45,32 @@ public:
     ControlCore(InputBus &in, ControlBus &out, std::uint32_t period_ms = cfg::tick::LOOP_MS) noexcept
         : in_(&in), out_(&out), loop_ticks_(to_ticks_ms(period_ms)) {}
 
+    /**
+     * @brief Attach the RC bus (call before the task starts).
+     * @note Only the parent's controls are read: RC::steering, RC::mode, RC::power,
+     *       RC::obstacle and, with Features::autotune, RC::override.
+     *
+     * @param rc RC bus (non-owning).
+     */
+    void attach_rc(RcBus &rc) noexcept { rc_ = &rc; }
+
+    /**
+     * @brief Attach the event buses (call before the task starts).
+     * @note Records Event::DriveMode on each mode change; EventLogger prints it.
+     *
+     * @param events Event buses (non-owning).
+     */
+    void attach_events(EventBuses &events) noexcept { events_ = &events; }
+
+    /**
+     * @brief Override the cfg feature switches (call before the task starts).
+     * @note Firmware builds keep the cfg defaults; the host scenario suite uses this
+     *       to run each policy on the unmodified core without a rebuild.
+     *
+     * @param f Policies to apply.
+     */
+    void set_features(const Features &f) noexcept { features_ = f; }
+
     /**
      * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
      */
@@ -43,24 +79,68 @@ public:
         static_cast<ControlCore *>(self)->run();
     }
 
+    /**
+     * @brief One control tick: peek the inputs, publish one ControlSnapshot.
+     * @note run() calls this every period; the host simulator calls it directly.
+     */
+    void step() noexcept;
+
 private:
     /// @brief Main run loop.
     void run() noexcept;
 
+    /// @brief Drive-mode limits with the power knob applied (tracks mode_, recording each change).
+    [[nodiscard]] ctl::DriveLimits drive_limits(const RcSnapshot &f) noexcept;
+
+    /// @brief Steering for the differential mix: RC::steering on a live link, else straight.
+    [[nodiscard]] float steer_cmd(const RcSnapshot &f) const noexcept;
+
+    /// @brief Obstacle guard: RC switch when the link is up, else cfg::obstacle::GUARD_WITHOUT_RC.
+    [[nodiscard]] bool obstacle_guard(const RcSnapshot &f) const noexcept;
+
+    /**
+     * @brief Autotune request: the parent holds RC::override up on a live link.
+     * @note Off unless Features::autotune (cfg::speed::TUNE_ENABLED). To run it: car
+     *       stopped, facing forward on a clear flat stretch; hold the override switch
+     *       (SwA) up until the drive leaves its Tuning phase (≤ TUNE_TIMEOUT_S). The
+     *       gains are saved to NVS. Dropping the switch, losing the link or any pedal
+     *       from the child drops the request, and the drive aborts the run (dead-man).
+     *
+     * @param f RC frame for this tick.
+     * @param pedals True → accelerator or reverse held.
+     */
+    [[nodiscard]] bool autotune_request(const RcSnapshot &f, bool pedals) const noexcept;
+
     // ---- Button roles (policy-level) ---- //
     static constexpr ButtonIndex kBtnAccel = ButtonIndex::Accelerator;
     static constexpr ButtonIndex kBtnHorn = ButtonIndex::Horn;
     static constexpr ButtonIndex kBtnLeft = ButtonIndex::IndicatorLeft;
     static constexpr ButtonIndex kBtnRight = ButtonIndex::IndicatorRight;
+    static constexpr ButtonIndex kBtnReverse = ButtonIndex::Reverse;
 
     // ---- Policy knobs ---- //
-    static constexpr float kMinPct = 0.0f;   ///< Minimum throttle command (%).
-    static constexpr float kMaxPct = 100.0f; ///< Maximum throttle command (%).
+    static constexpr float kMinPct = 0.0f;         ///< Minimum throttle command (%).
+    static constexpr float kMaxPct = 100.0f;       ///< Maximum throttle command (%).
+    static constexpr bool kBrakeOnRelease = false; ///< True → releasing the accelerator brakes instead of coasting.
+
+    // ---- Drive modes, indexed by the RC::mode switch position ---- //
+    static constexpr ctl::DriveModeTable<cfg::drivemode::COUNT> kModes{{
+        {cfg::drivemode::TODDLER_MAX_PCT, cfg::drivemode::TODDLER_ACCEL_PCT_S},
+        {cfg::drivemode::NORMAL_MAX_PCT, cfg::drivemode::NORMAL_ACCEL_PCT_S},
+        {cfg::drivemode::SPORT_MAX_PCT, cfg::drivemode::SPORT_ACCEL_PCT_S},
+    }};
+    static_assert(cfg::drivemode::NO_RC_MODE < cfg::drivemode::COUNT &&
+                      cfg::drivemode::FAILSAFE_MODE < cfg::drivemode::COUNT,
+                  "Fallback drive modes must be in the table.");
 
     // ---- Internal state ---- //
-    InputBus *in_{nullptr};    ///< Non-owning input bus (raw button snapshots).
-    ControlBus *out_{nullptr}; ///< Non-owning output bus (resolved control commands).
-    TickType_t loop_ticks_{0}; ///< Loop period in FreeRTOS ticks.
+    InputBus *in_{nullptr};                         ///< Non-owning input bus (raw button snapshots).
+    ControlBus *out_{nullptr};                      ///< Non-owning output bus (resolved control commands).
+    TickType_t loop_ticks_{0};                      ///< Loop period in FreeRTOS ticks.
+    RcBus *rc_{nullptr};                            ///< Optional RC bus (non-owning).
+    EventBuses *events_{nullptr};                   ///< Optional edge event record (non-owning).
+    Features features_{};                           ///< Policies in force (cfg defaults).
+    std::uint8_t mode_{cfg::drivemode::NO_RC_MODE}; ///< Drive mode in force.
 
     InputState prev_{};    ///< Previous input snapshot (for edge detection + event logging).
     bool has_prev_{false}; ///< True once prev_ is valid.
@@ -0,0 +1,70 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of the event logger task.
+ *
+ * @file EventLogger.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "EventLogger.h"
+
+// Main run loop.
+void EventLogger::run() noexcept
+{
+    configASSERT(loop_ticks_ > 0); ///< Timing must be configured.
+
+    TickType_t last_wake = xTaskGetTickCount();
+    for (;;)
+    {
+        step();
+        vTaskDelayUntil(&last_wake, loop_ticks_);
+    }
+}
+
+// One poll.
+void EventLogger::step() noexcept
+{
+    for (size_t i = 0; i < kEvents; ++i)
+    {
+        const Event ev = static_cast<Event>(i);
+        const EventSnapshot e = (*events_)[ev].peek();
+        if (e.count == seen_[i])
+            continue;
+
+        if (e.count - seen_[i] > 1)
+            debugfln("(%lu earlier events not shown)", static_cast<unsigned long>(e.count - seen_[i] - 1));
+        seen_[i] = e.count;
+
+        switch (ev)
+        {
+        case Event::RcLinkLost:
+            debugfln("RC link lost: failsafe %lu us after last frame", static_cast<unsigned long>(e.latency_us));
+            break;
+        case Event::ObstacleStop:
+            debugfln("Obstacle: %.2f m closing %.2f m/s, cut %lu us after echo", e.value[0], e.value[1],
+                     static_cast<unsigned long>(e.latency_us));
+            break;
+        case Event::AutotuneStarted:
+            debugfln("Autotune: started (%.0f rpm, relay +/-%.0f%%)", e.value[0], e.value[1]);
+            break;
+        case Event::AutotuneAborted:
+            debugfln("Autotune: aborted at %.0f rpm", e.value[0]);
+            break;
+        case Event::AutotuneDone:
+            debugfln("Autotune: done, Ku=%.3f Tu=%.3fs", e.value[0], e.value[1]);
+            break;
+        case Event::AutotuneFailed:
+            debugln("Autotune: failed (no clean oscillation)");
+            break;
+        case Event::DriveMode:
+            debugfln("Drive mode: %lu -> %lu (max %.0f %%, %.0f %%/s)", static_cast<unsigned long>(e.code >> 8),
+                     static_cast<unsigned long>(e.code & 0xFFu), e.value[0], e.value[1]);
+            break;
+        default:
+            break;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/**
+ * MIT License
+ *
+ * @brief Event logger task: prints the edge events the control tasks record on EventBus.
+ *
+ * @file EventLogger.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <EventBus.h>
+
+/**
+ * @brief Polls every event bus and prints each new occurrence with debugfln.
+ *
+ * Runs at priority 0, so formatting and Serial waits happen after the RC and
+ * drive tasks have done their work, never inside them. Only the latest
+ * occurrence per event is kept; a count jump is reported as missed events.
+ */
+class EventLogger
+{
+public:
+    /**
+     * @brief Construct with the buses to print and poll cadence.
+     *
+     * @param events Event buses (non-owning).
+     * @param period_ms Poll interval (in milliseconds).
+     */
+    explicit EventLogger(EventBuses &events = buses::events(), uint32_t period_ms = cfg::tick::EVENT_LOG_MS) noexcept
+        : events_(&events), loop_ticks_(to_ticks_ms(period_ms)) {}
+
+    /**
+     * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
+     */
+    static inline void task(void *self) noexcept
+    {
+        static_cast<EventLogger *>(self)->run();
+    }
+
+    /**
+     * @brief One poll: print every event whose count moved since the last poll.
+     */
+    void step() noexcept;
+
+private:
+    /// @brief Main run loop.
+    void run() noexcept;
+
+    static constexpr size_t kEvents = EventBuses::kCount; ///< Buses polled.
+
+    // ---- Internal state ---- //
+    EventBuses *events_{nullptr}; ///< Non-owning event buses.
+    TickType_t loop_ticks_{0}; ///< Delay (in ticks) between polls.
+    uint32_t seen_[kEvents]{}; ///< Count already printed, per event.
+};
@@ -0,0 +1,89 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of GainStore (NVS-backed controller gains) and GainSaver.
+ *
+ * @file GainStore.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "GainStore.h"
+
+// Fletcher-16 over the gain bytes.
+uint16_t GainStore::checksum(const ctl::PidGains &g) noexcept
+{
+    const auto *p = reinterpret_cast<const uint8_t *>(&g);
+    uint16_t a = 0, b = 0;
+    for (size_t i = 0; i < sizeof(g); ++i)
+    {
+        a = static_cast<uint16_t>((a + p[i]) % 255);
+        b = static_cast<uint16_t>((b + a) % 255);
+    }
+    return static_cast<uint16_t>((b << 8) | a);
+}
+
+// Read the record.
+bool GainStore::load(ctl::PidGains &out) const noexcept
+{
+    Preferences nvs;
+    if (!nvs.begin(cfg::nvs::NAMESPACE, /*readOnly=*/true))
+        return false;
+
+    Record r{};
+    const bool ok = nvs.getBytesLength(key_) == sizeof(r) && nvs.getBytes(key_, &r, sizeof(r)) == sizeof(r) &&
+                    r.version == kVersion && r.sum == checksum(r.gains);
+    nvs.end();
+
+    if (ok)
+        out = r.gains;
+    return ok;
+}
+
+// Write the record.
+bool GainStore::save(const ctl::PidGains &g) const noexcept
+{
+    Preferences nvs;
+    if (!nvs.begin(cfg::nvs::NAMESPACE, /*readOnly=*/false))
+        return false;
+
+    Record r{};
+    r.version = kVersion;
+    r.gains = g;
+    r.sum = checksum(g);
+    const bool ok = nvs.putBytes(key_, &r, sizeof(r)) == sizeof(r);
+    nvs.end();
+    return ok;
+}
+
+// ---- GainSaver ---- //
+
+// Main run loop.
+void GainSaver::run() noexcept
+{
+    configASSERT(tune_ != nullptr && state_ != nullptr); ///< Sanity check: buses must be valid.
+    configASSERT(loop_ticks_ > 0);                       ///< Timing must be configured.
+
+    TickType_t last_wake = xTaskGetTickCount();
+    for (;;)
+    {
+        step();
+        vTaskDelayUntil(&last_wake, loop_ticks_);
+    }
+}
+
+// One poll.
+void GainSaver::step() noexcept
+{
+    const TuneSnapshot t = tune_->peek();
+    if (t.seq == saved_seq_)
+        return;
+    if (state_->peek().phase != MotorStateSnapshot::RampPhase::Idle)
+        return; ///< Still moving: try again next poll.
+
+    saved_seq_ = t.seq;
+    const bool saved = store_.save(t.gains);
+    debugfln("Autotune: kp=%.3f ki=%.3f kff=%.3f %s", t.gains.kp, t.gains.ki, t.gains.kff,
+             saved ? "saved" : "NOT saved");
+}
@@ -0,0 +1,111 @@
+/**
+ * MIT License
+ *
+ * @brief Persists tuned controller gains in NVS, and the task that does it off the drive loop.
+ *
+ * @file GainStore.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <Preferences.h>
+#include <Pid.h>
+#include <TuneBus.h>
+#include <MotorStateBus.h>
+
+/**
+ * @brief Load/save one PidGains record under a key in the NVS namespace.
+ *
+ * The record carries a version and a checksum so a layout change or a torn
+ * write falls back to the compiled-in defaults instead of loading junk.
+ */
+class GainStore
+{
+public:
+    /**
+     * @brief Construct for one record.
+     *
+     * @param key NVS key (≤ 15 chars).
+     */
+    explicit GainStore(const char *key) noexcept : key_(key) {}
+
+    /**
+     * @brief Read the record.
+     *
+     * @param out Gains (untouched on failure).
+     * @return true if a valid record was found.
+     */
+    bool load(ctl::PidGains &out) const noexcept;
+
+    /**
+     * @brief Write the record (blocks on a flash write, ~10–20 ms).
+     * @return true on success.
+     */
+    bool save(const ctl::PidGains &g) const noexcept;
+
+private:
+    /// @brief On-flash layout.
+    struct Record
+    {
+        uint16_t version{0};   ///< kVersion.
+        uint16_t sum{0};       ///< Checksum over gains.
+        ctl::PidGains gains{}; ///< Payload.
+    };
+
+    static constexpr uint16_t kVersion = 1; ///< Bump when Record changes.
+
+    [[nodiscard]] static uint16_t checksum(const ctl::PidGains &g) noexcept;
+
+    const char *key_{nullptr}; ///< NVS key.
+};
+
+/**
+ * @brief Writes each new autotune result from the TuneBus to NVS.
+ *
+ * The drive only publishes the tuned gains; this priority-0 task does the
+ * flash write. It waits for the car to stop first: a flash write stalls
+ * the caches on both cores, so it should not land while the motor is driven.
+ */
+class GainSaver
+{
+public:
+    /**
+     * @brief Construct with the buses to watch and the record to write.
+     *
+     * @param tune Autotune results (non-owning).
+     * @param state Motor state, for the stopped check (non-owning).
+     * @param key NVS key for the gains.
+     * @param period_ms Poll interval (in milliseconds).
+     */
+    GainSaver(TuneBus &tune, MotorStateBus &state, const char *key = cfg::nvs::SPEED_GAINS,
+              uint32_t period_ms = cfg::tick::GAIN_SAVE_MS) noexcept
+        : tune_(&tune), state_(&state), store_(key), loop_ticks_(to_ticks_ms(period_ms)) {}
+
+    /**
+     * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
+     */
+    static inline void task(void *self) noexcept
+    {
+        static_cast<GainSaver *>(self)->run();
+    }
+
+    /**
+     * @brief One poll: save the latest result if it is new and the car is stopped.
+     */
+    void step() noexcept;
+
+private:
+    /// @brief Main run loop.
+    void run() noexcept;
+
+    // ---- Internal state ---- //
+    TuneBus *tune_{nullptr};        ///< Non-owning result bus.
+    MotorStateBus *state_{nullptr}; ///< Non-owning motor state bus.
+    GainStore store_;               ///< NVS record.
+    TickType_t loop_ticks_{0};      ///< Delay (in ticks) between polls.
+    uint32_t saved_seq_{0};         ///< Last result written (TuneSnapshot::seq).
+};
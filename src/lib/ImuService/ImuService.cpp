@@ -0,0 +1,76 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of ImuService (batched IMU ingestion and attitude).
+ *
+ * @file ImuService.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "ImuService.h"
+
+// Start the source and the filter.
+bool ImuService::begin() noexcept
+{
+    filter_.configure(cfg::imu::FILTER_TAU_S, cfg::imu::ACCEL_GATE_G);
+    filter_.reset();
+    return src_->begin();
+}
+
+// Main run loop.
+void ImuService::run() noexcept
+{
+    configASSERT(src_ != nullptr && bus_ != nullptr); ///< Sanity check: source and bus must be valid.
+    configASSERT(loop_ticks_ > 0);                    ///< Timing must be configured.
+
+    TickType_t last_wake = xTaskGetTickCount();
+    window_us_ = now_us();
+
+    for (;;)
+    {
+        step();
+        vTaskDelayUntil(&last_wake, loop_ticks_);
+    }
+}
+
+// One drain.
+void ImuService::step() noexcept
+{
+    const uint64_t t0 = now_us();
+
+    // One drain per wake-up: the FIFO did the per-sample work.
+    const size_t n = src_->read_batch(batch_.data(), batch_.size());
+    const float dt_s = 1.0f / src_->sample_hz();
+    filter_.update(batch_.data(), n, dt_s);
+
+    float yaw = 0.0f;
+    for (size_t i = 0; i < n; ++i)
+        yaw += batch_[i].gz;
+
+    const uint64_t t1 = now_us();
+    busy_us_ += t1 - t0;
+    if (t1 - window_us_ >= 1000000ULL)
+    {
+        cpu_us_per_s_ = static_cast<uint32_t>(busy_us_ * 1000000ULL / (t1 - window_us_));
+        busy_us_ = 0;
+        window_us_ = t1;
+    }
+
+    if (n > 0)
+    {
+        ImuSnapshot s{};
+        s.pitch_deg = filter_.pitch_deg();
+        s.roll_deg = filter_.roll_deg();
+        s.tilt_deg = filter_.tilt_deg();
+        s.yaw_rate_dps = yaw / static_cast<float>(n);
+        s.tipped = filter_.primed() && s.tilt_deg > cfg::imu::TIP_DEG;
+        s.batch = static_cast<uint16_t>(n);
+        s.overflows = src_->overflows();
+        s.cpu_us_per_s = cpu_us_per_s_;
+        s.valid = filter_.primed();
+        s.stamp_us = t1;
+        bus_->publish(s);
+    }
+}
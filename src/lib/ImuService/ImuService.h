@@ -0,0 +1,75 @@
+/**
+ * MIT License
+ *
+ * @brief IMU service: drains the sensor FIFO in batches, filters attitude, publishes it.
+ *
+ * @file ImuService.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <array>
+#include <ImuBus.h>
+#include <Attitude.h>
+#include <ImuSources/ImuSources.h>
+
+/**
+ * @brief Wakes every PERIOD_MS, takes whatever the source has buffered, and
+ *        publishes one attitude snapshot per wake-up.
+ *
+ * Sampling is paced by the sensor, not by this task, so the sample rate only
+ * changes how many samples each drain carries. Busy time is measured around
+ * the drain + filter and reported per second in the snapshot; it includes time
+ * spent waiting on the I²C transfer, so it is an upper bound on CPU cost.
+ */
+class ImuService
+{
+public:
+    /**
+     * @brief Construct with source and output bus.
+     *
+     * @param source Sample source (non-owning).
+     * @param bus Attitude bus (non-owning).
+     * @param period_ms Drain period (milliseconds).
+     */
+    ImuService(IImuSource &source, ImuBus &bus, uint32_t period_ms = cfg::imu::PERIOD_MS) noexcept
+        : src_(&source), bus_(&bus), loop_ticks_(to_ticks_ms(period_ms)) {}
+
+    /**
+     * @brief Bring the source up (call once before the task starts).
+     * @return false if the sensor did not answer.
+     */
+    bool begin() noexcept;
+
+    /**
+     * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
+     */
+    static inline void task(void *self) noexcept
+    {
+        static_cast<ImuService *>(self)->run();
+    }
+
+    /**
+     * @brief One drain: take the buffered samples, filter, publish one ImuSnapshot.
+     * @note run() calls this every period; the host simulator calls it directly.
+     */
+    void step() noexcept;
+
+private:
+    /// @brief Main run loop.
+    void run() noexcept;
+
+    // ---- Internal state ---- //
+    IImuSource *src_{nullptr};                                ///< Non-owning sample source.
+    ImuBus *bus_{nullptr};                                    ///< Non-owning output bus.
+    TickType_t loop_ticks_{0};                                ///< Delay (in ticks) between drains.
+    ctl::ComplementaryFilter filter_{};                       ///< Attitude estimate.
+    std::array<ctl::ImuSample, cfg::imu::MAX_BATCH> batch_{}; ///< Drain buffer.
+    uint64_t busy_us_{0};                                     ///< Busy time in the current window.
+    uint64_t window_us_{0};                                   ///< Start of the current one-second window.
+    uint32_t cpu_us_per_s_{0};                                ///< Busy time over the last full window.
+};
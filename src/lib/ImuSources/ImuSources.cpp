@@ -0,0 +1,188 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of the IMU sample sources.
+ *
+ * @file ImuSources.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "ImuSources.h"
+#include <cmath>
+
+namespace
+{
+    // MPU-6050 registers.
+    constexpr uint8_t kRegSmplrtDiv = 0x19;
+    constexpr uint8_t kRegConfig = 0x1A;
+    constexpr uint8_t kRegGyroConfig = 0x1B;
+    constexpr uint8_t kRegAccelConfig = 0x1C;
+    constexpr uint8_t kRegFifoEn = 0x23;
+    constexpr uint8_t kRegIntStatus = 0x3A;
+    constexpr uint8_t kRegUserCtrl = 0x6A;
+    constexpr uint8_t kRegPwrMgmt1 = 0x6B;
+    constexpr uint8_t kRegFifoCountH = 0x72;
+    constexpr uint8_t kRegFifoRw = 0x74;
+    constexpr uint8_t kRegWhoAmI = 0x75;
+
+    constexpr uint8_t kFifoAccelGyro = 0x78;   ///< FIFO_EN: XG, YG, ZG, ACCEL.
+    constexpr uint8_t kUserFifoEn = 0x40;      ///< USER_CTRL: FIFO on.
+    constexpr uint8_t kUserFifoReset = 0x04;   ///< USER_CTRL: FIFO reset.
+    constexpr uint8_t kIntFifoOverflow = 0x10; ///< INT_STATUS: FIFO overflowed.
+}
+
+// ---- Mpu6050Fifo ---- //
+
+// Wake the sensor, set ranges/rate/filter, start the FIFO.
+bool Mpu6050Fifo::begin() noexcept
+{
+    wire_->begin(cfg::imu::SDA_PIN, cfg::imu::SCL_PIN, cfg::imu::I2C_HZ);
+
+    uint8_t who = 0;
+    if (!read_regs(kRegWhoAmI, &who, 1) || who != 0x68)
+        return false; ///< WHO_AM_I is 0x68 whatever AD0 is strapped to.
+
+    write_reg(kRegPwrMgmt1, 0x80); ///< Device reset.
+    delay(100);
+    write_reg(kRegPwrMgmt1, 0x01); ///< Awake, clocked from the X gyro PLL.
+
+    // 1 kHz internal rate with the DLPF on; pick a bandwidth under Nyquist for the output rate.
+    const uint16_t req = (rate_hz_ == 0) ? 1 : ((rate_hz_ > 1000) ? 1000 : rate_hz_);
+    const uint8_t div = static_cast<uint8_t>((1000 + req / 2) / req - 1);
+    hz_ = 1000.0f / static_cast<float>(div + 1);
+    const uint8_t dlpf = (hz_ >= 400.0f) ? 2 : ((hz_ >= 200.0f) ? 3 : ((hz_ >= 100.0f) ? 4 : 5)); ///< 94/44/21/10 Hz.
+
+    write_reg(kRegConfig, dlpf);
+    write_reg(kRegSmplrtDiv, div);
+    write_reg(kRegGyroConfig, 0x08);  ///< ±500 °/s.
+    write_reg(kRegAccelConfig, 0x08); ///< ±4 g.
+
+    write_reg(kRegUserCtrl, kUserFifoReset);
+    write_reg(kRegUserCtrl, kUserFifoEn);
+    return write_reg(kRegFifoEn, kFifoAccelGyro);
+}
+
+// Drain whole frames from the FIFO.
+size_t Mpu6050Fifo::read_batch(ctl::ImuSample *out, size_t max) noexcept
+{
+    uint8_t status = 0;
+    if (!read_regs(kRegIntStatus, &status, 1))
+        return 0;
+    if (status & kIntFifoOverflow)
+    {
+        ++overflows_; ///< Frame alignment is gone: restart clean.
+        write_reg(kRegUserCtrl, kUserFifoReset | kUserFifoEn);
+        return 0;
+    }
+
+    uint8_t cnt[2] = {0, 0};
+    if (!read_regs(kRegFifoCountH, cnt, 2))
+        return 0;
+    size_t frames = ((static_cast<size_t>(cnt[0]) << 8) | cnt[1]) / kFrame;
+    frames = (frames < max) ? frames : max;
+
+    uint8_t buf[kChunkFrames * kFrame];
+    size_t done = 0;
+    while (done < frames)
+    {
+        const size_t n = (frames - done < kChunkFrames) ? frames - done : kChunkFrames;
+        if (!read_regs(kRegFifoRw, buf, n * kFrame))
+            break;
+        for (size_t i = 0; i < n; ++i)
+            out[done + i] = decode(buf + i * kFrame);
+        done += n;
+    }
+    return done;
+}
+
+// One FIFO frame → sample.
+ctl::ImuSample Mpu6050Fifo::decode(const uint8_t *p) noexcept
+{
+    auto be16 = [p](size_t i)
+    { return static_cast<float>(static_cast<int16_t>((p[i] << 8) | p[i + 1])); };
+
+    ctl::ImuSample s{};
+    s.ax = be16(0) / kAccelLsbPerG;
+    s.ay = be16(2) / kAccelLsbPerG;
+    s.az = be16(4) / kAccelLsbPerG;
+    s.gx = be16(6) / kGyroLsbPerDps;
+    s.gy = be16(8) / kGyroLsbPerDps;
+    s.gz = be16(10) / kGyroLsbPerDps;
+    return s;
+}
+
+// Single register write.
+bool Mpu6050Fifo::write_reg(uint8_t reg, uint8_t v) noexcept
+{
+    wire_->beginTransmission(addr_);
+    wire_->write(reg);
+    wire_->write(v);
+    return wire_->endTransmission() == 0;
+}
+
+// Burst read from reg (auto-increment; FIFO_R_W keeps popping).
+bool Mpu6050Fifo::read_regs(uint8_t reg, uint8_t *buf, size_t n) noexcept
+{
+    wire_->beginTransmission(addr_);
+    wire_->write(reg);
+    if (wire_->endTransmission(/*sendStop=*/false) != 0)
+        return false;
+    if (wire_->requestFrom(addr_, n) != n)
+        return false;
+    return wire_->readBytes(buf, n) == n;
+}
+
+// ---- FakeImu ---- //
+
+// Start the clock.
+bool FakeImu::begin() noexcept
+{
+    next_us_ = now_us();
+    return true;
+}
+
+// Hand out the samples that "arrived" since the last call.
+size_t FakeImu::read_batch(ctl::ImuSample *out, size_t max) noexcept
+{
+    const uint64_t now = now_us();
+    const float period_us = 1e6f / hz_;
+    if (now < next_us_)
+        return 0;
+
+    size_t due = static_cast<size_t>(static_cast<float>(now - next_us_) / period_us) + 1;
+    if (due > kFifoFrames)
+    {
+        ++overflows_; ///< Read too late: a real FIFO would have lost frames too.
+        next_us_ = now;
+        return 0;
+    }
+    due = (due < max) ? due : max;
+
+    constexpr float kRad = 3.14159265f / 180.0f;
+    const float p = pitch_deg_ * kRad;
+    const float r = roll_deg_ * kRad;
+    const float up_x = sinf(p); ///< Gravity reaction in body axes.
+    const float up_y = cosf(p) * sinf(r);
+    const float up_z = cosf(p) * cosf(r);
+    for (size_t i = 0; i < due; ++i)
+    {
+        ctl::ImuSample &s = out[i];
+        s.ax = up_x + noise(0.01f);
+        s.ay = up_y + noise(0.01f);
+        s.az = up_z + noise(0.01f);
+        s.gx = noise(0.2f);
+        s.gy = noise(0.2f);
+        s.gz = noise(0.2f);
+    }
+    next_us_ += static_cast<uint64_t>(static_cast<float>(due) * period_us);
+    return due;
+}
+
+// Uniform noise in ±amplitude.
+float FakeImu::noise(float amplitude) noexcept
+{
+    seed_ = seed_ * 1664525u + 1013904223u;
+    return amplitude * (static_cast<float>(seed_ >> 8) / 8388608.0f - 1.0f);
+}
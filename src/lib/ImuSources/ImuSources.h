@@ -0,0 +1,139 @@
+/**
+ * MIT License
+ *
+ * @brief IMU sample sources: IImuSource interface, MPU-6050 FIFO reader and a synthetic IMU.
+ *
+ * @file ImuSources.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <cstdint>
+#include <cstddef>
+#include <Wire.h>
+#include <Attitude.h>
+
+/**
+ * @brief Anything that buffers IMU samples and hands them over in batches.
+ */
+class IImuSource
+{
+public:
+    virtual ~IImuSource() = default;
+
+    /**
+     * @brief Bring the sensor up (call once before the first read_batch()).
+     * @return false if the sensor did not answer.
+     */
+    virtual bool begin() noexcept = 0;
+
+    /**
+     * @brief Move buffered samples out, oldest first.
+     *
+     * @param out Destination.
+     * @param max Capacity of out.
+     * @return Samples written (the rest stay buffered for the next call).
+     */
+    virtual size_t read_batch(ctl::ImuSample *out, size_t max) noexcept = 0;
+
+    /// @brief Actual sample rate (Hz); samples are evenly spaced at 1/sample_hz().
+    [[nodiscard]] virtual float sample_hz() const noexcept = 0;
+
+    /// @brief Times the buffer overflowed and samples were lost.
+    [[nodiscard]] virtual uint32_t overflows() const noexcept { return 0; }
+};
+
+/**
+ * @brief MPU-6050 with its 1 KB FIFO collecting accel + gyro at the sample rate.
+ *
+ * The sensor paces itself; the host wakes every few tens of milliseconds and
+ * pulls everything in a handful of burst reads (one status, one count, then
+ * FIFO data in Wire-buffer-sized chunks) instead of one transaction per sample.
+ * Mount with x forward, y left, z up, or remap in decode().
+ */
+class Mpu6050Fifo : public IImuSource
+{
+public:
+    /**
+     * @brief Construct with bus, address and rate.
+     *
+     * @param wire I²C bus (begun here with cfg::imu pins and clock).
+     * @param addr 7-bit address.
+     * @param rate_hz Requested rate; the sensor divides 1 kHz, so e.g. 400 → 333 Hz.
+     */
+    explicit Mpu6050Fifo(TwoWire &wire = Wire, uint8_t addr = cfg::imu::ADDR,
+                         uint16_t rate_hz = cfg::imu::RATE_HZ) noexcept
+        : wire_(&wire), addr_(addr), rate_hz_(rate_hz) {}
+
+    bool begin() noexcept override;
+    size_t read_batch(ctl::ImuSample *out, size_t max) noexcept override;
+    [[nodiscard]] float sample_hz() const noexcept override { return hz_; }
+    [[nodiscard]] uint32_t overflows() const noexcept override { return overflows_; }
+
+private:
+    bool write_reg(uint8_t reg, uint8_t v) noexcept;
+    bool read_regs(uint8_t reg, uint8_t *buf, size_t n) noexcept;
+    static ctl::ImuSample decode(const uint8_t *p) noexcept;
+
+    static constexpr size_t kFrame = 12;           ///< Accel xyz + gyro xyz, big-endian int16.
+    static constexpr size_t kChunkFrames = 10;     ///< Frames per read (Wire buffer is 128 bytes).
+    static constexpr float kAccelLsbPerG = 8192;   ///< ±4 g range.
+    static constexpr float kGyroLsbPerDps = 65.5f; ///< ±500 °/s range.
+
+    TwoWire *wire_{nullptr}; ///< Non-owning I²C bus.
+    uint8_t addr_{0};        ///< 7-bit address.
+    uint16_t rate_hz_{0};    ///< Requested rate.
+    float hz_{0.0f};         ///< Rate actually configured.
+    uint32_t overflows_{0};  ///< FIFO overflows seen.
+};
+
+/**
+ * @brief Synthetic IMU: gravity for a set attitude plus a little noise, at a fixed rate.
+ *
+ * Samples "accumulate" with time exactly like a FIFO (including overflow past
+ * 85 samples), so ImuService runs unchanged without a sensor fitted.
+ */
+class FakeImu : public IImuSource
+{
+public:
+    /**
+     * @brief Construct with rate.
+     *
+     * @param rate_hz Sample rate (Hz).
+     */
+    explicit FakeImu(uint16_t rate_hz = cfg::imu::RATE_HZ) noexcept : hz_(static_cast<float>(rate_hz)) {}
+
+    bool begin() noexcept override;
+    size_t read_batch(ctl::ImuSample *out, size_t max) noexcept override;
+    [[nodiscard]] float sample_hz() const noexcept override { return hz_; }
+    [[nodiscard]] uint32_t overflows() const noexcept override { return overflows_; }
+
+    /**
+     * @brief Attitude the synthetic gravity vector represents.
+     *
+     * @param pitch_deg Nose-up positive.
+     * @param roll_deg Right-side-down positive.
+     */
+    void set_attitude(float pitch_deg, float roll_deg) noexcept
+    {
+        pitch_deg_ = pitch_deg;
+        roll_deg_ = roll_deg;
+    }
+
+private:
+    /// @brief Small zero-mean noise (LCG; deterministic run to run).
+    float noise(float amplitude) noexcept;
+
+    static constexpr size_t kFifoFrames = 85; ///< Same depth as the MPU-6050 FIFO.
+
+    float hz_{0.0f};                 ///< Sample rate.
+    uint64_t next_us_{0};            ///< Time of the next sample to hand out.
+    uint32_t overflows_{0};          ///< Simulated FIFO overflows.
+    uint32_t seed_{0x1234567u};      ///< Noise state.
+    volatile float pitch_deg_{0.0f}; ///< Scenario pitch.
+    volatile float roll_deg_{0.0f};  ///< Scenario roll.
+};
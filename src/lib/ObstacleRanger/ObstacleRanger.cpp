@@ -0,0 +1,98 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of UltrasonicRanger (obstacle distance).
+ *
+ * @file ObstacleRanger.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "ObstacleRanger.h"
+
+// RMT for the trigger, MCPWM capture on both echo edges.
+void UltrasonicRanger::begin() noexcept
+{
+    rmt_config_t tx = RMT_DEFAULT_CONFIG_TX(static_cast<gpio_num_t>(trig_), kTrigChannel);
+    tx.clk_div = 80; ///< 1 µs per RMT tick.
+    configASSERT(rmt_config(&tx) == ESP_OK);
+    configASSERT(rmt_driver_install(kTrigChannel, 0, 0) == ESP_OK);
+
+    pulse_.level0 = 1;
+    pulse_.duration0 = 10; ///< ≥ 10 µs high starts a measurement.
+    pulse_.level1 = 0;
+    pulse_.duration1 = 1;
+
+    configASSERT(mcpwm_gpio_init(kCapUnit, MCPWM_CAP_0, echo_) == ESP_OK);
+    mcpwm_capture_config_t c{};
+    c.cap_edge = MCPWM_BOTH_EDGE;
+    c.cap_prescale = 1;
+    c.capture_cb = on_capture;
+    c.user_data = this;
+    configASSERT(mcpwm_capture_enable_channel(kCapUnit, MCPWM_SELECT_CAP0, &c) == ESP_OK);
+}
+
+// Capture ISR.
+bool IRAM_ATTR UltrasonicRanger::on_capture(mcpwm_unit_t, mcpwm_capture_channel_id_t, const cap_event_data_t *e,
+                                            void *self)
+{
+    auto *r = static_cast<UltrasonicRanger *>(self);
+    if (e->cap_edge == MCPWM_POS_EDGE)
+    {
+        r->rise_ = e->cap_value;
+        return false;
+    }
+    if (!r->armed_)
+        return false; ///< Late echo from a ping we already gave up on.
+
+    r->width_ = e->cap_value - r->rise_; ///< Wraps correctly in uint32.
+    r->fall_us_ = now_us();
+    r->armed_ = false;
+
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(r->task_, &woken);
+    return woken == pdTRUE;
+}
+
+// Main run loop.
+void UltrasonicRanger::run() noexcept
+{
+    configASSERT(bus_ != nullptr); ///< Sanity check: bus_ must be valid.
+    configASSERT(loop_ticks_ > 0); ///< Timing must be configured.
+
+    task_ = xTaskGetCurrentTaskHandle();
+
+    // Round trip for MAX_RANGE_M, plus a tick of slack; past that the path is clear.
+    const uint32_t flight_ms = static_cast<uint32_t>(2000.0f * cfg::obstacle::MAX_RANGE_M / cfg::obstacle::SOUND_MPS) + 2;
+    const TickType_t wait = to_ticks_ms(flight_ms);
+
+    TickType_t last_wake = xTaskGetTickCount();
+
+    for (;;)
+    {
+        ulTaskNotifyTake(pdTRUE, 0); ///< Drop any stale notification.
+        armed_ = true;
+        rmt_write_items(kTrigChannel, &pulse_, 1, /*wait_tx_done=*/false);
+
+        const bool echo = ulTaskNotifyTake(pdTRUE, wait) > 0;
+        armed_ = false;
+
+        ObstacleSnapshot s{};
+        s.seq = ++seq_;
+        s.valid = true;
+        s.distance_m = cfg::obstacle::MAX_RANGE_M;
+        s.stamp_us = now_us();
+        if (echo)
+        {
+            const float us = static_cast<float>(width_) * (1e6f / static_cast<float>(kCapHz));
+            const float d = us * 1e-6f * cfg::obstacle::SOUND_MPS * 0.5f;
+            s.clear = d >= cfg::obstacle::MAX_RANGE_M;
+            s.distance_m = s.clear ? cfg::obstacle::MAX_RANGE_M : d;
+            s.stamp_us = fall_us_;
+        }
+        bus_->publish(s);
+
+        vTaskDelayUntil(&last_wake, loop_ticks_);
+    }
+}
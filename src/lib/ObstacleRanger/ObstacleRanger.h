@@ -0,0 +1,81 @@
+/**
+ * MIT License
+ *
+ * @brief Ultrasonic obstacle ranger: RMT trigger, MCPWM-captured echo, no busy-waiting.
+ *
+ * @file ObstacleRanger.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <driver/rmt.h>
+#include <driver/mcpwm.h>
+#include <ObstacleBus.h>
+
+/**
+ * @brief Pings an HC-SR04 style sensor every PERIOD_MS and publishes the distance.
+ *
+ * The 10 µs trigger is an RMT item, and the echo's two edges are latched by an
+ * MCPWM capture channel in hardware. The falling-edge interrupt stores the
+ * pulse width and notifies the task, which sleeps on the notification (bounded
+ * by the flight time of MAX_RANGE_M) and publishes at once. The reading lands
+ * on the bus tens of microseconds after the echo ends, whatever the range.
+ */
+class UltrasonicRanger
+{
+public:
+    /**
+     * @brief Construct with output bus and pins.
+     *
+     * @param bus Obstacle bus (non-owning).
+     * @param trig Trigger output GPIO.
+     * @param echo Echo input GPIO.
+     * @param period_ms Ping period (milliseconds).
+     */
+    explicit UltrasonicRanger(ObstacleBus &bus, int trig = cfg::obstacle::TRIG_PIN, int echo = cfg::obstacle::ECHO_PIN,
+                              uint32_t period_ms = cfg::obstacle::PERIOD_MS) noexcept
+        : bus_(&bus), trig_(trig), echo_(echo), loop_ticks_(to_ticks_ms(period_ms)) {}
+
+    /**
+     * @brief Set up the RMT trigger channel and the capture channel (call once before the task starts).
+     */
+    void begin() noexcept;
+
+    /**
+     * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
+     */
+    static inline void task(void *self) noexcept
+    {
+        static_cast<UltrasonicRanger *>(self)->run();
+    }
+
+private:
+    /// @brief Main run loop.
+    void run() noexcept;
+
+    /// @brief Capture ISR: rising edge → start, falling edge → width + notify.
+    static bool IRAM_ATTR on_capture(mcpwm_unit_t unit, mcpwm_capture_channel_id_t ch, const cap_event_data_t *e,
+                                     void *self);
+
+    static constexpr uint32_t kCapHz = 80000000;                 ///< Capture timer runs from APB.
+    static constexpr rmt_channel_t kTrigChannel = RMT_CHANNEL_0; ///< RMT TX channel for the trigger.
+    static constexpr mcpwm_unit_t kCapUnit = MCPWM_UNIT_1;       ///< Unit 0 drives the motors (cfg::motor::MCPWM_UNIT).
+    static_assert(static_cast<int>(kCapUnit) != cfg::motor::MCPWM_UNIT, "Echo capture needs the unit the motors leave free.");
+
+    // ---- Internal state ---- //
+    ObstacleBus *bus_{nullptr};    ///< Non-owning output bus.
+    int trig_{-1};                 ///< Trigger GPIO.
+    int echo_{-1};                 ///< Echo GPIO.
+    TickType_t loop_ticks_{0};     ///< Delay (in ticks) between pings.
+    TaskHandle_t task_{nullptr};   ///< Task the ISR notifies.
+    rmt_item32_t pulse_{};         ///< Trigger pulse.
+    volatile bool armed_{false};   ///< A ping is in flight (ISR reports its falling edge).
+    volatile uint32_t rise_{0};    ///< Capture count at the echo's rising edge.
+    volatile uint32_t width_{0};   ///< Echo width (capture counts).
+    volatile uint64_t fall_us_{0}; ///< When the echo ended (µs since boot).
+    uint32_t seq_{0};              ///< Ping counter.
+};
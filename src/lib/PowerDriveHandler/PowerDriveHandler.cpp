@@ -11,39 +11,503 @@
 
 #include "PowerDriveHandler.h"
 
+// Construct with several motors.
+PowerDriveHandler::PowerDriveHandler(const Wheel *wheels, size_t count, ControlBus &bus, MotorStateBus &state,
+                                     uint32_t period_ms) noexcept
+    : bus_(&bus), state_(&state), loop_ticks_(to_ticks_ms(period_ms))
+{
+    count_ = (count < kMaxMotors) ? count : kMaxMotors;
+    for (size_t i = 0; i < count_; ++i)
+        wheels_[i] = wheels[i];
+}
+
+// Attach a wheel-speed sensor and prime the speed PID.
+void PowerDriveHandler::attach_speed_sensor(ISpeedSensor &sensor) noexcept
+{
+    speed_ = &sensor;
+
+    ctl::PidGains g{cfg::speed::KP, cfg::speed::KI, cfg::speed::KD, cfg::speed::KFF};
+    if (gain_store_.load(g))
+        debugfln("Speed PID from NVS: kp=%.3f ki=%.3f kff=%.3f", g.kp, g.ki, g.kff);
+
+    pid_.set_gains(g);
+    pid_.set_limits(kMinPct, kMaxPct);
+    pid_.set_integrator_band(cfg::speed::I_BAND_RPM);
+    pid_.reset();
+}
+
+// Relay autotune mode.
+bool PowerDriveHandler::autotune(bool requested, float rpm, float dt_sec, float &out) noexcept
+{
+    const bool rising = requested && !tune_req_prev_;
+    tune_req_prev_ = requested;
+
+    if (rising)
+    {
+        ctl::RelaySpec s{};
+        s.setpoint = cfg::speed::TUNE_SP_PCT * (cfg::speed::MAX_RPM / kMaxPct);
+        s.bias = pid_.gains().kff * s.setpoint; ///< Current feed-forward is the best bias guess.
+        s.amplitude = cfg::speed::TUNE_RELAY_PCT;
+        s.hysteresis = cfg::speed::TUNE_HYST_RPM;
+        s.timeout_s = cfg::speed::TUNE_TIMEOUT_S;
+        s.out_lo = kMinPct;
+        s.out_hi = kMaxPct;
+        tune_.start(s);
+        record(Event::AutotuneStarted, s.setpoint, s.amplitude);
+    }
+
+    if (tune_.state() != ctl::RelayAutotune::State::Running)
+        return false;
+
+    if (!requested)
+    {
+        tune_.abort(); ///< Dead-man: releasing the switch (or a pedal) stops the experiment.
+        record(Event::AutotuneAborted, rpm);
+        return false;
+    }
+
+    out = tune_.step(rpm, dt_sec);
+
+    if (tune_.state() == ctl::RelayAutotune::State::Done)
+    {
+        const ctl::PidGains g = tune_.result();
+        pid_.set_gains(g);
+        pid_.reset();
+        if (tune_bus_ != nullptr)
+        {
+            TuneSnapshot t = tune_bus_->peek();
+            t.gains = g;
+            t.ku = tune_.ku();
+            t.tu_s = tune_.tu_s();
+            ++t.seq;
+            t.stamp_us = now_us();
+            tune_bus_->publish(t); ///< GainSaver writes NVS off this task.
+        }
+        record(Event::AutotuneDone, tune_.ku(), tune_.tu_s()); ///< GainSaver prints the gains it stores.
+    }
+    else if (tune_.state() == ctl::RelayAutotune::State::Failed)
+    {
+        record(Event::AutotuneFailed);
+    }
+    return true;
+}
+
+// Edge event for EventLogger.
+void PowerDriveHandler::record(Event e, float v0, float v1, uint32_t latency_us) noexcept
+{
+    if (events_ != nullptr)
+        record_event((*events_)[e], now_us(), latency_us, v0, v1);
+}
+
+// Closed-loop speed step.
+float PowerDriveHandler::speed_loop(float target_pct, float rpm, bool braking, float dt_sec) noexcept
+{
+    // The setpoint carries the ramp, so the PID never winds up chasing a step.
+    const float up = accel_pct_s_ * dt_sec; ///< Drive mode sets the pull-away.
+    const float down = (braking ? kBrakeRatePctPerSec : decel_pct_s_) * dt_sec;
+    sp_pct_ = (sp_pct_ < target_pct) ? fminf(sp_pct_ + up, target_pct) : fmaxf(sp_pct_ - down, target_pct);
+
+    if (sp_pct_ <= kMinPct)
+    {
+        pid_.reset();
+        return kMinPct; ///< Stop request: duty ramp/brake takes it to zero.
+    }
+
+    const float sp_rpm = sp_pct_ * (cfg::speed::MAX_RPM / kMaxPct);
+    return pid_.step(sp_rpm, rpm, dt_sec);
+}
+
+// Traction inner step.
+void PowerDriveHandler::traction_step(float dt_sec, bool write) noexcept
+{
+    float peak = kMinPct;
+    for (size_t i = 0; i < count_; ++i)
+        peak = fmaxf(peak, duty_base_[i]);
+
+    const float s = traction_.step(speed_->read_counts(), peak * tc_scale_ / kMaxPct, dt_sec);
+    const bool moved = fabsf(s - tc_scale_) > 0.005f;
+    tc_scale_ = s;
+
+    if (write && moved)
+    {
+        for (size_t i = 0; i < count_; ++i)
+            wheels_[i].motor->setSpeedPercent(duty_base_[i] * s, dir_);
+    }
+}
+
+// Inner steps between two outer ticks.
+void PowerDriveHandler::traction_substeps(TickType_t &last_wake, TickType_t sub_ticks, float sub_dt_sec) noexcept
+{
+    TickType_t elapsed = 0;
+    while (elapsed + sub_ticks < loop_ticks_)
+    {
+        vTaskDelayUntil(&last_wake, sub_ticks);
+        elapsed += sub_ticks;
+        traction_step(sub_dt_sec, /*write=*/true);
+    }
+    vTaskDelayUntil(&last_wake, loop_ticks_ - elapsed); ///< Land exactly on the next outer tick.
+}
+
+// Hill-hold step.
+bool PowerDriveHandler::hill_hold(bool zero_cmd, float dt_sec, float &out) noexcept
+{
+    speed_->read_counts(); ///< Fresh position: detection latency is this tick, not the last.
+    const int32_t pos = speed_->position();
+    const int32_t moved = pos - hill_pos_;
+    hill_pos_ = pos;
+
+    if (!zero_cmd)
+    {
+        if (hill_.holding())
+            pid_.reset(hill_.hold_pct()); ///< Closed loop starts from the holding duty: no dip on launch.
+        hill_.disarm();
+        return false;
+    }
+
+    if (hill_.state() == ctl::HillHold::State::Off)
+        hill_.arm();
+
+    float applied = kMinPct;
+    for (size_t i = 0; i < count_; ++i)
+        applied = fmaxf(applied, current_pct_[i]);
+
+    const int32_t back = (dir_ == kForward) ? -moved : moved; ///< Against the travel direction.
+    out = hill_.step(back, applied, dt_sec);
+    return hill_.holding();
+}
+
+// Differential mix.
+void PowerDriveHandler::mix(float throttle_pct, float steer_pct, float *out) const noexcept
+{
+    const float s = fminf(fmaxf(steer_pct / 100.0f, -1.0f), 1.0f) * kSteerMix;
+
+    // Outer wheel keeps throttle, inner wheel slows (steer right → right wheel is inner).
+    const float left = (s < 0.0f) ? throttle_pct * (1.0f + s) : throttle_pct;
+    const float right = (s > 0.0f) ? throttle_pct * (1.0f - s) : throttle_pct;
+
+    for (size_t i = 0; i < count_; ++i)
+    {
+        switch (wheels_[i].side)
+        {
+        case Side::Left:
+            out[i] = left;
+            break;
+        case Side::Right:
+            out[i] = right;
+            break;
+        case Side::Both:
+        default:
+            out[i] = throttle_pct;
+            break;
+        }
+    }
+}
+
+// One-time setup before the first step().
+void PowerDriveHandler::begin() noexcept
+{
+    configASSERT(count_ > 0 && bus_ != nullptr && state_ != nullptr); ///< Sanity check: motors, bus_ and state_ must be valid.
+    configASSERT(loop_ticks_ > 0);                                    ///< Timing must be configured.
+
+    dt_sec_ = (static_cast<float>(loop_ticks_) * static_cast<float>(portTICK_PERIOD_MS)) / 1000.0f;
+
+    motor_heat_.configure(kMotorHeat, dt_sec_);
+    driver_heat_.configure(kDriverHeat, dt_sec_);
+    pwm_policy_.configure(kPwmFreq);
+    if (pwm_ != nullptr)
+        pwm_hz_ = cfg::motor::PWM_LOW_DUTY_HZ; ///< Motor is set up at this carrier (main.cpp).
+
+    // Traction runs on inner steps between outer ticks: a cut never waits for the next LOOP_MS, though
+    // spotting the slip takes about two count windows.
+    sub_ticks_ = to_ticks_ms(cfg::traction::SUBSTEP_MS);
+    sub_dt_sec_ = (static_cast<float>(sub_ticks_) * static_cast<float>(portTICK_PERIOD_MS)) / 1000.0f;
+    traction_on_ = features_.traction && speed_ != nullptr && sub_ticks_ > 0 && sub_ticks_ < loop_ticks_;
+    ctl::TractionSpec tc = kTraction;
+    if (speed_ != nullptr)
+        tc.counts_per_rev = speed_->counts_per_rev();
+    traction_.configure(tc);
+
+    // Hill-hold needs to know which way the wheel turned: overshoot must not look like rollback.
+    hill_on_ = features_.hill_hold && speed_ != nullptr && speed_->has_direction();
+    hill_.configure(kHillHold);
+    if (hill_on_)
+        hill_pos_ = speed_->position();
+}
+
+// Inner steps between two ticks this tick.
+uint32_t PowerDriveHandler::inner_steps() const noexcept
+{
+    return tc_active_ ? static_cast<uint32_t>((loop_ticks_ - 1) / sub_ticks_) : 0; ///< Same count traction_substeps() runs.
+}
+
 // Main run loop.
 void PowerDriveHandler::run() noexcept
 {
-    configASSERT(motor_ != nullptr && bus_ != nullptr); ///< Sanity check: motor_ and bus_ must be valid.
-    configASSERT(loop_ticks_ > 0);                      ///< Timing must be configured.
+    begin();
 
     TickType_t last_wake = xTaskGetTickCount(); ///< Reference tick for periodic task scheduling.
 
     for (;;)
     {
-        const ControlSnapshot cur = bus_->peek();
+        step();
+
+        if (tc_active_)
+            traction_substeps(last_wake, sub_ticks_, sub_dt_sec_);
+        else
+            vTaskDelayUntil(&last_wake, loop_ticks_); ///< Pace loop.
+    }
+}
+
+// One drive tick.
+void PowerDriveHandler::step() noexcept
+{
+    const trace::Span span(trace::Track::PDHandler);
+    ControlSnapshot cur = bus_->peek();
+
+    MotorStateSnapshot st{};
+    st.phase = MotorStateSnapshot::RampPhase::Cruising;
+
+    // Stale command (input or control task stopped publishing): release everything and brake down.
+    const uint32_t age_ms = static_cast<uint32_t>(now_us() / 1000ULL) - cur.stamp_ms;
+    if (age_ms > cfg::tick::CMD_STALE_MS)
+    {
+        cur.throttle_cmd_pct = kMinPct;
+        cur.brake_cmd = true;
+        cur.autotune_cmd = false;
+        st.limits |= MotorStateSnapshot::kLimitStale;
+    }
+
+    // Target selection.
+    float targetPct = fminf(fmaxf(cur.throttle_cmd_pct, kMinPct), kMaxPct); ///< Clamp to avoid nonsense values.
+    if (targetPct != cur.throttle_cmd_pct)
+        st.limits |= MotorStateSnapshot::kLimitCmdClamp;
+
+    // Drive mode / power knob ceiling and pull-away rate (table lookups upstream, just a min here).
+    if (targetPct > cur.max_pct)
+    {
+        targetPct = fmaxf(cur.max_pct, kMinPct);
+        st.limits |= MotorStateSnapshot::kLimitMode;
+    }
+    accel_pct_s_ = (cur.accel_pct_s > 0.0f) ? cur.accel_pct_s : kRampRatePctPerSec;
+    decel_pct_s_ = (cur.decel_pct_s > 0.0f) ? cur.decel_pct_s : kRampRatePctPerSec;
+
+    bool stopped = true;
+    for (size_t i = 0; i < count_; ++i)
+        stopped = stopped && current_pct_[i] <= kMinPct;
+
+    // ---- Direction sequencing: ramp to zero → dead time → flip ---- //
+    const Dir wantDir = (cur.dir_cmd == ControlSnapshot::Direction::Reverse) ? kReverse : kForward;
+    bool braking = cur.brake_cmd;
+
+    switch (seq_)
+    {
+    case DirSeq::Drive:
+        if (wantDir != dir_)
+            seq_ = DirSeq::Stopping; ///< Start a reversal next tick.
+        break;
+
+    case DirSeq::Stopping:
+        if (wantDir == dir_)
+            seq_ = DirSeq::Drive; ///< Request withdrawn before we stopped.
+        else if (stopped)
+        {
+            seq_ = DirSeq::DeadTime;
+            dead_left_s_ = kDeadTimeSec;
+        }
+        break;
+
+    case DirSeq::DeadTime:
+        dead_left_s_ -= dt_sec_;
+        if (dead_left_s_ <= 0.0f)
+        {
+            dir_ = wantDir; ///< Safe to flip: output has sat at 0 % for the dead time.
+            seq_ = DirSeq::Drive;
+        }
+        break;
+    }
+
+    if (seq_ != DirSeq::Drive)
+    {
+        targetPct = kMinPct; ///< Never drive through a reversal.
+        braking = true;
+    }
+
+    // ---- Battery: low-voltage cap on the command, compensation at the output ---- //
+    float volts = 0.0f; ///< 0 → no fresh reading, pass duty through.
+    if (battery_ != nullptr)
+    {
+        const BatterySnapshot bat = battery_->peek();
+        if (bat.valid && now_us() - bat.stamp_us < static_cast<uint64_t>(cfg::battery::STALE_MS) * 1000ULL)
+            volts = bat.volts;
+    }
+
+    const float capPct = ctl::low_voltage_cap_pct(volts, kVoltageComp);
+    if (targetPct > capPct)
+    {
+        targetPct = capPct;
+        st.limits |= MotorStateSnapshot::kLimitLowVoltage;
+    }
+
+    // Thermal derate from last tick's estimate; the band makes it a smooth squeeze, not a cut.
+    const float heatCap = fminf(motor_heat_.cap_pct(cfg::thermal::AMBIENT_C),
+                                driver_heat_.cap_pct(cfg::thermal::AMBIENT_C));
+    if (targetPct > heatCap)
+    {
+        targetPct = heatCap;
+        st.limits |= MotorStateSnapshot::kLimitThermal;
+    }
+
+    // ---- Obstacle guard: cap falls with distance; inside the stopping distance, straight to the brake ---- //
+    bool obstacleStop = false;
+    const ObstacleSnapshot ob = obstacle_ != nullptr ? obstacle_->peek() : ObstacleSnapshot{};
+    const float closing = closing_.update(ob.distance_m, ob.valid && !ob.clear, ob.seq, ob.stamp_us);
+    if (obstacle_ != nullptr && cur.obstacle_guard && dir_ == kForward && seq_ == DirSeq::Drive)
+    {
+        const bool fresh =
+            ob.valid && now_us() - ob.stamp_us < static_cast<uint64_t>(cfg::obstacle::STALE_MS) * 1000ULL;
+        const float obCap = ctl::obstacle_cap_pct(ob.distance_m, ob.clear, fresh, kObstacle, closing);
+        if (targetPct > obCap)
+        {
+            targetPct = obCap;
+            braking = true; ///< Follow the curve down at the brake rate; the coast ramp is too slow.
+            st.limits |= MotorStateSnapshot::kLimitObstacle;
+        }
+        obstacleStop = obCap <= kMinPct;
+        if (obstacleStop && !obstacle_stop_)
+            record(Event::ObstacleStop, ob.distance_m, closing, static_cast<uint32_t>(now_us() - ob.stamp_us));
+    }
+    obstacle_stop_ = obstacleStop;
+    if (obstacleStop)
+    {
+        braking = true;
+        sp_pct_ = kMinPct; ///< Closed loop: drop the setpoint too, not down its ramp.
+    }
+
+    // ---- Hill-hold: a zero command holds against rollback, reacting within one tick ---- //
+    float holdPct = kMinPct;
+    const bool holding =
+        hill_on_ && hill_hold(targetPct <= kMinPct && seq_ == DirSeq::Drive && !cur.autotune_cmd, dt_sec_, holdPct);
+    if (hill_on_ && hill_.state() == ctl::HillHold::State::Released)
+        braking = true; ///< Gave up: straight to the short-circuit brake.
+
+    // ---- Speed: measure, and in closed loop turn the setpoint into duty ---- //
+    const bool closed = features_.closed_loop && speed_ != nullptr;
+    const float rpm = (speed_ != nullptr) ? speed_->sample_rpm(dt_sec_) : 0.0f;
 
-        // Target selection.
-        const float targetPct = fminf(fmaxf(cur.throttle_cmd_pct, kMinPct), kMaxPct); ///< Clamp to avoid nonsense values.
+    // Autotune only from a forward standstill, and never through a brake or reversal.
+    const bool tune_ok = speed_ != nullptr && seq_ == DirSeq::Drive && dir_ == kForward && !braking &&
+                         (stopped || tune_.state() == ctl::RelayAutotune::State::Running);
+    float tunePct = kMinPct;
+    const bool tuning = autotune(cur.autotune_cmd && tune_ok, rpm, dt_sec_, tunePct);
 
-        // ---- Simple acceleration/deceleration (rate-based) ---- //
-        const float dt_sec =
-            (static_cast<float>(loop_ticks_) * static_cast<float>(portTICK_PERIOD_MS)) / 1000.0f;
+    if (tuning)
+        targetPct = tunePct;
+    else if (closed)
+        targetPct = speed_loop(targetPct, rpm, braking, dt_sec_);
 
-        const float ramp_step_pct = kRampRatePctPerSec * dt_sec;
+    if (holding)
+        targetPct = fminf(holdPct, fminf(capPct, heatCap)); ///< Still under the supply/thermal caps.
 
-        if (current_pct_ < targetPct)
+    // Traction: the outer tick is one inner step too (keeps the window evenly spaced).
+    const bool tc = traction_on_ && !tuning;
+    if (tc)
+    {
+        if (stopped && rpm <= 0.0f)
+            traction_.reset(); ///< At rest: re-seed so the next launch is watched from its first count.
+        traction_step(sub_dt_sec_, /*write=*/false);
+    }
+    else
+    {
+        tc_scale_ = 1.0f;
+    }
+    if (tc_scale_ < 1.0f)
+        st.limits |= MotorStateSnapshot::kLimitTraction;
+
+    // ---- Mixing: one step for all wheels ---- //
+    float wheelTarget[kMaxMotors];
+    mix(targetPct, cur.steer_cmd_pct, wheelTarget);
+
+    // ---- Simple acceleration/deceleration (rate-based, per wheel) ---- //
+    const bool shaped = closed || tuning || holding; ///< Setpoint/relay/hold own the shape.
+    const float rise_step_pct = shaped ? kMaxPct : accel_pct_s_ * dt_sec_;
+    const float ramp_step_pct = shaped ? kMaxPct : decel_pct_s_ * dt_sec_;
+    const float brake_step_pct = (holding || obstacleStop) ? kMaxPct : kBrakeRatePctPerSec * dt_sec_;
+
+    bool rising = false;
+    bool falling = false;
+    float peak = kMinPct;
+
+    for (size_t i = 0; i < count_; ++i)
+    {
+        float &pct = current_pct_[i];
+        if (pct < wheelTarget[i])
         {
-            current_pct_ = fminf(current_pct_ + ramp_step_pct, targetPct);
+            pct = fminf(pct + rise_step_pct, wheelTarget[i]);
+            rising = true;
         }
-        else if (current_pct_ > targetPct)
+        else if (pct > wheelTarget[i])
         {
-            current_pct_ = fmaxf(current_pct_ - ramp_step_pct, targetPct);
+            pct = fmaxf(pct - (braking ? brake_step_pct : ramp_step_pct), wheelTarget[i]);
+            falling = true;
         }
+        peak = fmaxf(peak, pct);
+    }
 
-        motor_->setSpeedPercent(current_pct_, kDir);
-        // debugfln("Speed: %.1f %%", current_pct_);
+    if (tuning)
+        st.phase = MotorStateSnapshot::RampPhase::Tuning;
+    else if (holding)
+        st.phase = MotorStateSnapshot::RampPhase::Holding;
+    else if (rising)
+        st.phase = MotorStateSnapshot::RampPhase::Accelerating;
+    else if (falling)
+        st.phase = braking ? MotorStateSnapshot::RampPhase::Braking : MotorStateSnapshot::RampPhase::Decelerating;
+    else if (seq_ == DirSeq::DeadTime)
+        st.phase = MotorStateSnapshot::RampPhase::Reversing;
+    else if (peak <= kMinPct)
+        st.phase = MotorStateSnapshot::RampPhase::Idle;
 
-        vTaskDelayUntil(&last_wake, loop_ticks_); ///< Pace loop.
+    // Supply compensation: same average motor voltage whatever the pack is doing.
+    float duty[kMaxMotors];
+    float peakDuty = kMinPct;
+    for (size_t i = 0; i < count_; ++i)
+    {
+        duty_base_[i] = cfg::battery::COMPENSATE ? ctl::compensate_pct(current_pct_[i], volts, kVoltageComp)
+                                                 : current_pct_[i];
+        duty[i] = duty_base_[i] * tc_scale_;
+        peakDuty = fmaxf(peakDuty, duty[i]);
+        st.wheel_pct[i] = duty[i];
     }
+
+    // Carrier by operating region; written first so the new period and duty latch together.
+    const uint32_t hz = pwm_policy_.select(peakDuty);
+    if (pwm_ != nullptr && hz != pwm_hz_ && pwm_->set_pwm_frequency(hz))
+        pwm_hz_ = hz;
+
+    // Apply all duties back-to-back; the synced timers load them on the same boundary
+    // (a write that straddles one lands a period, ≤ 100 µs, later).
+    // At 0 % with EN held, the BTS7960 low sides short the motor: that is the active brake.
+    for (size_t i = 0; i < count_; ++i)
+        wheels_[i].motor->setSpeedPercent(duty[i], dir_);
+    // debugfln("Speed: %.1f %%", peak);
+
+    // I²t update from what was just applied (the hottest wheel stands in for all).
+    const float speedFrac = (speed_ != nullptr) ? rpm / cfg::speed::MAX_RPM : -1.0f;
+    const float amps = ctl::current_proxy_a(peakDuty / kMaxPct, speedFrac, cfg::thermal::STALL_A,
+                                            cfg::thermal::FULL_LOAD_A);
+    motor_heat_.update(amps);
+    driver_heat_.update(amps);
+
+    // Feedback: what actually reached the H-bridge(s) this tick.
+    st.duty_pct = peakDuty;
+    st.battery_v = volts;
+    st.pwm_hz = pwm_hz_;
+    st.motor_temp_c = motor_heat_.temp_c(cfg::thermal::AMBIENT_C);
+    st.driver_temp_c = driver_heat_.temp_c(cfg::thermal::AMBIENT_C);
+    st.motors = static_cast<uint8_t>(count_);
+    st.speed_rpm = rpm;
+    st.closed_loop = closed || tuning;
+    st.dir = dir_;
+    st.stamp_us = now_us();
+    state_->publish(st);
+    tc_active_ = tc;
 }
\ No newline at end of file
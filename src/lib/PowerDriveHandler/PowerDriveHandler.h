@@ -13,24 +13,156 @@
 
 #include <app_config.h>
 #include <cmath>
+#include <array>
 #include <ESP32_MCPWM.h>
 #include <ControlBus.h>
+#include <MotorStateBus.h>
+#include <BatteryBus.h>
+#include <ObstacleBus.h>
+#include <TuneBus.h>
+#include <EventBus.h>
+#include <Pid.h>
+#include <RelayAutotune.h>
+#include <VoltageComp.h>
+#include <ThermalModel.h>
+#include <PwmFreqPolicy.h>
+#include <TractionControl.h>
+#include <HillHold.h>
+#include <ObstacleGuard.h>
+#include <PwmControl/PwmControl.h>
+#include <GainStore/GainStore.h>
+#include <WheelEncoder/WheelEncoder.h>
 
 /**
- * @brief Selects the power level and drives the motor.
+ * @brief Selects the power level and drives the motor(s).
+ *
+ * One mixing step per tick turns throttle + steering into a per-wheel target;
+ * every wheel then ramps on its own, and all duties are written back-to-back.
+ * The wheels' MCPWM timers are synced to timer 0 (McpwmFrequency::sync_timers()),
+ * so the new compares load on one shared period boundary.
  */
 class PowerDriveHandler
 {
 public:
+    static constexpr size_t kMaxMotors = cfg::motor::MAX_MOTORS; ///< Upper bound on driven motors.
+
+    using Side = cfg::motor::Side; ///< Which side of the car a motor drives (for differential mixing).
+
+    /// @brief One driven motor.
+    struct Wheel
+    {
+        IMotorDriver *motor{nullptr}; ///< Non-owning motor driver.
+        Side side{Side::Both};        ///< Mixing side.
+    };
+
+    /// @brief Optional drive stages: the cfg switches by default, changeable per instance (host rigs).
+    struct Features
+    {
+        bool closed_loop{cfg::speed::CLOSED_LOOP}; ///< Throttle % is a speed setpoint (needs a speed sensor).
+        bool traction{cfg::traction::ENABLED};     ///< Inner-loop slip control (needs a fine speed sensor).
+        bool hill_hold{cfg::hillhold::ENABLED};    ///< Hold against rollback at zero throttle (needs direction).
+    };
+
     /**
-     * @brief Construct with motor driver and input bus.
+     * @brief Construct with a single motor driver, input bus and state output bus.
      *
      * @param motor Motor driver (non-owning).
      * @param bus Control snapshot bus (non-owning).
+     * @param state Motor state bus published every tick (non-owning).
      * @param period_ms FreeRTOS tick interval used to pace the run loop (in milliseconds).
      */
-    PowerDriveHandler(IMotorDriver &motor, ControlBus &bus, uint32_t period_ms = cfg::tick::LOOP_MS) noexcept
-        : motor_(&motor), bus_(&bus), loop_ticks_(to_ticks_ms(period_ms)) {}
+    PowerDriveHandler(IMotorDriver &motor, ControlBus &bus, MotorStateBus &state,
+                      uint32_t period_ms = cfg::tick::LOOP_MS) noexcept
+        : bus_(&bus), state_(&state), loop_ticks_(to_ticks_ms(period_ms))
+    {
+        wheels_[0] = Wheel{&motor, Side::Both};
+        count_ = 1;
+    }
+
+    /**
+     * @brief Construct with several motors driven from one mixing step.
+     *
+     * @param wheels Motors and their sides (copied; at most kMaxMotors used).
+     * @param count Number of entries in wheels.
+     * @param bus Control snapshot bus (non-owning).
+     * @param state Motor state bus published every tick (non-owning).
+     * @param period_ms FreeRTOS tick interval used to pace the run loop (in milliseconds).
+     */
+    PowerDriveHandler(const Wheel *wheels, size_t count, ControlBus &bus, MotorStateBus &state,
+                      uint32_t period_ms = cfg::tick::LOOP_MS) noexcept;
+
+    /**
+     * @brief Attach a wheel-speed sensor (call before the task starts).
+     * @note With Features::closed_loop the throttle becomes a speed setpoint
+     *       (% of cfg::speed::MAX_RPM) held by a PID; otherwise speed is only reported.
+     *       Gains saved by a previous autotune are loaded from NVS here.
+     *
+     *       With Features::hill_hold and a sensor that reports direction, a zero
+     *       command also holds the car against rollback on a slope.
+     *
+     * @param sensor Speed sensor (non-owning), sampled once per tick.
+     */
+    void attach_speed_sensor(ISpeedSensor &sensor) noexcept;
+
+    /**
+     * @brief Override the cfg feature switches (call before the task starts).
+     * @note Firmware builds keep the cfg defaults; the host scenario suite uses this
+     *       to run each stage on the unmodified drive without a rebuild.
+     *
+     * @param f Stages to run.
+     */
+    void set_features(const Features &f) noexcept { features_ = f; }
+
+    /**
+     * @brief Attach the bus autotune results are published on (call before the task starts).
+     * @note The tuned gains go into the speed loop at once; GainSaver writes them to
+     *       NVS from its own task, so the flash write never lands in a drive tick.
+     *
+     * @param tune Tune result bus (non-owning).
+     */
+    void attach_tune(TuneBus &tune) noexcept { tune_bus_ = &tune; }
+
+    /**
+     * @brief Attach the battery bus (call before the task starts).
+     * @note Duty is then scaled by NOMINAL_V / volts so output stays constant as the
+     *       pack sags, and capped along the low-voltage curve in cfg::battery.
+     *
+     * @param battery Battery bus (non-owning).
+     */
+    void attach_battery(BatteryBus &battery) noexcept { battery_ = &battery; }
+
+    /**
+     * @brief Attach PWM frequency control (call before the task starts).
+     * @note The carrier then follows the operating region (cfg::motor::PWM_*):
+     *       fast at low duty for smooth, quiet crawling, slower at high duty to cut
+     *       switching losses. Changes are written just before the duty so both latch
+     *       on the same period boundary, and reach every wheel's timer at once.
+     *
+     * @param pwm Frequency control for the drive timers (non-owning).
+     */
+    void attach_pwm_frequency(IPwmFrequency &pwm) noexcept { pwm_ = &pwm; }
+
+    /**
+     * @brief Attach the obstacle bus (call before the task starts).
+     * @note While ControlSnapshot::obstacle_guard is set, forward throttle is capped
+     *       along the cfg::obstacle distance curve, and the output follows it down at
+     *       the brake rate. At STOP_M, or earlier when the closing speed between
+     *       pings needs more room (BRAKE_S), it drops straight to the short-circuit
+     *       brake, bypassing the ramps. Reverse is never limited.
+     *
+     * @param obstacle Obstacle bus (non-owning).
+     */
+    void attach_obstacle(ObstacleBus &obstacle) noexcept { obstacle_ = &obstacle; }
+
+    /**
+     * @brief Attach the event buses (call before the task starts).
+     * @note Records Event::ObstacleStop and the Autotune* events. The drive tick
+     *       only counts each edge and stores its numbers; EventLogger prints them,
+     *       so no formatting or Serial wait lands in the tick.
+     *
+     * @param events Event buses (non-owning).
+     */
+    void attach_events(EventBuses &events) noexcept { events_ = &events; }
 
     /**
      * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
@@ -40,21 +172,190 @@ public:
         static_cast<PowerDriveHandler *>(self)->run();
     }
 
+    // ---- Stepping (run() drives these; the host simulator calls them directly) ---- //
+
+    /**
+     * @brief One-time setup before the first step() (after every attach_*()).
+     */
+    void begin() noexcept;
+
+    /**
+     * @brief One drive tick: read the buses and sensor, run the limiters, write the duties, publish state.
+     */
+    void step() noexcept;
+
+    /// @brief Traction inner steps due before the next step() (0 → none this tick).
+    [[nodiscard]] uint32_t inner_steps() const noexcept;
+
+    /// @brief One traction inner step (call inner_steps() times, evenly spaced, between ticks).
+    void inner_step() noexcept
+    {
+        const trace::Span span(trace::Track::Traction);
+        traction_step(sub_dt_sec_, /*write=*/true);
+    }
+
 private:
     /**
-     * @brief Main run loop.
+     * @brief Main run loop: begin(), then step() every tick.
      */
     void run() noexcept;
 
+    /**
+     * @brief Differential mix: throttle + steering → per-wheel target (%).
+     *
+     * @param throttle_pct Vehicle throttle (0..100).
+     * @param steer_pct Steering (-100 left .. +100 right).
+     * @param out Per-wheel target (count_ entries, 0..100).
+     */
+    void mix(float throttle_pct, float steer_pct, float *out) const noexcept;
+
+    /**
+     * @brief Closed-loop speed: ramp the setpoint, run the PID.
+     *
+     * @param target_pct Throttle after clamping/sequencing (% of MAX_RPM).
+     * @param rpm Measured wheel speed.
+     * @param braking True → setpoint ramps down at the brake rate.
+     * @param dt_sec Tick period (s).
+     * @return Vehicle duty (%) to feed the mixer.
+     */
+    float speed_loop(float target_pct, float rpm, bool braking, float dt_sec) noexcept;
+
+    /**
+     * @brief Relay autotune mode: start on request, run while held, publish the result.
+     *
+     * @param requested ControlSnapshot::autotune_cmd (and drive in a state that allows it).
+     * @param rpm Measured wheel speed.
+     * @param dt_sec Tick period (s).
+     * @param out Vehicle duty (%) while tuning.
+     * @return true if the autotuner owns the output this tick.
+     */
+    bool autotune(bool requested, float rpm, float dt_sec, float &out) noexcept;
+
+    /// @brief Record @p e on the attached event buses, if any.
+    void record(Event e, float v0 = 0.0f, float v1 = 0.0f, uint32_t latency_us = 0) noexcept;
+
+    /**
+     * @brief One traction inner step: read the encoder, update the duty scale.
+     *
+     * @param dt_sec Inner step period (s).
+     * @param write True → re-write the duties if the scale moved (between outer ticks).
+     */
+    void traction_step(float dt_sec, bool write) noexcept;
+
+    /**
+     * @brief Hill-hold: arm on a zero command, hold against rollback, hand back on throttle.
+     *
+     * @param zero_cmd Command is zero in normal driving (no reversal, no autotune).
+     * @param dt_sec Tick period (s).
+     * @param out Holding duty (%) when holding.
+     * @return true if the hold owns the output this tick.
+     */
+    bool hill_hold(bool zero_cmd, float dt_sec, float &out) noexcept;
+
+    /**
+     * @brief Sleep until the next outer tick, running traction_step() every inner step.
+     *
+     * @param last_wake Outer-loop wake reference (advanced to the next outer tick).
+     * @param sub_ticks Inner step (ticks).
+     * @param sub_dt_sec Inner step (s).
+     */
+    void traction_substeps(TickType_t &last_wake, TickType_t sub_ticks, float sub_dt_sec) noexcept;
+
     // ---- Tuning knobs ---- //
-    static constexpr float kRampRatePctPerSec = 40.0f; ///< %/s: 0→100% in 2.5s (↑ faster, ↓ smoother).
-    static constexpr float kMinPct = 0.0f;             ///< Lower clamp for percent.
-    static constexpr float kMaxPct = 100.0f;           ///< Upper clamp for percent.
-    static constexpr Dir kDir = Dir::CW;               ///< Direction parameter.
+    static constexpr float kRampRatePctPerSec = 40.0f;   ///< %/s: default ramp down (and up without a drive mode), 0→100% in 2.5s.
+    static constexpr float kBrakeRatePctPerSec = 150.0f; ///< %/s: active-brake ramp down (100→0% in ~0.7s).
+    static constexpr float kDeadTimeSec = 0.25f;         ///< Time held at 0% before flipping direction.
+    static constexpr float kMinPct = 0.0f;               ///< Lower clamp for percent.
+    static constexpr float kMaxPct = 100.0f;             ///< Upper clamp for percent.
+    static constexpr Dir kForward = Dir::CW;             ///< H-bridge direction for forward.
+    static constexpr Dir kReverse = Dir::CCW;            ///< H-bridge direction for reverse.
+    static constexpr float kSteerMix = 0.5f;             ///< Full lock: inner wheel at 50% of outer (differential).
+
+    using Traction = ctl::TractionControl<cfg::traction::WINDOW_STEPS>; ///< Inner-loop slip controller.
+
+    /// @brief Direction-change sequence.
+    enum class DirSeq : uint8_t
+    {
+        Drive,    ///< Normal driving in dir_.
+        Stopping, ///< Reversal requested: braking to 0%.
+        DeadTime  ///< At 0%, waiting before the flip.
+    };
 
     // ---- Internal state ---- //
-    IMotorDriver *motor_{nullptr}; ///< Non-owning motor driver.
-    ControlBus *bus_{nullptr};     ///< Non-owning input bus.
-    TickType_t loop_ticks_{0};     ///< Delay (in ticks) between loop iterations.
-    float current_pct_{0.0f};      ///< Current percent (0..100).
+    std::array<Wheel, kMaxMotors> wheels_{};      ///< Driven motors (first count_ valid).
+    size_t count_{0};                             ///< Number of driven motors.
+    Features features_{};                         ///< Optional stages in use.
+    ControlBus *bus_{nullptr};                    ///< Non-owning input bus.
+    MotorStateBus *state_{nullptr};               ///< Non-owning output bus (actual drive state).
+    TickType_t loop_ticks_{0};                    ///< Delay (in ticks) between loop iterations.
+    std::array<float, kMaxMotors> current_pct_{}; ///< Current percent per motor (0..100).
+    Dir dir_{kForward};                           ///< Direction currently applied.
+    DirSeq seq_{DirSeq::Drive};                   ///< Direction-change state.
+    float dead_left_s_{0.0f};                     ///< Remaining dead time (s).
+    ISpeedSensor *speed_{nullptr};                ///< Optional wheel-speed sensor (non-owning).
+    ctl::Pid pid_{};                              ///< Speed controller (closed loop).
+    float sp_pct_{0.0f};                          ///< Ramped speed setpoint (% of MAX_RPM).
+    float accel_pct_s_{kRampRatePctPerSec};       ///< Throttle rise rate for the current drive mode (%/s).
+    float decel_pct_s_{kRampRatePctPerSec};       ///< Throttle release rate (%/s).
+    ctl::RelayAutotune tune_{};                   ///< Relay experiment (autotune mode).
+    GainStore gain_store_{cfg::nvs::SPEED_GAINS}; ///< NVS record for the speed gains (loaded once).
+    TuneBus *tune_bus_{nullptr};                  ///< Optional tune result bus (non-owning).
+    bool tune_req_prev_{false};                   ///< Previous autotune request (edge detect).
+    BatteryBus *battery_{nullptr};                ///< Optional battery bus (non-owning).
+    ctl::ThermalModel motor_heat_{};              ///< Winding I²t estimate (hottest wheel).
+    ctl::ThermalModel driver_heat_{};             ///< H-bridge I²t estimate (hottest wheel).
+    IPwmFrequency *pwm_{nullptr};                 ///< Optional carrier frequency control (non-owning).
+    ctl::PwmFreqPolicy pwm_policy_{};             ///< Region → frequency selection.
+    uint32_t pwm_hz_{0};                          ///< Frequency last applied (0 = not controlled).
+    Traction traction_{};                         ///< Inner-loop slip control.
+    std::array<float, kMaxMotors> duty_base_{};   ///< Duty per motor before the traction scale (%).
+    float tc_scale_{1.0f};                        ///< Traction duty scale in effect.
+    ctl::HillHold hill_{};                        ///< Rollback hold.
+    int32_t hill_pos_{0};                         ///< Encoder position at the previous hill_hold().
+    ObstacleBus *obstacle_{nullptr};              ///< Optional obstacle bus (non-owning).
+    bool obstacle_stop_{false};                   ///< Obstacle stop in effect last tick.
+    EventBuses *events_{nullptr};                 ///< Optional edge event record (non-owning).
+    ctl::ClosingRate closing_{};                  ///< Closing speed from the pings.
+    float dt_sec_{0.0f};                          ///< Tick period (s).
+    TickType_t sub_ticks_{0};                     ///< Traction inner step (ticks).
+    float sub_dt_sec_{0.0f};                      ///< Traction inner step (s).
+    bool traction_on_{false};                     ///< Traction control configured (encoder fitted).
+    bool hill_on_{false};                         ///< Hill-hold configured (quadrature encoder fitted).
+    bool tc_active_{false};                       ///< Traction ran this tick: inner steps follow.
+
+    /// @brief Supply compensation / low-voltage curve.
+    static constexpr ctl::VoltageCompSpec kVoltageComp{cfg::battery::NOMINAL_V, cfg::battery::LIMIT_START_V,
+                                                       cfg::battery::LIMIT_END_V, cfg::battery::LIMIT_FLOOR_PCT,
+                                                       cfg::battery::MIN_VALID_V};
+
+    /// @brief Carrier frequency policy.
+    static constexpr ctl::PwmFreqSpec kPwmFreq{cfg::motor::PWM_LOW_DUTY_HZ, cfg::motor::PWM_HIGH_DUTY_HZ,
+                                               cfg::motor::PWM_UP_PCT, cfg::motor::PWM_DOWN_PCT,
+                                               cfg::motor::PWM_MIN_DWELL};
+
+    /// @brief Traction control settings (counts_per_rev replaced by the sensor's in begin()).
+    static constexpr ctl::TractionSpec kTraction{cfg::speed::MAX_RPM, cfg::traction::TAU_S,
+                                                 cfg::traction::MARGIN_RPM_S, cfg::traction::CUT_FACTOR,
+                                                 cfg::traction::REF_ACCEL_RPM_S, cfg::traction::SLIP_BAND_RPM,
+                                                 cfg::traction::SLIP_GAIN, cfg::traction::RECOVER_PER_S,
+                                                 cfg::traction::MIN_SCALE, cfg::encoder::COUNTS_PER_REV};
+
+    /// @brief Hill-hold settings.
+    static constexpr ctl::HillHoldSpec kHillHold{cfg::hillhold::ROLL_COUNTS, cfg::hillhold::KP_PCT,
+                                                 cfg::hillhold::KI_PCT_S, cfg::hillhold::MAX_PCT,
+                                                 cfg::hillhold::MAX_HOLD_S};
+
+    /// @brief Obstacle distance → forward cap.
+    static constexpr ctl::ObstacleSpec kObstacle{cfg::obstacle::SLOW_M, cfg::obstacle::STOP_M,
+                                                 cfg::obstacle::LIMP_PCT, cfg::obstacle::BRAKE_S};
+
+    /// @brief Motor winding thermal body.
+    static constexpr ctl::ThermalSpec kMotorHeat{cfg::thermal::MOTOR_R_OHM, cfg::thermal::MOTOR_RTH,
+                                                 cfg::thermal::MOTOR_TAU_S, cfg::thermal::MOTOR_DERATE_C,
+                                                 cfg::thermal::MOTOR_MAX_C, cfg::thermal::FLOOR_PCT};
+
+    /// @brief BTS7960 thermal body.
+    static constexpr ctl::ThermalSpec kDriverHeat{cfg::thermal::DRIVER_R_OHM, cfg::thermal::DRIVER_RTH,
+                                                  cfg::thermal::DRIVER_TAU_S, cfg::thermal::DRIVER_DERATE_C,
+                                                  cfg::thermal::DRIVER_MAX_C, cfg::thermal::FLOOR_PCT};
 };
\ No newline at end of file
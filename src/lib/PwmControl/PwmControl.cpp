@@ -0,0 +1,94 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of PWM frequency control and the logging fake driver.
+ *
+ * @file PwmControl.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "PwmControl.h"
+
+// ---- McpwmFrequency ---- //
+
+// Timer 0 emits a sync at its zero; the others restart from zero on it.
+bool McpwmFrequency::sync_timers() noexcept
+{
+    if (timers_ < 2)
+        return true;
+
+    bool ok = mcpwm_set_timer_sync_output(unit_, MCPWM_TIMER_0, MCPWM_SWSYNC_SOURCE_TEZ) == ESP_OK;
+    mcpwm_sync_config_t s{};
+    s.sync_sig = MCPWM_SELECT_TIMER0_SYNC;
+    s.timer_val = 0; ///< Same phase as timer 0.
+    s.count_direction = MCPWM_TIMER_DIRECTION_UP;
+    for (size_t t = 1; t < timers_; ++t)
+        ok = mcpwm_sync_configure(unit_, static_cast<mcpwm_timer_t>(t), &s) == ESP_OK && ok;
+    return ok;
+}
+
+// Request a new frequency on every drive timer.
+bool McpwmFrequency::set_pwm_frequency(uint32_t hz) noexcept
+{
+    bool ok = true;
+    for (size_t t = 0; t < timers_; ++t)
+        ok = mcpwm_set_frequency(unit_, static_cast<mcpwm_timer_t>(t), hz) == ESP_OK && ok;
+    return ok; ///< Any refusal → the drive retries next tick.
+}
+
+// ---- FakeMotorDriver ---- //
+
+// Record (and forward) a duty write.
+void FakeMotorDriver::setSpeedPercent(float pct, Dir dir)
+{
+    record(Event::Kind::Duty, pct, dir);
+    if (inner_ != nullptr)
+        inner_->setSpeedPercent(pct, dir);
+}
+
+// Record (and forward) a frequency change.
+bool FakeMotorDriver::set_pwm_frequency(uint32_t hz) noexcept
+{
+    record(Event::Kind::Freq, static_cast<float>(hz), Dir::CW);
+    return (inner_freq_ != nullptr) ? inner_freq_->set_pwm_frequency(hz) : true;
+}
+
+// Append to the ring.
+void FakeMotorDriver::record(Event::Kind kind, float value, Dir dir) noexcept
+{
+    Event &e = log_[count_ % kCapacity];
+    e.stamp_us = now_us();
+    e.kind = kind;
+    e.value = value;
+    e.dir = dir;
+    ++count_;
+}
+
+// Print and clear.
+void FakeMotorDriver::dump() noexcept
+{
+    const size_t n = size();
+    const size_t first = count_ - n; ///< Oldest surviving event.
+
+    if (count_ > kCapacity)
+        debugfln("FakeMotor: %u events dropped", static_cast<unsigned>(count_ - kCapacity));
+
+    float last_duty = -1.0f;
+    for (size_t k = 0; k < n; ++k)
+    {
+        const Event &e = log_[(first + k) % kCapacity];
+        if (e.kind == Event::Kind::Freq)
+        {
+            debugfln("%10llu us  FREQ %6.0f Hz", static_cast<unsigned long long>(e.stamp_us), e.value);
+        }
+        else if (e.value != last_duty)
+        {
+            debugfln("%10llu us  DUTY %5.1f %% %s", static_cast<unsigned long long>(e.stamp_us), e.value,
+                     e.dir == Dir::CW ? "CW" : "CCW");
+            last_duty = e.value;
+        }
+    }
+    count_ = 0;
+}
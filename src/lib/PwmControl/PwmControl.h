@@ -0,0 +1,126 @@
+/**
+ * MIT License
+ *
+ * @brief PWM frequency control for the drive H-bridge(s), plus a logging fake driver.
+ *
+ * @file PwmControl.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <array>
+#include <driver/mcpwm.h>
+#include <ESP32_MCPWM.h>
+
+/**
+ * @brief Something whose PWM carrier frequency can be changed at run time.
+ */
+class IPwmFrequency
+{
+public:
+    virtual ~IPwmFrequency() = default;
+
+    /**
+     * @brief Request a new carrier frequency.
+     * @note Callers re-write duty right after, so compare values match the new period.
+     *
+     * @param hz Frequency (Hz).
+     * @return true if accepted.
+     */
+    virtual bool set_pwm_frequency(uint32_t hz) noexcept = 0;
+};
+
+/**
+ * @brief Changes the carrier of every drive MCPWM timer together.
+ *
+ * Period and compare registers are shadowed and latch on timer-equals-zero,
+ * so a change lands on a period boundary without a runt pulse. Each wheel
+ * has its own timer (cfg::motor::WHEELS); sync_timers() restarts timers
+ * 1.. on timer 0's zero, so all wheels share one period boundary and the
+ * duties written in one drive tick load together.
+ */
+class McpwmFrequency : public IPwmFrequency
+{
+public:
+    /**
+     * @brief Construct for the drive timers.
+     *
+     * @param unit MCPWM unit the Motors were set up on.
+     * @param timers Timers 0..timers-1 of that unit (one per wheel).
+     */
+    McpwmFrequency(mcpwm_unit_t unit = static_cast<mcpwm_unit_t>(cfg::motor::MCPWM_UNIT),
+                   size_t timers = cfg::motor::WHEEL_COUNT) noexcept
+        : unit_(unit), timers_(timers) {}
+
+    /**
+     * @brief Lock timers 1.. to timer 0's period start (call once, after every Motor is set up).
+     * @return true if every timer accepted the sync (trivially true for one wheel).
+     */
+    bool sync_timers() noexcept;
+
+    bool set_pwm_frequency(uint32_t hz) noexcept override;
+
+private:
+    mcpwm_unit_t unit_{MCPWM_UNIT_0}; ///< MCPWM unit.
+    size_t timers_{1};                ///< Drive timers (0..timers_-1).
+};
+
+/**
+ * @brief Stand-in motor that records every command instead of (or as well as) driving one.
+ *
+ * Flash with it in place of the Motor to check on target what the drive would
+ * do: ordering of frequency changes vs. duty writes, ramp shapes, derating.
+ * @note Not thread-safe: call dump() from the drive task or with it suspended.
+ */
+class FakeMotorDriver : public IMotorDriver, public IPwmFrequency
+{
+public:
+    /// @brief One recorded command.
+    struct Event
+    {
+        enum class Kind : uint8_t
+        {
+            Duty = 0, ///< setSpeedPercent().
+            Freq      ///< set_pwm_frequency().
+        };
+
+        uint64_t stamp_us{0};  ///< When it was issued.
+        Kind kind{Kind::Duty}; ///< What was issued.
+        float value{0.0f};     ///< Duty (%) or frequency (Hz).
+        Dir dir{Dir::CW};      ///< Direction (Duty only).
+    };
+
+    static constexpr size_t kCapacity = 256; ///< Ring size (oldest overwritten).
+
+    /**
+     * @brief Construct, optionally passing commands through.
+     *
+     * @param inner Real driver to forward duty to (nullptr → log only).
+     * @param inner_freq Real frequency control to forward to (nullptr → log only).
+     */
+    explicit FakeMotorDriver(IMotorDriver *inner = nullptr, IPwmFrequency *inner_freq = nullptr) noexcept
+        : inner_(inner), inner_freq_(inner_freq) {}
+
+    void setSpeedPercent(float pct, Dir dir) override;
+    bool set_pwm_frequency(uint32_t hz) noexcept override;
+
+    /**
+     * @brief Print and clear the log.
+     * @note Only duty *changes* are printed, so a steady ramp reads as a short list.
+     */
+    void dump() noexcept;
+
+    [[nodiscard]] size_t size() const noexcept { return (count_ < kCapacity) ? count_ : kCapacity; }
+
+private:
+    void record(Event::Kind kind, float value, Dir dir) noexcept;
+
+    IMotorDriver *inner_{nullptr};       ///< Optional pass-through driver.
+    IPwmFrequency *inner_freq_{nullptr}; ///< Optional pass-through frequency control.
+    std::array<Event, kCapacity> log_{}; ///< Event ring.
+    size_t count_{0};                    ///< Events recorded since the last dump().
+};
@@ -1,7 +1,7 @@
 /**
  * MIT License
  *
- * @brief Implementation of RC publisher (iBUS → RcLink → SnapshotBus).
+ * @brief Implementation of RC publisher (iBUS/SBUS/CRSF → RcLink → SnapshotBus).
  *
  * @file RcPublisher.cpp
  * @author Little Man Builds (Darren Osborne)
@@ -11,8 +11,48 @@
 
 #include "RcPublisher.h"
 
-// Short alias for SnapshotRTOS helpers.
-namespace srt = snapshot::rtos;
+namespace
+{
+    /**
+     * @brief Role description: how raw µs maps to output, its filter chain, and the failsafe raw value.
+     */
+    struct RoleSpec
+    {
+        RC role;                  ///< Logical role (index into frame / LUT bank).
+        bool is_switch;           ///< True → level table; false → axis table.
+        rcmap::AxisSpec axis;     ///< Axis mapping (unused for switches).
+        rcmap::SwitchSpec sw;     ///< Switch levels (unused for axes).
+        int16_t failsafe_us;      ///< Raw µs substituted by RcLink on failsafe.
+        rcmap::FilterSpec filter; ///< Output filter chain (fixed-point counts).
+    };
+
+    constexpr RoleSpec axis(RC role, rcmap::AxisSpec a, int16_t failsafe_us, rcmap::FilterSpec f = {}) { return {role, false, a, {}, failsafe_us, f}; }
+    constexpr RoleSpec sw(RC role, rcmap::SwitchSpec s, int16_t failsafe_us, rcmap::FilterSpec f = {}) { return {role, true, {}, s, failsafe_us, f}; }
+
+    // ---- Filter presets (tuned for the default publisher cadence) ---- //
+    constexpr float kRateHz = 1000.0f / static_cast<float>(cfg::tick::LOOP_MS); ///< Filter sample rate.
+    constexpr rcmap::FilterSpec kStick = rcmap::stick_filter(kRateHz);          ///< Spike reject + light smoothing.
+    constexpr rcmap::FilterSpec kThrottle = rcmap::throttle_filter(kRateHz);    ///< + rise slew (release is never slewed).
+    constexpr rcmap::FilterSpec kKnob = rcmap::knob_filter(kRateHz);            ///< Slow pots: heavy smoothing.
+    constexpr rcmap::FilterSpec kSwitch = rcmap::switch_filter();               ///< Ignore single-frame glitches.
+
+    // Declared in RC enum order.
+    constexpr RoleSpec kRoles[] = {
+        axis(RC::steering, {1000, 2000, 1500, 8, -100.f, 100.f}, 1500, kStick),
+        axis(RC::direction, {1000, 2000, 1500, 8, -100.f, 100.f}, 1500, kStick),
+        axis(RC::speed, {1000, 2000, 1000, 8, 0.f, 100.f}, 1000, kThrottle),
+        axis(RC::indicators, {1000, 2000, 1500, 8, -100.f, 100.f}, 1500, kStick),
+        axis(RC::volume, {1000, 2000, 1500, 4, 0.f, 100.f}, 1000, kKnob),
+        axis(RC::power, {1000, 2000, 1500, 4, 0.f, 100.f}, 1000, kKnob),
+        sw(RC::override, {2, {1000, 2000}, {0.f, 1.f}}, 2000, kSwitch), ///< Override car settings.
+        sw(RC::lights, {2, {1000, 2000}, {0.f, 1.f}}, 1000, kSwitch),
+        sw(RC::mode, {3, {1000, 1500, 2000}, {0.f, 1.f, 2.f}}, 1000, kSwitch), ///< Default mode.
+        sw(RC::obstacle, {2, {1000, 2000}, {0.f, 1.f}}, 1000, kSwitch),
+    };
+
+    static_assert(sizeof(kRoles) / sizeof(kRoles[0]) == static_cast<size_t>(RC::Count),
+                  "kRoles must describe every RC role.");
+} ///< Namespace.
 
 // Constructor.
 RcPublisher::RcPublisher(uint32_t period_ms, float epsilon, uint32_t min_interval_ms) noexcept
@@ -23,66 +63,162 @@ RcPublisher::RcPublisher(uint32_t period_ms, float epsilon, uint32_t min_interva
 // Configure RCLink (axes, switches, etc.).
 void RcPublisher::begin() noexcept
 {
-    rclink_.begin(Serial2, cfg::rc::BAUD, cfg::rc::UART_RX, cfg::rc::UART_TX); ///< Start iBUS UART on Serial2.
+    rx_[0].link.begin(Serial2, cfg::rc::BAUD, cfg::rc::UART_RX, cfg::rc::UART_TX); ///< Start primary receiver UART on Serial2.
+    for (size_t i = 1; i < kReceivers; ++i)
+        rx_[i].link.begin(Serial1, cfg::rc::BAUD, cfg::rc::UART2_RX, cfg::rc::UART2_TX); ///< Secondary receiver on Serial1.
 
     RC_CONFIG(RC, cfg);          ///< Build configuration.
     RC_CFG_MAP_DEFAULT(RC, cfg); ///< Map roles in declared order to channels.
 
-    // Axes.
-    cfg.axis(RC::steering).raw(1000, 2000, 1500).deadband_us(8).out(-100.f, 100.f).done();
-    cfg.axis(RC::direction).raw(1000, 2000, 1500).deadband_us(8).out(-100.f, 100.f).done();
-    cfg.axis(RC::speed).raw(1000, 2000, 1000).deadband_us(8).out(0.f, 100.f).done();
-    cfg.axis(RC::indicators).raw(1000, 2000, 1500).deadband_us(8).out(-100.f, 100.f).done();
-    cfg.axis(RC::volume).raw(1000, 2000, 1500).deadband_us(4).out(0.f, 100.f).done();
-    cfg.axis(RC::power).raw(1000, 2000, 1500).deadband_us(4).out(0.f, 100.f).done();
-
-    // Switches.
-    cfg.sw(RC::override).raw_levels({1000, 2000}).values({0.f, 1.f}).done();
-    cfg.sw(RC::lights).raw_levels({1000, 2000}).values({0.f, 1.f}).done();
-    cfg.sw(RC::mode).raw_levels({1000, 1500, 2000}).values({0.f, 1.f, 2.f}).done();
-    cfg.sw(RC::obstacle).raw_levels({1000, 2000}).values({0.f, 1.f}).done();
-
-    // Failsafe policies.
-    cfg.setFailsafePolicy(RC::steering, rc::Failsafe::Mode::Value, 0);
-    cfg.setFailsafePolicy(RC::direction, rc::Failsafe::Mode::Value, 0);
-    cfg.setFailsafePolicy(RC::speed, rc::Failsafe::Mode::Value, 0);
-    cfg.setFailsafePolicy(RC::indicators, rc::Failsafe::Mode::Value, 0);
-    cfg.setFailsafePolicy(RC::volume, rc::Failsafe::Mode::Value, 0);
-    cfg.setFailsafePolicy(RC::power, rc::Failsafe::Mode::Value, 0);
-    cfg.setFailsafePolicy(RC::override, rc::Failsafe::Mode::Value, 1); ///< Override car settings.
-    cfg.setFailsafePolicy(RC::lights, rc::Failsafe::Mode::Value, 0);
-    cfg.setFailsafePolicy(RC::mode, rc::Failsafe::Mode::Value, 0); ///< Default mode.
-    cfg.setFailsafePolicy(RC::obstacle, rc::Failsafe::Mode::Value, 0);
-
-    // Link-level failsafe timing.
-    cfg.setLinkTimeout(50); ///< 50 ms instead of default (200 ms).
-
-    // Receiver failsafe signature (±2, hold 50 ms).
-    RC_SET_FS_SIGNATURE_SELECTED(RC, rclink_, /* tol */ 2, /* hold_ms */ 50,
-                                 {{RC::steering, +100},
-                                  {RC::direction, +100},
-                                  {RC::speed, +100},
-                                  {RC::indicators, -100}});
-
-    rclink_.apply_rxfs_outputs(true); ///< Apply RX failsafe outputs when RX indicates failsafe.
-
-    rclink_.apply_config(cfg); ///< Apply configuration.
-
-    RcPublisher::Reader reader{&rclink_}; ///< Adapter: RcLink → float channels for the publisher.
-
-    srt::Policy pol{};  ///< Publishing policy (change gate + min interval).
-    pol.epsilon = eps_; ///< Only publish if a channel moves > epsilon.
-    pol.min_interval_us = (min_interval_ms_ > 0)
-                              ? static_cast<uint32_t>(min_interval_ms_) * 1000u ///< Conversion: works in microseconds.
-                              : 0u;                                             ///< Or always publish if set to 0.
-
-    srt::start_publisher<static_cast<size_t>(RC::Count), RcSnapshot>(
-        buses::rc(), ///< The bus that snapshots flow into.
-        reader,      ///< RcLink-backed reader.
-        pol,         ///< Publish policy.
-        "RcPub",     ///< Task name (shows up in FreeRTOS debug).
-        4096,        ///< Stack size (words → ~16 KB).
-        2,           ///< Task priority.
-        period_ms_   ///< Polling period in milliseconds.
-    );
-}
\ No newline at end of file
+    // RcLink passes raw µs through; scaling, deadband and switch levels come from lut_.
+    for (const RoleSpec &s : kRoles)
+    {
+        cfg.axis(s.role).raw(rcmap::kRawMin, rcmap::kRawMax, rcmap::kRawCenter).deadband_us(0).out(rcmap::kRawMin, rcmap::kRawMax).done();
+        cfg.setFailsafePolicy(s.role, rc::Failsafe::Mode::Value, s.failsafe_us);
+    }
+
+    // Link-level failsafe timing (the frame watchdog below uses the same window).
+    cfg.setLinkTimeout(cfg::rc::LINK_TIMEOUT_MS); ///< 50 ms instead of default (200 ms).
+
+    for (Receiver &r : rx_)
+    {
+        Link &link = r.link;
+
+        // Receiver failsafe signature (±10 µs, hold 50 ms).
+        RC_SET_FS_SIGNATURE_SELECTED(RC, link, /* tol */ 10, /* hold_ms */ 50,
+                                     {{RC::steering, 2000},
+                                      {RC::direction, 2000},
+                                      {RC::speed, 2000},
+                                      {RC::indicators, 1000}});
+
+        link.apply_rxfs_outputs(true); ///< Apply RX failsafe outputs when RX indicates failsafe.
+
+        link.apply_config(cfg); ///< Apply configuration.
+    }
+
+    // Compile the mapping alongside the config: one table per role.
+    for (const RoleSpec &s : kRoles)
+    {
+        const size_t ch = static_cast<size_t>(s.role);
+        if (s.is_switch)
+        {
+            lut_.set_switch(ch, s.sw);
+        }
+        else
+        {
+            lut_.set_axis(ch, s.axis);
+
+            const int16_t a = rcmap::to_fixed(s.axis.out_min);
+            const int16_t b = rcmap::to_fixed(s.axis.out_max);
+            predictors_.configure(ch, {true, (a < b) ? a : b, (a < b) ? b : a}); ///< Switches never extrapolate.
+        }
+
+        filters_.configure(ch, s.filter);
+    }
+
+    reader_ = Reader{{}, &lut_, &filters_, &predictors_}; ///< Adapter: RcLink(s) → float channels for the publisher.
+    for (size_t i = 0; i < kReceivers; ++i)
+        reader_.links[i] = &rx_[i].link;
+
+    // Failsafe frame as consumers will see it (mapped through the same tables).
+    constexpr size_t M = static_cast<size_t>(RC::Count);
+    int16_t fs_raw[M]{};
+    int16_t fs_mapped[M]{};
+    for (const RoleSpec &s : kRoles)
+        fs_raw[static_cast<size_t>(s.role)] = s.failsafe_us;
+    lut_.map(fs_raw, fs_mapped, M);
+    rcmap::to_float(fs_mapped, fs_frame_.out.data(), M, rcmap::kLsb);
+    fs_frame_.failsafe = true;
+
+    // Frame-arrival watchdog: one-shot, re-armed on every valid frame.
+    esp_timer_create_args_t wd_args{};
+    wd_args.callback = &RcPublisher::on_watchdog;
+    wd_args.arg = this;
+    wd_args.dispatch_method = ESP_TIMER_TASK;
+    wd_args.name = "RcWatchdog";
+    configASSERT(esp_timer_create(&wd_args, &wd_) == ESP_OK);
+
+    configASSERT(xTaskCreatePinnedToCore(RcPublisher::task, "RcPub", kStack, this, kPriority, &task_, /*Core=*/0) == pdPASS);
+}
+
+// Main run loop.
+void RcPublisher::run() noexcept
+{
+    const TickType_t loop_ticks = to_ticks_ms(period_ms_);
+    configASSERT(reader_.links[0] != nullptr && wd_ != nullptr); ///< Sanity check: begin() must have run.
+    configASSERT(loop_ticks > 0);                                ///< Timing must be configured.
+
+    TickType_t next_wake = xTaskGetTickCount() + loop_ticks;
+
+    for (;;)
+    {
+        step();
+
+        // Sleep until the next period, or until the watchdog wakes us early.
+        const TickType_t now = xTaskGetTickCount();
+        const TickType_t wait = (static_cast<int32_t>(next_wake - now) > 0) ? (next_wake - now) : 0;
+        if (ulTaskNotifyTake(pdTRUE, wait) == 0)
+            next_wake += loop_ticks; ///< Period elapsed (not a watchdog wake).
+    }
+}
+
+// One poll.
+void RcPublisher::step() noexcept
+{
+    const trace::Span span(trace::Track::RcPub);
+    if (reader_.update())
+        arm_watchdog(); ///< Valid frame (either receiver) → push the deadline out.
+
+    const bool link_lost = wd_expired_.load(std::memory_order_acquire);
+
+    RcSnapshot s{};
+    reader_.read(s.out.data(), s.out.size()); ///< Keep filters fed even while substituting failsafe.
+    s.failsafe = link_lost || !reader_.ok();
+    s.linked = last_frame_us_ > 0; ///< Never linked → ControlCore treats it as no receiver fitted.
+    s.source = link_lost ? RcSource::None : reader_.source();
+    s.predicted = !link_lost && reader_.predicted;
+    if (link_lost)
+        s.out = fs_frame_.out;
+    s.link_quality = link_lost ? 0 : rc_link_quality(rx_[reader_.div.active()].rx); ///< 255 unless the protocol reports it.
+    s.stamp_us = now_us();
+
+    // Change gate + heartbeat; failsafe transitions always go out.
+    const uint64_t min_interval_us = static_cast<uint64_t>(min_interval_ms_) * 1000ULL;
+    bool publish = !has_pub_ || s.failsafe != last_pub_.failsafe || s.source != last_pub_.source ||
+                   s.link_quality != last_pub_.link_quality;
+    for (size_t i = 0; !publish && i < s.out.size(); ++i)
+        publish = std::fabs(s.out[i] - last_pub_.out[i]) > eps_;
+    if (!publish && min_interval_us > 0)
+        publish = (s.stamp_us - last_pub_.stamp_us) >= min_interval_us;
+
+    if (publish)
+    {
+        if (link_lost && !last_pub_.failsafe && last_frame_us_ > 0)
+            record_event(buses::event(Event::RcLinkLost), s.stamp_us,
+                         static_cast<uint32_t>(s.stamp_us - last_frame_us_)); ///< EventLogger prints it.
+
+        buses::rc().publish(s);
+        last_pub_ = s;
+        has_pub_ = true;
+    }
+}
+
+// Re-arm the frame-arrival watchdog.
+void RcPublisher::arm_watchdog() noexcept
+{
+    last_frame_us_ = now_us();
+
+    // Stop before clearing: an expiry landing between the two would otherwise re-set the flag after a valid frame.
+    esp_timer_stop(wd_); ///< Harmless if already expired / not yet started.
+    wd_expired_.store(false, std::memory_order_release);
+    esp_timer_start_once(wd_, static_cast<uint64_t>(cfg::rc::LINK_TIMEOUT_MS) * 1000ULL);
+}
+
+// Watchdog expiry (esp_timer task context).
+void RcPublisher::on_watchdog(void *self) noexcept
+{
+    auto *p = static_cast<RcPublisher *>(self);
+    p->wd_expired_.store(true, std::memory_order_release);
+    if (p->task_ != nullptr)
+        xTaskNotifyGive(p->task_); ///< Publish failsafe now, not at the next poll.
+}
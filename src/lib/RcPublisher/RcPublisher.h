@@ -1,7 +1,7 @@
 /**
  * MIT License
  *
- * @brief RC publisher: iBUS → RCLink → SnapshotBus (RCBus).
+ * @brief RC publisher: iBUS/SBUS/CRSF → RCLink → SnapshotBus (RCBus).
  *
  * @file RcPublisher.h
  * @author Little Man Builds (Darren Osborne)
@@ -16,11 +16,26 @@
 #include <cstddef>
 #include <RCLink.h>
 #include <SnapshotBus.h>
-#include <SnapshotRTOS.h>
+#include <array>
+#include <atomic>
+#include <esp_timer.h>
 #include <RcBus.h>
+#include <EventBus.h>
+#include <RcTransports/RcTransports.h>
+#include <RcLut.h>
+#include <RcConvert.h>
+#include <RcFilter.h>
+#include <RcPredictor.h>
+#include <RcDiversity.h>
 
 /**
  * @brief Remote control listener task.
+ *
+ * Polls RcLink at a fixed cadence and publishes RcSnapshot frames. With
+ * cfg::rc::DIVERSITY a second receiver is polled too and the freshest valid
+ * one feeds each frame (tagged via RcSnapshot::source). A one-shot
+ * esp_timer is re-armed on every valid frame; when it expires the task is
+ * woken immediately and publishes failsafe, instead of waiting for the next poll.
  */
 class RcPublisher
 {
@@ -36,31 +51,76 @@ public:
                          uint32_t min_interval_ms = 0) noexcept;
 
     /**
-     * @brief Configure RCLink (axes, switches, etc.).
+     * @brief Configure RCLink (axes, switches, etc.) on every receiver, arm the watchdog and start the publisher task.
      */
     void begin() noexcept;
 
+    /**
+     * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
+     */
+    static inline void task(void *self) noexcept
+    {
+        static_cast<RcPublisher *>(self)->run();
+    }
+
+    /**
+     * @brief One poll: read the receiver(s) and publish an RcSnapshot if the change gate or heartbeat allows.
+     * @note run() calls this every period and on a watchdog wake; the host check calls it directly.
+     */
+    void step() noexcept;
+
 private:
     // ---- Aliases ---- //
-    using Transport = rc::RcIbusTransport;
+    using Transport = RcSelectedTransport; ///< Chosen by cfg::rc::PROTOCOL.
     using Link = rc::RcLink<Transport, RC>;
+    using Lut = rcmap::Bank<static_cast<size_t>(RC::Count)>;
+    using Filters = rcmap::FilterBank<static_cast<size_t>(RC::Count)>;
+    using Predictors = rcmap::PredictorBank<static_cast<size_t>(RC::Count), cfg::rc::PREDICT_FRAMES>;
 
-    // ---- Internal state ---- //
-    Transport ibus_{};           ///< iBUS transport (must outlive Link).
-    Link rclink_{ibus_};         ///< RcLink bound to iBUS.
-    TickType_t period_ms_{0};    ///< Delay (in ticks) between loop iterations.
-    float eps_{};                ///< Change gate: publish when any |delta| exceeds this (0.0f = always publish).
-    uint32_t min_interval_ms_{}; ///< Heartbeat interval (milliseconds): publish at least this often (0 = disabled).
+    /// @brief Main run loop.
+    void run() noexcept;
+
+    /// @brief Re-arm the frame-arrival watchdog (called on every valid frame).
+    void arm_watchdog() noexcept;
 
-    // ---- Reader that adapts RcLink to SnapshotRTOS ---- //
+    /// @brief esp_timer callback: link went quiet → wake the publisher task.
+    static void on_watchdog(void *self) noexcept;
+
+    static constexpr size_t kReceivers = cfg::rc::DIVERSITY ? 2 : 1; ///< Receivers merged per frame.
+
+    // ---- Reader that adapts RcLink to the publisher ---- //
     struct Reader
     {
-        Link *link{nullptr}; ///< RcLink instance that already speaks iBUS and maps channels to RC roles.
+        Link *links[kReceivers]{};          ///< RcLink per receiver (primary, then secondary); each maps channels to RC roles.
+        const Lut *lut{nullptr};            ///< Precomputed per-role mapping (raw µs → fixed-point output).
+        Filters *filt{nullptr};             ///< Per-role filter chains applied after mapping (shared by both receivers).
+        Predictors *pred{nullptr};          ///< Per-role gap extrapolation applied before filtering.
+        rcmap::Diversity<kReceivers> div{}; ///< Freshest-healthy receiver selection.
+        bool fresh{false};                  ///< True if the last update() delivered a new frame.
+        uint64_t poll_us{0};                ///< Time of the last update().
+        bool predicted{false};              ///< True if the last read() extrapolated any axis.
 
-        /// @brief Poll the receiver and decode fresh bytes.
-        void update()
+        /// @brief Poll every receiver and pick the freshest valid one. Returns true if a new frame arrived.
+        bool update()
         {
-            link->update(); ///< Pull latest data from UART and refesh RcLink's frame/state.
+            bool up[kReceivers];
+            const uint64_t t = now_us();
+            poll_us = t;
+            fresh = false;
+
+            for (size_t i = 0; i < kReceivers; ++i)
+            {
+                const bool got = links[i]->update(); ///< Pull latest data from UART and refresh RcLink's frame/state.
+                up[i] = healthy(i);
+                if (got && up[i])
+                {
+                    div.seen(i, t);
+                    fresh = true;
+                }
+            }
+
+            div.select(up); ///< Diversity: freshest healthy receiver wins.
+            return fresh;
         }
 
         /// @brief Copy channels in the publish buffer.
@@ -69,20 +129,71 @@ private:
             if (!dst || n == 0)
                 return; ///< No destination / nothing to write.
 
-            const auto fr = link->frame();                   ///< Current mapped values.
-            const size_t M = static_cast<size_t>(RC::Count); ///< Total channels defined by RC enum.
-            const size_t m = (n < M) ? n : M;                ///< Copy only what fits into dst (destination).
+            const auto fr = links[div.active()]->frame();        ///< Current raw values (µs, per role).
+            constexpr size_t M = static_cast<size_t>(RC::Count); ///< Total channels defined by RC enum.
+            const size_t m = (n < M) ? n : M;                    ///< Copy only what fits into dst (destination).
+
+            // One indexed load per channel: raw µs → fixed-point engineering units.
+            int16_t mapped[M];
+            lut->map(fr.vals, mapped, m);
 
-            // RcLink stores channels values as int16_t → publish as float (avoids per channel scaling).
-            for (size_t i = 0; i < m; ++i)
-                dst[i] = static_cast<float>(fr.vals[i]); ///< int16_t → float.
+            // Bridge missed frames, then filter in fixed-point; failsafe values bypass both so they land immediately.
+            predicted = false;
+            if (ok())
+            {
+                predicted = pred->apply(mapped, m, fresh, poll_us);
+                filt->apply(mapped, m);
+            }
+            else
+            {
+                pred->reset(mapped, m);
+                filt->reset(mapped, m);
+            }
+
+            rcmap::to_float(mapped, dst, m, rcmap::kLsb); ///< Batch fixed-point → float.
         }
 
-        /// @brief Health check: true → link is OK (not in failsafe).
-        bool ok() const
+        /// @brief Health check: true → selected link is OK (not in failsafe).
+        bool ok() const { return healthy(div.active()); }
+
+        /// @brief Source tag for the selected receiver.
+        RcSource source() const { return div.active() == 0 ? RcSource::Primary : RcSource::Secondary; }
+
+        /// @brief True if receiver @p i is not asserting failsafe.
+        bool healthy(size_t i) const
         {
-            const auto &st = link->status();                   ///< Current RX/protocol status.
+            const auto &st = links[i]->status();               ///< Current RX/protocol status.
             return !(st.rx_failsafe_sig || st.proto_failsafe); ///< If either asserts failsafe → not OK.
         }
     };
+
+    // ---- Task parameters ---- //
+    static constexpr uint32_t kStack = 4096;    ///< Stack size (words → ~16 KB).
+    static constexpr UBaseType_t kPriority = 2; ///< Task priority.
+
+    /// @brief One receiver: its transport and the RcLink bound to it (raw µs pass-through).
+    struct Receiver
+    {
+        Transport rx{}; ///< Receiver transport (declared first: must outlive link).
+        Link link{rx};  ///< RcLink bound to rx.
+    };
+
+    // ---- Internal state ---- //
+    std::array<Receiver, kReceivers> rx_{};    ///< Primary, then the secondary when cfg::rc::DIVERSITY.
+    Lut lut_{};                                ///< Per-role raw → output tables (compiled in begin()).
+    Filters filters_{};                        ///< Per-role fixed-point filter chains (state lives here, not in Reader).
+    Predictors predictors_{cfg::rc::FRAME_US}; ///< Per-axis gap extrapolation state.
+    Reader reader_{};                          ///< RcLink → float channel adapter.
+    uint32_t period_ms_{0};                    ///< Poll period (milliseconds).
+    float eps_{};                              ///< Change gate: publish when any |delta| exceeds this (0.0f = always publish).
+    uint32_t min_interval_ms_{};               ///< Heartbeat interval (milliseconds): publish at least this often (0 = disabled).
+
+    TaskHandle_t task_{nullptr};         ///< Publisher task (watchdog notification target).
+    esp_timer_handle_t wd_{nullptr};     ///< One-shot frame-arrival watchdog.
+    std::atomic<bool> wd_expired_{true}; ///< True until the first frame, and after each expiry.
+    uint64_t last_frame_us_{0};          ///< Arrival time of the last valid frame.
+
+    RcSnapshot fs_frame_{}; ///< Precomputed failsafe frame (published on watchdog expiry).
+    RcSnapshot last_pub_{}; ///< Last published frame (change gate reference).
+    bool has_pub_{false};   ///< True once last_pub_ is valid.
 };
\ No newline at end of file
@@ -0,0 +1,30 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of the SBUS / CRSF UART transports.
+ *
+ * @file RcTransports.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "RcTransports.h"
+
+// SBUS: 8E2, inverted line (no external inverter needed on ESP32).
+template <>
+void RcUartTransport<rcproto::SbusParser>::begin(HardwareSerial &port, uint32_t baud, int rx, int tx) noexcept
+{
+    port_ = &port;
+    port.setRxBufferSize(256);
+    port.begin(baud, SERIAL_8E2, rx, tx, /*invert=*/true);
+}
+
+// CRSF: 8N1, non-inverted; TX only needed for telemetry back to the receiver.
+template <>
+void RcUartTransport<rcproto::CrsfParser>::begin(HardwareSerial &port, uint32_t baud, int rx, int tx) noexcept
+{
+    port_ = &port;
+    port.setRxBufferSize(512); ///< ~12 ms of 420 kbaud traffic.
+    port.begin(baud, SERIAL_8N1, rx, tx);
+}
@@ -0,0 +1,131 @@
+/**
+ * MIT License
+ *
+ * @brief High-rate receiver transports (SBUS, CRSF) for RcLink, plus compile-time selection.
+ *
+ * @file RcTransports.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <cstdint>
+#include <cstddef>
+#include <RCLink.h>
+#include <RcParsers.h>
+
+/**
+ * @brief UART-backed transport around a streaming parser.
+ *
+ * Exposes the same surface RcLink drives on rc::RcIbusTransport: begin() opens
+ * the UART, poll() drains it and reports a fresh frame, channel()/failsafe()
+ * expose the decoded frame.
+ *
+ * @tparam Parser Byte-at-a-time protocol parser (rcproto::SbusParser / CrsfParser).
+ */
+template <typename Parser>
+class RcUartTransport
+{
+public:
+    /**
+     * @brief Open the UART with the protocol's framing.
+     *
+     * @param port Hardware UART (e.g. Serial2).
+     * @param baud Baud rate (see cfg::rc::BAUD).
+     * @param rx RX pin.
+     * @param tx TX pin (-1 → unused).
+     */
+    void begin(HardwareSerial &port, uint32_t baud, int rx, int tx) noexcept;
+
+    /**
+     * @brief Drain pending UART bytes through the parser.
+     * @return true if at least one complete, valid frame was decoded.
+     */
+    bool poll() noexcept
+    {
+        if (!port_)
+            return false;
+
+        bool fresh = false;
+        uint8_t buf[kChunk];
+
+        for (int avail = port_->available(); avail > 0; avail = port_->available())
+        {
+            const size_t n = port_->read(buf, (static_cast<size_t>(avail) < kChunk) ? static_cast<size_t>(avail) : kChunk);
+            for (size_t i = 0; i < n; ++i)
+                fresh |= parser_.push(buf[i]);
+        }
+
+        if (fresh)
+            last_frame_us_ = now_us();
+        return fresh;
+    }
+
+    /// @brief Number of channels carried per frame.
+    [[nodiscard]] size_t channels() const noexcept { return parser_.count(); }
+
+    /// @brief Channel @p i of the last frame (µs).
+    [[nodiscard]] int16_t channel(size_t i) const noexcept { return parser_.channels_us()[i]; }
+
+    /// @brief Protocol-level failsafe indication.
+    [[nodiscard]] bool failsafe() const noexcept { return parser_.failsafe(); }
+
+    /// @brief Arrival time of the last valid frame (µs since boot).
+    [[nodiscard]] uint64_t last_frame_us() const noexcept { return last_frame_us_; }
+
+    /// @brief Parser access (statistics, link telemetry).
+    [[nodiscard]] const Parser &parser() const noexcept { return parser_; }
+
+private:
+    static constexpr size_t kChunk = 64; ///< Bytes pulled from the UART per read().
+
+    HardwareSerial *port_{nullptr}; ///< Non-owning UART.
+    Parser parser_{};               ///< Streaming protocol parser.
+    uint64_t last_frame_us_{0};     ///< Arrival time of the last valid frame.
+};
+
+// UART framing differs per protocol (defined in RcTransports.cpp).
+template <>
+void RcUartTransport<rcproto::SbusParser>::begin(HardwareSerial &port, uint32_t baud, int rx, int tx) noexcept;
+template <>
+void RcUartTransport<rcproto::CrsfParser>::begin(HardwareSerial &port, uint32_t baud, int rx, int tx) noexcept;
+
+using RcSbusTransport = RcUartTransport<rcproto::SbusParser>; ///< SBUS (100 kbaud, 8E2, inverted).
+using RcCrsfTransport = RcUartTransport<rcproto::CrsfParser>; ///< CRSF (420 kbaud, 8N1).
+
+/// @brief Uplink link quality 0–100 % (255 when the protocol carries no telemetry).
+template <typename T>
+inline uint8_t rc_link_quality(const T &) noexcept { return 255; }
+
+/// @brief CRSF: LINK_STATISTICS uplink quality (255 until the first statistics frame, like the other protocols).
+inline uint8_t rc_link_quality(const RcCrsfTransport &t) noexcept
+{
+    return t.parser().has_link() ? t.parser().link().lq : 255;
+}
+
+/**
+ * @brief Transport type for a receiver protocol.
+ */
+template <cfg::rc::Protocol P>
+struct RcTransportFor
+{
+    using type = rc::RcIbusTransport;
+};
+
+template <>
+struct RcTransportFor<cfg::rc::Protocol::Sbus>
+{
+    using type = RcSbusTransport;
+};
+
+template <>
+struct RcTransportFor<cfg::rc::Protocol::Crsf>
+{
+    using type = RcCrsfTransport;
+};
+
+/// @brief Transport selected by cfg::rc::PROTOCOL.
+using RcSelectedTransport = typename RcTransportFor<cfg::rc::PROTOCOL>::type;
@@ -32,12 +32,15 @@ void StateManager::run() noexcept
 
     for (;;)
     {
-        buttons_->update(); ///< Update state.
+        {
+            const trace::Span span(trace::Track::StateManager); ///< Work only, not the sleep below.
+            buttons_->update();                                  ///< Update state.
 
-        InputState s{};                ///< Build a fresh snapshot.
-        buttons_->snapshot(s.buttons); ///< Copy debounced levels to bitset.
-        s.stamp_ms = millis();         ///< Timestamp (ms).
-        bus_->publish(s);              ///< Publish to the bus.
+            InputState s{};                ///< Build a fresh snapshot.
+            buttons_->snapshot(s.buttons); ///< Copy debounced levels to bitset.
+            s.stamp_ms = millis();         ///< Timestamp (ms).
+            bus_->publish(s);              ///< Publish to the bus.
+        }
 
         vTaskDelayUntil(&last_wake, loop_ticks_); ///< Pace loop.
     }
@@ -0,0 +1,131 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of the telemetry streamer.
+ *
+ * @file TelemetryStreamer.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "TelemetryStreamer.h"
+
+using telemetry::Stream;
+using telemetry::fixed;
+
+// Main run loop.
+void TelemetryStreamer::run() noexcept
+{
+    configASSERT(control_ != nullptr && out_ != nullptr); ///< Sanity check: bus and port must be valid.
+
+    TickType_t last_wake = xTaskGetTickCount();
+    uint64_t next_stats_us = now_us() + static_cast<uint64_t>(cfg::telemetry::STATS_MS) * 1000ULL;
+
+    for (;;)
+    {
+        const uint32_t hz = rate_hz_.load(std::memory_order_relaxed);
+        const uint8_t mask = streams_.load(std::memory_order_relaxed);
+        const uint64_t t = now_us();
+
+        int32_t v[telemetry::kMaxFields];
+        for (size_t i = 0; hz > 0 && i < static_cast<size_t>(Stream::Stats); ++i)
+        {
+            if ((mask & (1u << i)) == 0)
+                continue;
+            sample(static_cast<Stream>(i), v);
+            emit(static_cast<Stream>(i), t, v);
+        }
+
+        if (t >= next_stats_us)
+        {
+            v[0] = static_cast<int32_t>(sent());
+            v[1] = static_cast<int32_t>(dropped());
+            v[2] = static_cast<int32_t>(bytes_);
+            emit(Stream::Stats, t, v);
+            next_stats_us += static_cast<uint64_t>(cfg::telemetry::STATS_MS) * 1000ULL;
+        }
+
+        const TickType_t period = to_ticks_ms((hz > 0) ? 1000u / hz : cfg::telemetry::STATS_MS);
+        vTaskDelayUntil(&last_wake, (period > 0) ? period : 1);
+    }
+}
+
+// Snapshot → fixed-point fields, in TelemetryFormat.h order.
+void TelemetryStreamer::sample(Stream s, int32_t *v) const noexcept
+{
+    switch (s)
+    {
+    case Stream::Motor:
+    {
+        const MotorStateSnapshot m = buses::motor_state().peek();
+        v[0] = fixed(m.duty_pct, 2);
+        v[1] = fixed(m.speed_rpm, 1);
+        v[2] = fixed(m.battery_v, 3);
+        v[3] = fixed(m.motor_temp_c, 1);
+        v[4] = fixed(m.driver_temp_c, 1);
+        v[5] = static_cast<int32_t>(m.phase);
+        v[6] = m.limits;
+        v[7] = static_cast<int32_t>(m.dir);
+        v[8] = m.closed_loop;
+        break;
+    }
+    case Stream::Control:
+    {
+        const ControlSnapshot c = control_->peek();
+        v[0] = fixed(c.throttle_cmd_pct, 2);
+        v[1] = fixed(c.max_pct, 2);
+        v[2] = fixed(c.accel_pct_s, 1);
+        v[3] = c.drive_mode;
+        v[4] = static_cast<int32_t>(c.dir_cmd);
+        v[5] = c.brake_cmd;
+        v[6] = c.obstacle_guard;
+        break;
+    }
+    case Stream::Battery:
+    {
+        const BatterySnapshot b = buses::battery().peek();
+        v[0] = fixed(b.volts, 3);
+        v[1] = fixed(b.raw_volts, 3);
+        v[2] = b.low;
+        v[3] = b.valid;
+        break;
+    }
+    case Stream::Imu:
+    {
+        const ImuSnapshot i = buses::imu().peek();
+        v[0] = fixed(i.pitch_deg, 2);
+        v[1] = fixed(i.roll_deg, 2);
+        v[2] = fixed(i.yaw_rate_dps, 2);
+        v[3] = i.tipped;
+        v[4] = static_cast<int32_t>(i.overflows);
+        v[5] = i.valid;
+        break;
+    }
+    case Stream::Obstacle:
+    {
+        const ObstacleSnapshot o = buses::obstacle().peek();
+        v[0] = fixed(o.distance_m, 3);
+        v[1] = o.clear;
+        v[2] = o.valid;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// Non-blocking write: whole frame or nothing.
+void TelemetryStreamer::emit(Stream s, uint64_t t_us, const int32_t *v) noexcept
+{
+    const size_t n = enc_.encode(s, t_us, v, frame_);
+    if (out_->availableForWrite() < static_cast<int>(n))
+    {
+        enc_.invalidate(s); ///< Receiver's reference for s is now stale: resend absolute.
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    out_->write(frame_, n);
+    sent_.fetch_add(1, std::memory_order_relaxed);
+    bytes_ += static_cast<uint32_t>(n);
+}
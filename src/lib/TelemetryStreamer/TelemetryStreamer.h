@@ -0,0 +1,84 @@
+/**
+ * MIT License
+ *
+ * @brief Telemetry streamer: samples bus snapshots into COBS-framed delta records on a low-priority task.
+ *
+ * @file TelemetryStreamer.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <atomic>
+#include <ControlBus.h>
+#include <MotorStateBus.h>
+#include <BatteryBus.h>
+#include <ImuBus.h>
+#include <ObstacleBus.h>
+#include <TelemetryFormat.h>
+
+/**
+ * @brief Peeks the selected buses at a fixed rate and writes one record per stream.
+ *
+ * Only peeks, so the control tasks never wait on it. Writes never block
+ * either: a frame that does not fit in the port's transmit buffer is counted
+ * as dropped and that stream sends a keyframe next. Counters go out as a
+ * Stats record every cfg::telemetry::STATS_MS. Decode on the host with
+ * tools/telemetry/telemetry_to_csv.
+ */
+class TelemetryStreamer
+{
+public:
+    /**
+     * @brief Construct with control bus and output.
+     *
+     * @param control Control bus (the others are the buses:: singletons).
+     * @param out Port; must report availableForWrite() (HWCDC, HardwareSerial).
+     * @param rate_hz Records per second per stream.
+     * @param streams Bit per telemetry::Stream.
+     */
+    explicit TelemetryStreamer(ControlBus &control, Print &out = Serial, uint32_t rate_hz = cfg::telemetry::RATE_HZ,
+                               uint8_t streams = cfg::telemetry::STREAMS) noexcept
+        : control_(&control), out_(&out), rate_hz_(rate_hz), streams_(streams) {}
+
+    /// @brief Change the record rate (takes effect next period; 0 → pause).
+    void set_rate_hz(uint32_t hz) noexcept { rate_hz_.store(hz, std::memory_order_relaxed); }
+
+    /// @brief Change the stream selection (bit per telemetry::Stream).
+    void set_streams(uint8_t mask) noexcept { streams_.store(mask, std::memory_order_relaxed); }
+
+    [[nodiscard]] uint32_t sent() const noexcept { return sent_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint32_t dropped() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
+     */
+    static inline void task(void *self) noexcept
+    {
+        static_cast<TelemetryStreamer *>(self)->run();
+    }
+
+private:
+    /// @brief Main run loop.
+    void run() noexcept;
+
+    /// @brief Sample one stream into fixed-point values.
+    void sample(telemetry::Stream s, int32_t *v) const noexcept;
+
+    /// @brief Encode and write one record, or count it dropped.
+    void emit(telemetry::Stream s, uint64_t t_us, const int32_t *v) noexcept;
+
+    // ---- Internal state ---- //
+    ControlBus *control_{nullptr};                           ///< Non-owning control bus.
+    Print *out_{nullptr};                                    ///< Non-owning output port.
+    std::atomic<uint32_t> rate_hz_{0};                       ///< Records per second per stream.
+    std::atomic<uint8_t> streams_{0};                        ///< Selected streams.
+    telemetry::Encoder enc_{cfg::telemetry::KEYFRAME_EVERY}; ///< Delta state.
+    std::atomic<uint32_t> sent_{0};                          ///< Frames written.
+    std::atomic<uint32_t> dropped_{0};                       ///< Frames that did not fit.
+    uint32_t bytes_{0};                                      ///< Bytes written.
+    uint8_t frame_[telemetry::kMaxFrame]{};                  ///< Encode buffer.
+};
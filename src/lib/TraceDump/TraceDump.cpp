@@ -0,0 +1,84 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of the trace capture task and its task sampler.
+ *
+ * @file TraceDump.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "TraceDump.h"
+
+// Capture loop.
+void TraceDump::run() noexcept
+{
+    configASSERT(out_ != nullptr); ///< Sanity check: output must be valid.
+    configASSERT(begin_sampler()); ///< Timer group must be free.
+
+    vTaskDelay(to_ticks_ms(cfg::trace::START_MS));
+    for (;;)
+    {
+        for (TaskHandle_t &h : running_)
+            h = nullptr; ///< First sample names whatever each core is running.
+        trace::recorder.start();
+        timer_start(kGroup, kTimer);
+        while (!trace::recorder.full())
+            vTaskDelay(to_ticks_ms(50));
+        timer_pause(kGroup, kTimer);
+        trace::recorder.stop();
+        vTaskDelay(1); ///< Let a writer that claimed the last slot finish it.
+
+        debugfln("Trace: %u events, %lu dropped, dump follows", static_cast<unsigned>(trace::recorder.count()),
+                 static_cast<unsigned long>(trace::recorder.dropped()));
+        trace::recorder.dump([this](const uint8_t *p, size_t n)
+                             { out_->write(p, n); });
+        out_->flush();
+
+        if (cfg::trace::REARM_MS == 0)
+            break;
+        vTaskDelay(to_ticks_ms(cfg::trace::REARM_MS));
+    }
+    vTaskDelete(nullptr);
+}
+
+// ---- Task sampler ---- //
+
+// 1 µs counts, auto-reload every SAMPLE_US; started only while a capture is armed.
+bool TraceDump::begin_sampler() noexcept
+{
+    timer_config_t c{};
+    c.alarm_en = TIMER_ALARM_EN;
+    c.counter_en = TIMER_PAUSE;
+    c.intr_type = TIMER_INTR_LEVEL;
+    c.counter_dir = TIMER_COUNT_UP;
+    c.auto_reload = TIMER_AUTORELOAD_EN;
+    c.divider = 80; ///< 80 MHz APB → 1 MHz.
+    return timer_init(kGroup, kTimer, &c) == ESP_OK && timer_set_counter_value(kGroup, kTimer, 0) == ESP_OK &&
+           timer_set_alarm_value(kGroup, kTimer, cfg::trace::SAMPLE_US) == ESP_OK &&
+           timer_enable_intr(kGroup, kTimer) == ESP_OK &&
+           timer_isr_callback_add(kGroup, kTimer, &TraceDump::sample, this, 0) == ESP_OK; ///< Not IRAM: held off during flash writes.
+}
+
+// Interrupt context: no blocking, no printing.
+bool TraceDump::sample(void *self) noexcept
+{
+    if constexpr (cfg::trace::ENABLED)
+    {
+        TraceDump *d = static_cast<TraceDump *>(self);
+        for (BaseType_t core = 0; core < portNUM_PROCESSORS; ++core)
+        {
+            TaskHandle_t h = xTaskGetCurrentTaskHandleForCPU(core);
+            TaskHandle_t &last = d->running_[core];
+            if (h == last)
+                continue;
+            const uint8_t cpu = static_cast<uint8_t>(core);
+            if (last != nullptr)
+                trace::recorder.record(trace::Kind::TaskOut, trace::recorder.task_slot(last, nullptr), cpu);
+            trace::recorder.record(trace::Kind::TaskIn, trace::recorder.task_slot(h, pcTaskGetName(h)), cpu);
+            last = h;
+        }
+    }
+    return false; ///< No task woken.
+}
@@ -0,0 +1,67 @@
+/**
+ * MIT License
+ *
+ * @brief Trace capture task: arms the recorder, waits for it to fill, dumps it over serial.
+ *
+ * @file TraceDump.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <Trace.h>
+#include <driver/timer.h>
+
+/**
+ * @brief Captures trace::recorder and writes it to a Print in the binary dump format.
+ *
+ * Waits cfg::trace::START_MS (setup noise), captures until the buffer is
+ * full, then writes the dump (about 3 s for 4096 events at 115200 baud).
+ * Anything else printed meanwhile lands between records, so the host
+ * converter scans for the markers and checks the length. Convert with
+ * tools/trace/trace_to_perfetto. Only started in TRACING builds.
+ *
+ * Task interleaving comes from a timer interrupt that reads the running task
+ * of each core every cfg::trace::SAMPLE_US while a capture is armed, and
+ * records a TaskOut/TaskIn pair when it changes. The prebuilt Arduino-ESP32
+ * FreeRTOS has no switch hooks compiled in, so this is the supported way to
+ * see the cores; a switch shorter than one sample period can be missed.
+ */
+class TraceDump
+{
+public:
+    /**
+     * @brief Construct with output.
+     *
+     * @param out Serial port (or any Print) for the dump.
+     */
+    explicit TraceDump(Print &out = Serial) noexcept : out_(&out) {}
+
+    /**
+     * @brief FreeRTOS task trampoline. Call with `pvParameters = this`.
+     */
+    static inline void task(void *self) noexcept
+    {
+        static_cast<TraceDump *>(self)->run();
+    }
+
+private:
+    /// @brief Capture, dump, re-arm (or finish when REARM_MS is 0).
+    void run() noexcept;
+
+    /// @brief Set up the sampler timer (paused) with its interrupt on this core.
+    [[nodiscard]] bool begin_sampler() noexcept;
+
+    /// @brief Sampler interrupt: record each core whose running task changed.
+    static bool sample(void *self) noexcept;
+
+    static constexpr timer_group_t kGroup = static_cast<timer_group_t>(cfg::trace::SAMPLE_GROUP); ///< Sampler timer group.
+    static constexpr timer_idx_t kTimer = TIMER_0;                                                ///< Sampler timer.
+
+    // ---- Internal state ---- //
+    Print *out_{nullptr};                        ///< Non-owning dump output.
+    TaskHandle_t running_[portNUM_PROCESSORS]{}; ///< Task last seen on each core (sampler only).
+};
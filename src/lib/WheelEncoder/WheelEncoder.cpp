@@ -0,0 +1,77 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of WheelEncoder (PCNT wheel-speed sensor).
+ *
+ * @file WheelEncoder.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "WheelEncoder.h"
+
+// Configure PCNT: count rising edges of A; B low reverses the count (if wired).
+void WheelEncoder::begin() noexcept
+{
+    pcnt_config_t c{};
+    c.pulse_gpio_num = pin_;
+    c.ctrl_gpio_num = (pin_b_ >= 0) ? pin_b_ : PCNT_PIN_NOT_USED;
+    c.lctrl_mode = (pin_b_ >= 0) ? PCNT_MODE_REVERSE : PCNT_MODE_KEEP;
+    c.hctrl_mode = PCNT_MODE_KEEP;
+    c.pos_mode = PCNT_COUNT_INC;
+    c.neg_mode = PCNT_COUNT_DIS;
+    c.counter_h_lim = kWrap;
+    c.counter_l_lim = -kWrap;
+    c.unit = unit_;
+    c.channel = PCNT_CHANNEL_0;
+
+    configASSERT(pcnt_unit_config(&c) == ESP_OK); ///< Unit/pin must be free.
+    pcnt_set_filter_value(unit_, cfg::encoder::GLITCH_CYCLES);
+    pcnt_filter_enable(unit_);
+
+    pcnt_counter_pause(unit_);
+    pcnt_counter_clear(unit_);
+    pcnt_counter_resume(unit_);
+
+    est_.configure(ctl::SpeedEstimatorSpec{cfg::encoder::COUNTS_PER_REV, cfg::encoder::MIN_WINDOW_COUNTS,
+                                           cfg::encoder::MAX_WINDOW_S, cfg::encoder::SMOOTHING});
+    est_.reset();
+    last_ = 0;
+    total_ = 0;
+    position_ = 0;
+    sampled_ = 0;
+}
+
+// Current hardware count.
+int16_t WheelEncoder::read() const noexcept
+{
+    int16_t v = 0;
+    pcnt_get_counter_value(unit_, &v);
+    return v;
+}
+
+// Unwrap the hardware count into the position and running total.
+uint32_t WheelEncoder::read_counts() noexcept
+{
+    const int16_t now = read();
+    int32_t delta = static_cast<int32_t>(now) - last_;
+    if (delta > kWrap / 2)
+        delta -= kWrap; ///< Wrapped at −kWrap.
+    else if (delta < -kWrap / 2)
+        delta += kWrap; ///< Wrapped at +kWrap.
+    last_ = now;
+
+    position_ += delta;
+    total_ += static_cast<uint32_t>((delta < 0) ? -delta : delta);
+    return total_;
+}
+
+// One tick: counts since the previous tick into the estimator.
+float WheelEncoder::sample_rpm(float dt_s) noexcept
+{
+    const uint32_t total = read_counts();
+    const uint32_t delta = total - sampled_;
+    sampled_ = total;
+    return est_.update(delta, dt_s);
+}
@@ -0,0 +1,100 @@
+/**
+ * MIT License
+ *
+ * @brief Wheel-speed sensing: ISpeedSensor interface and a PCNT-backed encoder.
+ *
+ * @file WheelEncoder.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <driver/pcnt.h>
+#include <SpeedEstimator.h>
+
+/**
+ * @brief Anything that can report wheel speed once per control tick.
+ */
+class ISpeedSensor
+{
+public:
+    virtual ~ISpeedSensor() = default;
+
+    /**
+     * @brief Sample the sensor; call exactly once per control tick.
+     *
+     * @param dt_s Time since the previous call (s).
+     * @return Wheel speed (RPM, unsigned).
+     */
+    virtual float sample_rpm(float dt_s) noexcept = 0;
+
+    /**
+     * @brief Read the hardware counter now (may be called between ticks, same task).
+     * @return Unwrapped pulse total since begin().
+     */
+    virtual uint32_t read_counts() noexcept = 0;
+
+    /// @brief Total pulses as of the last read (odometry).
+    [[nodiscard]] virtual uint32_t total_counts() const noexcept = 0;
+
+    /// @brief Net signed pulses (+ = forward) as of the last read; only meaningful if has_direction().
+    [[nodiscard]] virtual int32_t position() const noexcept { return static_cast<int32_t>(total_counts()); }
+
+    /// @brief True if position() tracks direction (quadrature), not just distance.
+    [[nodiscard]] virtual bool has_direction() const noexcept { return false; }
+
+    /// @brief Counts per wheel revolution (sets the traction stage's resolution).
+    [[nodiscard]] virtual float counts_per_rev() const noexcept { return cfg::encoder::COUNTS_PER_REV; }
+};
+
+/**
+ * @brief Wheel encoder counted in hardware by a PCNT unit (no per-pulse interrupts).
+ *
+ * The counter wraps at ±kWrap; sample_rpm() reads it once per tick and unwraps
+ * the delta, so the CPU cost is one register read per tick. With a B channel the
+ * unit counts A's rising edges up or down by B's level (×1 quadrature), giving a
+ * signed position; speed and total_counts() stay unsigned.
+ */
+class WheelEncoder : public ISpeedSensor
+{
+public:
+    /**
+     * @brief Construct with pin and unit.
+     *
+     * @param pin Pulse input GPIO.
+     * @param pin_b Quadrature B GPIO (−1 → distance only).
+     * @param unit PCNT unit to claim.
+     */
+    explicit WheelEncoder(int pin = cfg::encoder::PIN, int pin_b = cfg::encoder::PIN_B,
+                          pcnt_unit_t unit = PCNT_UNIT_0) noexcept
+        : pin_(pin), pin_b_(pin_b), unit_(unit) {}
+
+    /**
+     * @brief Configure the PCNT unit and start counting.
+     */
+    void begin() noexcept;
+
+    float sample_rpm(float dt_s) noexcept override;
+    uint32_t read_counts() noexcept override;
+    [[nodiscard]] uint32_t total_counts() const noexcept override { return total_; }
+    [[nodiscard]] int32_t position() const noexcept override { return position_; }
+    [[nodiscard]] bool has_direction() const noexcept override { return pin_b_ >= 0; }
+
+private:
+    /// @brief Current hardware count (−kWrap+1..kWrap-1).
+    [[nodiscard]] int16_t read() const noexcept;
+
+    static constexpr int16_t kWrap = 30000; ///< PCNT limit (±); counter resets to 0 here.
+
+    int pin_{-1};                   ///< Pulse input.
+    int pin_b_{-1};                 ///< Direction input (−1 → none).
+    pcnt_unit_t unit_{PCNT_UNIT_0}; ///< Claimed PCNT unit.
+    int16_t last_{0};               ///< Hardware count at the previous read.
+    uint32_t total_{0};             ///< Unwrapped pulse total.
+    int32_t position_{0};           ///< Unwrapped signed position.
+    uint32_t sampled_{0};           ///< Total at the previous sample_rpm().
+    ctl::SpeedEstimator est_{};     ///< Counts → RPM.
+};
@@ -14,6 +14,14 @@
 #include <RcPublisher/RcPublisher.h>
 #include <ControlCore/ControlCore.h>
 #include <PowerDriveHandler/PowerDriveHandler.h>
+#include <WheelEncoder/WheelEncoder.h>
+#include <BatteryMonitor/BatteryMonitor.h>
+#include <PwmControl/PwmControl.h>
+#include <ImuService/ImuService.h>
+#include <ObstacleRanger/ObstacleRanger.h>
+#include <TraceDump/TraceDump.h>
+#include <TelemetryStreamer/TelemetryStreamer.h>
+#include <EventLogger/EventLogger.h>
 
 /**
  * @brief Constants and type definitions.
@@ -22,10 +30,24 @@
 constexpr int SM_STACK = 2048;  ///< Memory allocated to state manager (~8 KB).
 constexpr int CC_STACK = 4096;  ///< Memory allocated to control core (~16 KB).
 constexpr int PDH_STACK = 4096; ///< Memory allocated to power drive handler (~16 KB).
+constexpr int BAT_STACK = 2048; ///< Memory allocated to battery monitor (~8 KB).
+constexpr int IMU_STACK = 3072; ///< Memory allocated to IMU service (~12 KB, drain buffer on the object).
+constexpr int OBS_STACK = 2048; ///< Memory allocated to obstacle ranger (~8 KB).
+constexpr int TRC_STACK = 2048; ///< Memory allocated to trace dump (~8 KB).
+constexpr int TLM_STACK = 3072; ///< Memory allocated to telemetry streamer (~12 KB).
+constexpr int LOG_STACK = 2048; ///< Memory allocated to event logger (~8 KB).
+constexpr int GSV_STACK = 3072; ///< Memory allocated to gain saver (~12 KB, NVS write).
 
 constexpr UBaseType_t SM_PRI = 1;  ///< Task priority 1.
 constexpr UBaseType_t CC_PRI = 2;  ///< Task priority 2.
 constexpr UBaseType_t PDH_PRI = 3; ///< Task priority 3.
+constexpr UBaseType_t BAT_PRI = 1; ///< Task priority 1.
+constexpr UBaseType_t IMU_PRI = 1; ///< Task priority 1.
+constexpr UBaseType_t OBS_PRI = 2; ///< Task priority 2 (publishes the moment an echo ends).
+constexpr UBaseType_t TRC_PRI = 1; ///< Task priority 1 (dumps in the background).
+constexpr UBaseType_t TLM_PRI = 0; ///< Task priority 0 (below every control task, shares with idle).
+constexpr UBaseType_t LOG_PRI = 0; ///< Task priority 0 (prints events after the tasks that raised them).
+constexpr UBaseType_t GSV_PRI = 0; ///< Task priority 0 (flash writes in the background).
 
 /**
  * @brief Global RTOS handles and queues.
@@ -33,6 +55,13 @@ constexpr UBaseType_t PDH_PRI = 3; ///< Task priority 3.
 TaskHandle_t sm_t = nullptr;  ///< State manager logic task handle.
 TaskHandle_t cc_t = nullptr;  ///< Control core logic task handle.
 TaskHandle_t pdh_t = nullptr; ///< Power drive handler logic task handle.
+TaskHandle_t bat_t = nullptr; ///< Battery monitor task handle.
+TaskHandle_t imu_t = nullptr; ///< IMU service task handle.
+TaskHandle_t obs_t = nullptr; ///< Obstacle ranger task handle.
+TaskHandle_t trc_t = nullptr; ///< Trace dump task handle.
+TaskHandle_t tlm_t = nullptr; ///< Telemetry streamer task handle.
+TaskHandle_t log_t = nullptr; ///< Event logger task handle.
+TaskHandle_t gsv_t = nullptr; ///< Gain saver task handle.
 
 void setup()
 {
@@ -51,21 +80,77 @@ void setup()
                                    cfg::button::BTN_LONG_MS};
   static Button btnHandler = makeButtons(kTiming);
 
-  // ---- Motor setup ---- //
-  static Motor driveMotor;
-
-  MotorMCPWMConfig hw{};
-  hw.rpwm_pin = cfg::motor::RPWM_PIN;
-  hw.lpwm_pin = cfg::motor::LPWM_PIN;
-  hw.en_pin = cfg::motor::EN_PIN;
-
-  driveMotor.setup(hw);
+  // ---- Motor setup (one per cfg::motor::WHEELS entry, timer i of MCPWM_UNIT) ---- //
+  static Motor driveMotors[cfg::motor::WHEEL_COUNT];
+  PowerDriveHandler::Wheel wheels[cfg::motor::WHEEL_COUNT];
+
+  for (size_t i = 0; i < cfg::motor::WHEEL_COUNT; ++i)
+  {
+    const cfg::motor::Wheel &w = cfg::motor::WHEELS[i];
+    MotorMCPWMConfig hw{};
+    hw.unit = static_cast<mcpwm_unit_t>(cfg::motor::MCPWM_UNIT);
+    hw.timer = static_cast<mcpwm_timer_t>(i);
+    hw.rpwm_pin = w.rpwm_pin;
+    hw.lpwm_pin = w.lpwm_pin;
+    hw.en_pin = w.en_pin;
+    hw.freq_hz = cfg::motor::PWM_LOW_DUTY_HZ; ///< Start in the low-duty region; PowerDriveHandler adapts it.
+
+    driveMotors[i].setup(hw);
+    wheels[i] = PowerDriveHandler::Wheel{&driveMotors[i], w.side};
+  }
 
   // ---- Managers ---- //
   static StateManager sm(btnHandler, inputBus); ///< Defaults to cfg::tick::LOOP_MS.
   static RcPublisher rcp;
   static ControlCore cc(inputBus, controlBus);
-  static PowerDriveHandler pdh(driveMotor, controlBus); ///< Defaults to cfg::tick::LOOP_MS.
+  static PowerDriveHandler pdh(wheels, cfg::motor::WHEEL_COUNT, controlBus, buses::motor_state()); ///< Defaults to cfg::tick::LOOP_MS.
+  pdh.attach_events(buses::events()); ///< Obstacle cuts and autotune progress, printed by EventLogger.
+  cc.attach_events(buses::events());  ///< Drive mode changes.
+
+  // ---- Battery monitor (optional; needs the divider on cfg::battery::PIN) ---- //
+  static BatteryMonitor battery(buses::battery());
+  if (cfg::battery::ENABLED)
+  {
+    battery.begin();
+    pdh.attach_battery(buses::battery());
+  }
+
+  // ---- PWM carrier control (every wheel's timer, synced to timer 0) ---- //
+  static McpwmFrequency pwmFreq;
+  configASSERT(pwmFreq.sync_timers());
+  pdh.attach_pwm_frequency(pwmFreq);
+
+  // ---- Wheel encoder (optional) ---- //
+  static WheelEncoder wheelEncoder;
+  if (cfg::encoder::ENABLED)
+  {
+    wheelEncoder.begin();
+    pdh.attach_speed_sensor(wheelEncoder);
+  }
+
+  // ---- Autotune results (optional; saved to NVS by GainSaver) ---- //
+  static GainSaver gainSaver(buses::tune(), buses::motor_state());
+  const bool tuneUp = cfg::encoder::ENABLED && cfg::speed::TUNE_ENABLED;
+  if (tuneUp)
+    pdh.attach_tune(buses::tune());
+
+  // ---- IMU (optional; synthetic source when no sensor is fitted) ---- //
+  static Mpu6050Fifo mpu;
+  static FakeImu fakeImu;
+  static ImuService imu(cfg::imu::FAKE ? static_cast<IImuSource &>(fakeImu) : static_cast<IImuSource &>(mpu),
+                        buses::imu());
+  const bool imuUp = cfg::imu::ENABLED && imu.begin();
+  if (cfg::imu::ENABLED && !imuUp)
+    debugln("IMU: no answer, attitude disabled");
+
+  // ---- Obstacle ranger (optional; guard switched by RC::obstacle) ---- //
+  static UltrasonicRanger ranger(buses::obstacle());
+  cc.attach_rc(buses::rc());
+  if (cfg::obstacle::ENABLED)
+  {
+    ranger.begin();
+    pdh.attach_obstacle(buses::obstacle());
+  }
 
   // ---- Start publishers ---- //
   rcp.begin();
@@ -75,8 +160,43 @@ void setup()
   delay(50);
   configASSERT(xTaskCreatePinnedToCore(ControlCore::task, "ControlCore", CC_STACK, &cc, CC_PRI, &cc_t, /*Core=*/0) == pdPASS);
   delay(50);
+  if (cfg::battery::ENABLED)
+  {
+    configASSERT(xTaskCreatePinnedToCore(BatteryMonitor::task, "Battery", BAT_STACK, &battery, BAT_PRI, &bat_t, /*Core=*/0) == pdPASS);
+    delay(50);
+  }
+  if (imuUp)
+  {
+    configASSERT(xTaskCreatePinnedToCore(ImuService::task, "IMU", IMU_STACK, &imu, IMU_PRI, &imu_t, /*Core=*/0) == pdPASS);
+    delay(50);
+  }
+  if (cfg::obstacle::ENABLED)
+  {
+    configASSERT(xTaskCreatePinnedToCore(UltrasonicRanger::task, "Obstacle", OBS_STACK, &ranger, OBS_PRI, &obs_t, /*Core=*/0) == pdPASS);
+    delay(50);
+  }
   configASSERT(xTaskCreatePinnedToCore(PowerDriveHandler::task, "PDHandler", PDH_STACK, &pdh, PDH_PRI, &pdh_t, /*Core=*/1) == pdPASS);
   delay(50);
+  if (tuneUp)
+  {
+    configASSERT(xTaskCreatePinnedToCore(GainSaver::task, "GainSaver", GSV_STACK, &gainSaver, GSV_PRI, &gsv_t, /*Core=*/0) == pdPASS);
+  }
+  if (cfg::telemetry::ENABLED)
+  {
+    static TelemetryStreamer telemetry(controlBus); ///< Binary records on Serial.
+    configASSERT(xTaskCreatePinnedToCore(TelemetryStreamer::task, "Telemetry", TLM_STACK, &telemetry, TLM_PRI, &tlm_t, /*Core=*/0) == pdPASS);
+  }
+  if (cfg::trace::ENABLED)
+  {
+    static TraceDump traceDump; ///< Task/bus trace over Serial (TRACING builds).
+    configASSERT(xTaskCreatePinnedToCore(TraceDump::task, "TraceDump", TRC_STACK, &traceDump, TRC_PRI, &trc_t, /*Core=*/0) == pdPASS);
+  }
+
+  if (DEBUGGING)
+  {
+    static EventLogger eventLog(buses::events()); ///< Failsafe / obstacle / autotune / mode edges, printed off the control tasks.
+    configASSERT(xTaskCreatePinnedToCore(EventLogger::task, "EventLog", LOG_STACK, &eventLog, LOG_PRI, &log_t, /*Core=*/0) == pdPASS);
+  }
 
   debugln("All RTOS tasks started!");
 }
@@ -0,0 +1,140 @@
+/**
+ * MIT License
+ *
+ * @brief IMU sample type and a complementary filter for pitch/roll.
+ *
+ * @file Attitude.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+namespace ctl
+{
+    /**
+     * @brief One IMU sample in body axes (x forward, y left, z up).
+     */
+    struct ImuSample
+    {
+        float ax{0.0f}; ///< Acceleration x (g).
+        float ay{0.0f}; ///< Acceleration y (g).
+        float az{1.0f}; ///< Acceleration z (g).
+        float gx{0.0f}; ///< Rate about x, roll (°/s).
+        float gy{0.0f}; ///< Rate about y, pitch (°/s).
+        float gz{0.0f}; ///< Rate about z, yaw (°/s).
+    };
+
+    /**
+     * @brief Gyro-integrated attitude, pulled towards the accelerometer's gravity vector.
+     *
+     * angle = α·(angle + rate·dt) + (1 − α)·accel_angle with α = τ/(τ + T): the gyro
+     * is trusted for changes faster than τ, gravity for anything slower (so gyro
+     * drift never accumulates). Samples arrive in FIFO batches: the gyro is
+     * integrated per sample, but gravity is the batch mean and the correction is
+     * applied once per batch (T = batch length), so the trig cost does not grow
+     * with the sample rate. A mean more than gate_g away from 1 g is mostly vehicle
+     * acceleration, not gravity, and that batch is gyro-only. Pitch is nose-up
+     * positive, roll right-side-down positive.
+     */
+    class ComplementaryFilter
+    {
+    public:
+        /**
+         * @brief Set the crossover and the accelerometer trust gate.
+         *
+         * @param tau_s Crossover time constant (s).
+         * @param gate_g Reject accel when ||a| − 1| exceeds this (g).
+         */
+        void configure(float tau_s, float gate_g) noexcept
+        {
+            tau_s_ = tau_s;
+            gate_g_ = gate_g;
+        }
+
+        /**
+         * @brief Fold in a batch of evenly spaced samples.
+         *
+         * @param s Samples, oldest first.
+         * @param n Number of samples.
+         * @param dt_s Sample period (s).
+         */
+        void update(const ImuSample *s, size_t n, float dt_s) noexcept
+        {
+            if (n == 0)
+                return;
+
+            ImuSample mean{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+            float dpitch = 0.0f;
+            float droll = 0.0f;
+            for (size_t i = 0; i < n; ++i)
+            {
+                mean.ax += s[i].ax;
+                mean.ay += s[i].ay;
+                mean.az += s[i].az;
+                dpitch -= s[i].gy; ///< Nose-up turns x towards z: negative about y.
+                droll += s[i].gx;
+            }
+            const float inv = 1.0f / static_cast<float>(n);
+            mean.ax *= inv;
+            mean.ay *= inv;
+            mean.az *= inv;
+
+            const float a = sqrtf(mean.ax * mean.ax + mean.ay * mean.ay + mean.az * mean.az);
+            const bool trust = fabsf(a - 1.0f) <= gate_g_;
+
+            if (!primed_)
+            {
+                if (!trust)
+                    return; ///< Wait for a clean gravity reading to seed from.
+                pitch_ = accel_pitch(mean);
+                roll_ = accel_roll(mean);
+                primed_ = true;
+                return;
+            }
+
+            pitch_ += dpitch * dt_s;
+            roll_ += droll * dt_s;
+            if (trust)
+            {
+                const float t = static_cast<float>(n) * dt_s;
+                const float k = t / (tau_s_ + t); ///< 1 − α over the batch.
+                pitch_ += k * (accel_pitch(mean) - pitch_);
+                roll_ += k * (accel_roll(mean) - roll_);
+            }
+        }
+
+        [[nodiscard]] bool primed() const noexcept { return primed_; }
+        [[nodiscard]] float pitch_deg() const noexcept { return pitch_; }
+        [[nodiscard]] float roll_deg() const noexcept { return roll_; }
+
+        /// @brief Angle between body z and vertical (°), whichever way the car leans.
+        [[nodiscard]] float tilt_deg() const noexcept
+        {
+            const float c = cosf(pitch_ * kRad) * cosf(roll_ * kRad);
+            return acosf(fminf(fmaxf(c, -1.0f), 1.0f)) / kRad;
+        }
+
+        /// @brief Forget the estimate; the next trusted sample re-seeds it.
+        void reset() noexcept { primed_ = false; }
+
+    private:
+        static constexpr float kRad = 3.14159265f / 180.0f; ///< Degrees → radians.
+
+        static float accel_pitch(const ImuSample &s) noexcept
+        {
+            return atan2f(s.ax, sqrtf(s.ay * s.ay + s.az * s.az)) / kRad;
+        }
+        static float accel_roll(const ImuSample &s) noexcept { return atan2f(s.ay, s.az) / kRad; }
+
+        float tau_s_{0.5f};   ///< Crossover (s).
+        float gate_g_{0.15f}; ///< Accel trust band around 1 g.
+        bool primed_{false};  ///< False until seeded from gravity.
+        float pitch_{0.0f};   ///< Pitch (°).
+        float roll_{0.0f};    ///< Roll (°).
+    };
+} ///< Namespace ctl.
@@ -0,0 +1,190 @@
+/**
+ * MIT License
+ *
+ * @brief COBS byte stuffing, zig-zag varints and CRC-8 for framed binary streams.
+ *
+ * @file Cobs.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ctl
+{
+    /// @brief Worst-case COBS output for n input bytes (delimiter not included).
+    constexpr size_t cobs_max(size_t n) noexcept { return n + n / 254 + 1; }
+
+    /**
+     * @brief Encode so the output holds no zero byte; a 0x00 then ends the frame.
+     *
+     * @param in Payload.
+     * @param n Payload length.
+     * @param out At least cobs_max(n) bytes.
+     * @return Bytes written (delimiter not included).
+     */
+    inline size_t cobs_encode(const uint8_t *in, size_t n, uint8_t *out) noexcept
+    {
+        size_t code_at = 0; ///< Where the current block's length byte goes.
+        size_t o = 1;
+        uint8_t code = 1;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (in[i] != 0)
+            {
+                out[o++] = in[i];
+                ++code;
+            }
+            if (in[i] == 0 || code == 0xFF)
+            {
+                out[code_at] = code; ///< Close the block: a zero, or 254 data bytes.
+                code_at = o++;
+                code = 1;
+            }
+        }
+        out[code_at] = code;
+        return o;
+    }
+
+    /**
+     * @brief Decode one frame (delimiter already stripped).
+     *
+     * @param in Encoded bytes.
+     * @param n Encoded length.
+     * @param out At least n bytes (may alias in: decoding never writes ahead of reading).
+     * @return Payload length, or 0 if the frame is malformed.
+     */
+    inline size_t cobs_decode(const uint8_t *in, size_t n, uint8_t *out) noexcept
+    {
+        size_t i = 0;
+        size_t o = 0;
+        while (i < n)
+        {
+            const uint8_t code = in[i++];
+            if (code == 0 || i + code - 1 > n)
+                return 0;
+            for (uint8_t k = 1; k < code; ++k)
+                out[o++] = in[i++];
+            if (code != 0xFF && i < n)
+                out[o++] = 0;
+        }
+        return o;
+    }
+
+    /// @brief Signed → unsigned so small magnitudes either side of zero stay short.
+    constexpr uint32_t zigzag(int32_t v) noexcept
+    {
+        return (static_cast<uint32_t>(v) << 1) ^ static_cast<uint32_t>(v >> 31);
+    }
+
+    /// @brief Inverse of zigzag().
+    constexpr int32_t unzigzag(uint32_t v) noexcept
+    {
+        return static_cast<int32_t>(v >> 1) ^ -static_cast<int32_t>(v & 1);
+    }
+
+    /**
+     * @brief LEB128 varint: 7 bits per byte, high bit set while more follow.
+     * @return Bytes written (at most 10).
+     */
+    inline size_t put_varint(uint64_t v, uint8_t *out) noexcept
+    {
+        size_t n = 0;
+        while (v >= 0x80)
+        {
+            out[n++] = static_cast<uint8_t>(v | 0x80);
+            v >>= 7;
+        }
+        out[n++] = static_cast<uint8_t>(v);
+        return n;
+    }
+
+    /**
+     * @brief Read a varint written by put_varint().
+     *
+     * @param p Cursor (advanced past the varint).
+     * @param end One past the last readable byte.
+     * @param v Value read.
+     * @return false if the buffer ended first or the varint is too long.
+     */
+    inline bool get_varint(const uint8_t *&p, const uint8_t *end, uint64_t &v) noexcept
+    {
+        if (p < end && *p < 0x80)
+        {
+            v = *p++; ///< One byte: the common case for deltas.
+            return true;
+        }
+        v = 0;
+        for (unsigned shift = 0; p < end && shift < 64; shift += 7)
+        {
+            const uint8_t b = *p++;
+            v |= static_cast<uint64_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    /// @brief CRC-8 (poly 0x07) lookup table, built at compile time.
+    constexpr std::array<uint8_t, 256> kCrc8Table = []
+    {
+        std::array<uint8_t, 256> t{};
+        for (size_t i = 0; i < 256; ++i)
+        {
+            uint8_t c = static_cast<uint8_t>(i);
+            for (int k = 0; k < 8; ++k)
+                c = static_cast<uint8_t>((c & 0x80) ? (c << 1) ^ 0x07 : (c << 1));
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    /// @brief CRC-8 (poly 0x07, init 0) over n bytes; 0 over data followed by its own CRC.
+    inline uint8_t crc8(const uint8_t *p, size_t n) noexcept
+    {
+        uint8_t c = 0;
+        for (size_t i = 0; i < n; ++i)
+            c = kCrc8Table[c ^ p[i]];
+        return c;
+    }
+
+    /**
+     * @brief cobs_decode() and crc8() in one pass (for high-rate host decoding).
+     *
+     * @param in Encoded bytes.
+     * @param n Encoded length.
+     * @param out At least n bytes (may alias in).
+     * @param crc CRC-8 of the decoded bytes.
+     * @return Payload length, or 0 if the frame is malformed.
+     */
+    inline size_t cobs_decode_crc8(const uint8_t *in, size_t n, uint8_t *out, uint8_t &crc) noexcept
+    {
+        size_t i = 0;
+        size_t o = 0;
+        uint8_t c = 0;
+        while (i < n)
+        {
+            const uint8_t code = in[i++];
+            if (code == 0 || i + code - 1 > n)
+                return 0;
+            for (uint8_t k = 1; k < code; ++k)
+            {
+                const uint8_t b = in[i++];
+                out[o++] = b;
+                c = kCrc8Table[c ^ b];
+            }
+            if (code != 0xFF && i < n)
+            {
+                out[o++] = 0;
+                c = kCrc8Table[c];
+            }
+        }
+        crc = c;
+        return o;
+    }
+} ///< Namespace ctl.
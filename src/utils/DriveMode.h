@@ -0,0 +1,62 @@
+/**
+ * MIT License
+ *
+ * @brief Drive modes (toddler/normal/sport) and the parent power knob.
+ *
+ * @file DriveMode.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ctl
+{
+    /**
+     * @brief What a drive mode allows.
+     */
+    struct DriveLimits
+    {
+        float max_pct{100.0f};    ///< Throttle ceiling (%).
+        float accel_pct_s{40.0f}; ///< Fastest rise of the throttle (%/s); slowing down is not limited here.
+    };
+
+    /**
+     * @brief Per-mode limits, resolved once so a mode change is an index, not a recalculation.
+     *
+     * @tparam N Number of modes (switch positions).
+     */
+    template <size_t N>
+    using DriveModeTable = std::array<DriveLimits, N>;
+
+    /**
+     * @brief Switch value → mode index (nearest position, clamped).
+     *
+     * @param v Mapped switch output (0, 1, 2, ...).
+     * @param n Number of positions.
+     */
+    [[nodiscard]] inline uint8_t mode_index(float v, size_t n) noexcept
+    {
+        if (!(v > 0.0f)) ///< Also catches NaN.
+            return 0;
+        const size_t i = static_cast<size_t>(v + 0.5f);
+        return static_cast<uint8_t>((i < n) ? i : n - 1);
+    }
+
+    /**
+     * @brief Limits for a mode with the power knob applied on top.
+     *
+     * @param mode Mode limits (from the table).
+     * @param power_pct Knob position (0..100 %): scales the ceiling, never raises it.
+     */
+    [[nodiscard]] inline DriveLimits apply_power(const DriveLimits &mode, float power_pct) noexcept
+    {
+        const float k = (power_pct > 0.0f) ? ((power_pct < 100.0f) ? power_pct * 0.01f : 1.0f) : 0.0f;
+        return {mode.max_pct * k, mode.accel_pct_s};
+    }
+} ///< Namespace ctl.
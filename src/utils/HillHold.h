@@ -0,0 +1,125 @@
+/**
+ * MIT License
+ *
+ * @brief Hill-hold: detect rollback at rest and find the least duty that stops it.
+ *
+ * @file HillHold.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace ctl
+{
+    /**
+     * @brief Hill-hold settings (counts are encoder pulses).
+     */
+    struct HillHoldSpec
+    {
+        float roll_counts{2.0f}; ///< Rollback that engages the hold.
+        float kp_pct{4.0f};      ///< Holding duty per count of rollback (%).
+        float ki_pct_s{20.0f};   ///< Holding duty added per count per second (%/s).
+        float max_pct{35.0f};    ///< Holding duty ceiling (%).
+        float max_hold_s{8.0f};  ///< Give up and brake after this long (winding is stalled, I²R only).
+    };
+
+    /**
+     * @brief Position hold against the last travel direction, run once per drive tick.
+     *
+     * Armed as soon as the command goes to zero. Counts against the travel
+     * direction are rollback; past roll_counts a PI on the rollback distance drives
+     * duty in the travel direction, starting from whatever duty was still applied.
+     * The integrator ends up carrying the slope, so the hold settles on the least
+     * duty that stops the car, and counts with the travel direction (pushed too far
+     * uphill) wind it back down.
+     *
+     * Needs signed counts: with one encoder channel, overshoot uphill looks exactly
+     * like more rollback and the hold runs away.
+     */
+    class HillHold
+    {
+    public:
+        enum class State : uint8_t
+        {
+            Off = 0, ///< Driving, or hold not armed.
+            Armed,   ///< Command zero, watching for rollback.
+            Holding, ///< Driving the holding duty.
+            Released ///< Timed out; brake until the next drive.
+        };
+
+        void configure(const HillHoldSpec &s) noexcept { s_ = s; }
+
+        /// @brief Start watching (command zero; duty may still be ramping down).
+        void arm() noexcept
+        {
+            state_ = State::Armed;
+            rollback_ = 0.0f;
+            integ_ = 0.0f;
+            hold_pct_ = 0.0f;
+            held_s_ = 0.0f;
+        }
+
+        /// @brief Stop watching (drive command, reversal, tuning).
+        void disarm() noexcept
+        {
+            state_ = State::Off;
+            hold_pct_ = 0.0f;
+        }
+
+        /**
+         * @brief Advance one tick.
+         *
+         * @param back_counts Counts moved against the travel direction since the previous step (signed).
+         * @param applied_pct Duty applied last tick (%): the hold starts from it, not from zero.
+         * @param dt_s Tick period (s).
+         * @return Holding duty (%) to apply in the travel direction; 0 → leave it to the brake.
+         */
+        float step(int32_t back_counts, float applied_pct, float dt_s) noexcept
+        {
+            if (state_ != State::Armed && state_ != State::Holding)
+                return 0.0f;
+
+            rollback_ += static_cast<float>(back_counts);
+
+            if (state_ == State::Armed)
+            {
+                rollback_ = (rollback_ > 0.0f) ? rollback_ : 0.0f; ///< Still coasting on: nothing to hold yet.
+                if (rollback_ < s_.roll_counts)
+                    return 0.0f;
+                state_ = State::Holding;
+                integ_ = (applied_pct < s_.max_pct) ? applied_pct : s_.max_pct; ///< Already rolling back at this duty.
+            }
+
+            held_s_ += dt_s;
+            if (held_s_ > s_.max_hold_s)
+            {
+                state_ = State::Released;
+                hold_pct_ = 0.0f;
+                return 0.0f;
+            }
+
+            integ_ += s_.ki_pct_s * rollback_ * dt_s;
+            integ_ = (integ_ < 0.0f) ? 0.0f : ((integ_ > s_.max_pct) ? s_.max_pct : integ_);
+
+            const float u = s_.kp_pct * rollback_ + integ_;
+            hold_pct_ = (u < 0.0f) ? 0.0f : ((u > s_.max_pct) ? s_.max_pct : u);
+            return hold_pct_;
+        }
+
+        [[nodiscard]] State state() const noexcept { return state_; }
+        [[nodiscard]] bool holding() const noexcept { return state_ == State::Holding; }
+        [[nodiscard]] float hold_pct() const noexcept { return hold_pct_; } ///< Last holding duty (%).
+
+    private:
+        HillHoldSpec s_{};        ///< Settings.
+        State state_{State::Off}; ///< Progress.
+        float rollback_{0.0f};    ///< Net counts rolled back since arming.
+        float integ_{0.0f};       ///< Integral term (%).
+        float hold_pct_{0.0f};    ///< Holding duty (%).
+        float held_s_{0.0f};      ///< Time spent holding (s).
+    };
+} ///< Namespace ctl.
@@ -0,0 +1,95 @@
+/**
+ * MIT License
+ *
+ * @brief Forward throttle cap from obstacle distance.
+ *
+ * @file ObstacleGuard.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+namespace ctl
+{
+    /**
+     * @brief Distance → cap curve.
+     */
+    struct ObstacleSpec
+    {
+        float slow_m{1.5f};    ///< Full throttle beyond this distance...
+        float stop_m{0.5f};    ///< ...falling linearly to 0 % here.
+        float limp_pct{30.0f}; ///< Cap when the reading is stale (sensor silent).
+        float brake_s{0.9f};   ///< Stopping distance per m/s of closing speed (brake to stop_m).
+    };
+
+    /**
+     * @brief Forward throttle cap (%) for a ranging result.
+     * @note The short-circuit brake slows the car in proportion to its speed, so
+     *       stopping takes about speed × brake_s. Once the gap past stop_m is
+     *       inside that, the cap is 0 % whatever the curve says.
+     *
+     * @param distance_m Measured distance (m).
+     * @param clear True → no echo in range.
+     * @param fresh False → reading too old to trust.
+     * @param s Curve.
+     * @param closing_mps Closing speed (m/s, from ClosingRate; 0 → distance only).
+     */
+    [[nodiscard]] inline float obstacle_cap_pct(float distance_m, bool clear, bool fresh, const ObstacleSpec &s,
+                                                float closing_mps = 0.0f) noexcept
+    {
+        if (!fresh)
+            return s.limp_pct;
+        if (clear)
+            return 100.0f;
+        if (distance_m <= s.stop_m + closing_mps * s.brake_s)
+            return 0.0f;
+        if (distance_m >= s.slow_m)
+            return 100.0f;
+        return 100.0f * (distance_m - s.stop_m) / (s.slow_m - s.stop_m);
+    }
+
+    /**
+     * @brief Closing speed from successive pings (no wheel sensor needed).
+     *
+     * Each new ping (by seq) is compared with the one before; a clear or
+     * missing echo restarts the estimate. Moving away reads as 0.
+     */
+    class ClosingRate
+    {
+    public:
+        /**
+         * @brief Fold in the latest ranging result (repeats of the same ping are ignored).
+         *
+         * @param distance_m Measured distance (m).
+         * @param in_range True → a valid, non-clear echo.
+         * @param seq Ping counter.
+         * @param stamp_us When the echo ended (µs).
+         * @return Closing speed (m/s, ≥ 0).
+         */
+        float update(float distance_m, bool in_range, uint32_t seq, uint64_t stamp_us) noexcept
+        {
+            if (seq == seq_)
+                return mps_;
+            mps_ = 0.0f;
+            if (in_range && have_ && stamp_us > stamp_us_)
+                mps_ = fmaxf((d_ - distance_m) / (static_cast<float>(stamp_us - stamp_us_) * 1e-6f), 0.0f);
+            have_ = in_range;
+            d_ = distance_m;
+            stamp_us_ = stamp_us;
+            seq_ = seq;
+            return mps_;
+        }
+
+    private:
+        float d_{0.0f};        ///< Previous distance (m).
+        uint64_t stamp_us_{0}; ///< Previous echo time (µs).
+        uint32_t seq_{0};      ///< Previous ping.
+        bool have_{false};     ///< Previous ping was in range.
+        float mps_{0.0f};      ///< Closing speed (m/s).
+    };
+} ///< Namespace ctl.
@@ -0,0 +1,109 @@
+/**
+ * MIT License
+ *
+ * @brief Discrete PID controller with feed-forward and anti-windup.
+ *
+ * @file Pid.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+namespace ctl
+{
+    /**
+     * @brief Controller gains (output units per input unit).
+     */
+    struct PidGains
+    {
+        float kp{0.0f};  ///< Proportional gain.
+        float ki{0.0f};  ///< Integral gain (per second).
+        float kd{0.0f};  ///< Derivative gain (seconds).
+        float kff{0.0f}; ///< Feed-forward: output per unit of setpoint.
+    };
+
+    /**
+     * @brief PID with derivative on measurement (no kick on setpoint steps) and
+     *        conditional integration (integrator frozen while saturated, and
+     *        optionally while the error is outside a band).
+     */
+    class Pid
+    {
+    public:
+        /// @brief Replace the gains (integrator is kept).
+        void set_gains(const PidGains &g) noexcept { g_ = g; }
+
+        /// @brief Output clamp.
+        void set_limits(float lo, float hi) noexcept
+        {
+            lo_ = lo;
+            hi_ = hi;
+        }
+
+        /**
+         * @brief Integrate only while |error| is within @p band (0 → always).
+         * @note Keeps a plant that lags a ramped setpoint (a heavy car pulling away)
+         *       from filling the integrator, which would otherwise come out as overshoot.
+         */
+        void set_integrator_band(float band) noexcept { band_ = band; }
+
+        [[nodiscard]] const PidGains &gains() const noexcept { return g_; }
+
+        /**
+         * @brief Advance one sample.
+         *
+         * @param sp Setpoint.
+         * @param pv Measured process value.
+         * @param dt_s Sample period (s).
+         * @return Clamped controller output.
+         */
+        float step(float sp, float pv, float dt_s) noexcept
+        {
+            const float e = sp - pv;
+            const float d = primed_ ? -(pv - last_pv_) / dt_s : 0.0f; ///< Derivative on measurement.
+            last_pv_ = pv;
+            primed_ = true;
+
+            const float base = g_.kff * sp + g_.kp * e + g_.kd * d;
+            const bool in_band = band_ <= 0.0f || (e <= band_ && e >= -band_);
+            const float i_next = in_band ? i_ + g_.ki * e * dt_s : i_;
+
+            float u = base + i_next;
+            if (u > hi_)
+            {
+                u = hi_;
+                if (e < 0.0f)
+                    i_ = i_next; ///< Only integrate back out of saturation.
+            }
+            else if (u < lo_)
+            {
+                u = lo_;
+                if (e > 0.0f)
+                    i_ = i_next;
+            }
+            else
+            {
+                i_ = i_next;
+            }
+            return u;
+        }
+
+        /// @brief Clear history; the next step starts from integrator @p i.
+        void reset(float i = 0.0f) noexcept
+        {
+            i_ = i;
+            primed_ = false;
+        }
+
+    private:
+        PidGains g_{};        ///< Gains.
+        float lo_{0.0f};      ///< Output lower clamp.
+        float hi_{100.0f};    ///< Output upper clamp.
+        float band_{0.0f};    ///< Integrate only within ±band of the setpoint (0 → always).
+        float i_{0.0f};       ///< Integrator (output units).
+        float last_pv_{0.0f}; ///< Previous measurement (derivative).
+        bool primed_{false};  ///< False until the first sample.
+    };
+} ///< Namespace ctl.
@@ -0,0 +1,99 @@
+/**
+ * MIT License
+ *
+ * @brief PWM frequency selection by operating region, and a switching-loss model.
+ *
+ * @file PwmFreqPolicy.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace ctl
+{
+    /**
+     * @brief Two-region frequency policy with hysteresis and a minimum dwell.
+     */
+    struct PwmFreqSpec
+    {
+        uint32_t low_duty_hz{20000}; ///< Below down_pct: fast, above hearing, low current ripple.
+        uint32_t high_duty_hz{8000}; ///< Above up_pct: slower, fewer switching losses.
+        float up_pct{60.0f};         ///< Switch to high_duty_hz above this duty...
+        float down_pct{45.0f};       ///< ...and back below this one (hysteresis).
+        uint16_t min_dwell{20};      ///< Ticks to stay in a region before switching again.
+    };
+
+    /**
+     * @brief Picks the PWM frequency for the present duty.
+     */
+    class PwmFreqPolicy
+    {
+    public:
+        void configure(const PwmFreqSpec &s) noexcept
+        {
+            s_ = s;
+            hz_ = s.low_duty_hz;
+            dwell_ = s.min_dwell;
+        }
+
+        /**
+         * @brief Advance one tick.
+         *
+         * @param duty_pct Highest applied duty (0..100).
+         * @return Frequency to run at (changes at most once per min_dwell ticks).
+         */
+        uint32_t select(float duty_pct) noexcept
+        {
+            if (dwell_ < s_.min_dwell)
+            {
+                ++dwell_;
+                return hz_;
+            }
+
+            const uint32_t want = (hz_ == s_.low_duty_hz) ? ((duty_pct > s_.up_pct) ? s_.high_duty_hz : hz_)
+                                                          : ((duty_pct < s_.down_pct) ? s_.low_duty_hz : hz_);
+            if (want != hz_)
+            {
+                hz_ = want;
+                dwell_ = 0;
+            }
+            return hz_;
+        }
+
+        [[nodiscard]] uint32_t hz() const noexcept { return hz_; }
+
+    private:
+        PwmFreqSpec s_{};    ///< Policy.
+        uint32_t hz_{20000}; ///< Current frequency.
+        uint16_t dwell_{0};  ///< Ticks since the last change.
+    };
+
+    /// @brief Estimated H-bridge losses at one operating point.
+    struct PwmLosses
+    {
+        float conduction_w{0.0f}; ///< I²·Rds(on): high side during duty, low side freewheeling otherwise.
+        float switching_w{0.0f};  ///< ½·V·I·(t_on + t_off)·f.
+    };
+
+    /**
+     * @brief Hard-switched half-bridge loss model (one edge pair per period).
+     *
+     * @param volts Supply voltage (V).
+     * @param amps Motor current (A).
+     * @param freq_hz PWM frequency (Hz).
+     * @param t_sw_s Rise + fall time per cycle (s); ~1–2 µs for BTS7960 slew-limited outputs.
+     * @param r_on_ohm Rds(on) of the conducting path (Ω).
+     */
+    [[nodiscard]] inline PwmLosses pwm_losses(float volts, float amps, float freq_hz, float t_sw_s,
+                                              float r_on_ohm) noexcept
+    {
+        PwmLosses l{};
+        l.conduction_w = amps * amps * r_on_ohm;
+        l.switching_w = 0.5f * volts * amps * t_sw_s * freq_hz;
+        return l;
+    }
+} ///< Namespace ctl.
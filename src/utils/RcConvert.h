@@ -0,0 +1,113 @@
+/**
+ * MIT License
+ *
+ * @brief Batch int16 → float conversion/scale kernel for RC frames.
+ *
+ * @file RcConvert.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace rcmap
+{
+    /**
+     * @brief Reference kernel: dst[i] = float(src[i]) * scale.
+     * @note Every path below performs the same two IEEE operations per element
+     *       (exact int → float, one rounded multiply), so outputs are bit-identical.
+     */
+    inline void to_float_scalar(const int16_t *src, float *dst, size_t n, float scale) noexcept
+    {
+        for (size_t i = 0; i < n; ++i)
+            dst[i] = static_cast<float>(src[i]) * scale;
+    }
+
+#if defined(__SSE2__)
+    /// @brief SSE2 kernel: 8 lanes per step (sign-extend → cvtdq2ps → mulps). Returns elements done.
+    inline size_t to_float_sse2(const int16_t *src, float *dst, size_t n, float scale) noexcept
+    {
+        const __m128 k = _mm_set1_ps(scale);
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+            const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+            _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), k));
+            _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), k));
+        }
+        return i;
+    }
+#endif
+
+#if defined(__ARM_NEON)
+    /// @brief NEON kernel: 8 lanes per step (vmovl → vcvt → vmul). Returns elements done.
+    inline size_t to_float_neon(const int16_t *src, float *dst, size_t n, float scale) noexcept
+    {
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            const int16x8_t v = vld1q_s16(src + i);
+            vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v))), scale));
+            vst1q_f32(dst + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v))), scale));
+        }
+        return i;
+    }
+#endif
+
+    /**
+     * @brief Unrolled FPU kernel (the ESP32-S3 path). Returns elements done.
+     * @note PIE vector lanes are integer-only, so float conversion stays on the scalar FPU;
+     *       four independent float.s/mul.s in flight hide their latency.
+     */
+    inline size_t to_float_unroll4(const int16_t *src, float *dst, size_t n, float scale) noexcept
+    {
+        size_t i = 0;
+        for (; i + 4 <= n; i += 4)
+        {
+            const float a = static_cast<float>(src[i + 0]);
+            const float b = static_cast<float>(src[i + 1]);
+            const float c = static_cast<float>(src[i + 2]);
+            const float d = static_cast<float>(src[i + 3]);
+            dst[i + 0] = a * scale;
+            dst[i + 1] = b * scale;
+            dst[i + 2] = c * scale;
+            dst[i + 3] = d * scale;
+        }
+        return i;
+    }
+
+    /**
+     * @brief Convert and scale a block of fixed-point channels to float.
+     * @note tools/rc/convert_check.cpp holds every kernel built for the host to to_float_scalar, bit for bit.
+     *
+     * @param src Fixed-point input (int16).
+     * @param dst Float output (may not alias src).
+     * @param n Number of channels.
+     * @param scale Engineering units per count.
+     */
+    inline void to_float(const int16_t *src, float *dst, size_t n, float scale) noexcept
+    {
+#if defined(__SSE2__)
+        const size_t i = to_float_sse2(src, dst, n, scale);
+#elif defined(__ARM_NEON)
+        const size_t i = to_float_neon(src, dst, n, scale);
+#elif defined(__XTENSA__)
+        const size_t i = to_float_unroll4(src, dst, n, scale);
+#else
+        const size_t i = 0;
+#endif
+        to_float_scalar(src + i, dst + i, n - i, scale); ///< Tail (or whole block without a kernel).
+    }
+} ///< Namespace rcmap.
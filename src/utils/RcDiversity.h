@@ -0,0 +1,64 @@
+/**
+ * MIT License
+ *
+ * @brief Receiver diversity: pick the freshest healthy receiver each poll.
+ *
+ * @file RcDiversity.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+namespace rcmap
+{
+    /**
+     * @brief Freshest-healthy-wins selector over N receivers (N compares per poll, no buffering).
+     *
+     * The active receiver is kept while it is healthy and nothing newer has
+     * arrived. If no receiver is healthy the last choice stands, and the
+     * caller publishes failsafe.
+     *
+     * @tparam N Receivers merged per frame.
+     */
+    template <size_t N>
+    class Diversity
+    {
+    public:
+        static_assert(N > 0, "Diversity needs at least one receiver");
+
+        /// @brief Receiver @p i delivered a valid frame at @p t_us.
+        void seen(size_t i, uint64_t t_us) noexcept { last_us_[i] = t_us; }
+
+        /**
+         * @brief Re-select the active receiver.
+         *
+         * @param healthy Per-receiver health (true → not asserting failsafe), N entries.
+         * @return Index of the active receiver.
+         */
+        size_t select(const bool *healthy) noexcept
+        {
+            size_t best = healthy[active_] ? active_ : N;
+            for (size_t i = 0; i < N; ++i)
+                if (healthy[i] && (best == N || last_us_[i] > last_us_[best]))
+                    best = i;
+            if (best < N)
+                active_ = static_cast<uint8_t>(best);
+            return active_;
+        }
+
+        /// @brief Receiver selected by the last select().
+        size_t active() const noexcept { return active_; }
+
+        /// @brief Arrival time of receiver @p i's last valid frame (0 → none yet).
+        uint64_t last_us(size_t i) const noexcept { return last_us_[i]; }
+
+    private:
+        uint64_t last_us_[N]{}; ///< Arrival time of each receiver's last valid frame.
+        uint8_t active_{0};     ///< Receiver selected for the current frame.
+    };
+}
@@ -0,0 +1,174 @@
+/**
+ * MIT License
+ *
+ * @brief Fixed-point per-channel filters for RC outputs (median-of-3, one-pole low-pass, slew limit).
+ *
+ * @file RcFilter.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace rcmap
+{
+    constexpr uint16_t kAlphaOne = 32768; ///< Low-pass coefficient of 1.0 in Q15 (pass-through).
+
+    /**
+     * @brief One-pole low-pass coefficient (Q15) for a cutoff at a given sample rate.
+     * @note Uses the backward-Euler form w / (1 + w), w = 2πfc/fs (constexpr-friendly).
+     */
+    constexpr uint16_t lpf_alpha_q15(float cutoff_hz, float rate_hz) noexcept
+    {
+        const float w = 6.2831853f * cutoff_hz / rate_hz;
+        const float a = w / (1.0f + w);
+        return static_cast<uint16_t>(a * 32768.0f + 0.5f);
+    }
+
+    /**
+     * @brief Filter chain for one channel; stages run median → low-pass → slew.
+     */
+    struct FilterSpec
+    {
+        bool median3{false};           ///< Reject single-sample spikes.
+        uint16_t alpha_q15{kAlphaOne}; ///< Low-pass coefficient (kAlphaOne = off).
+        uint16_t slew_per_step{0};     ///< Max change away from zero per sample in counts (0 = off).
+    };
+
+    // ---- Presets (RcPublisher's role chains; rate_hz = publisher poll rate) ---- //
+
+    /// @brief Sticks: spike reject + light smoothing.
+    constexpr FilterSpec stick_filter(float rate_hz) noexcept { return {true, lpf_alpha_q15(8.0f, rate_hz), 0}; }
+
+    /// @brief Throttle: as a stick, heavier smoothing, and rises slewed to 0→100 % in ≥ 25 samples.
+    constexpr FilterSpec throttle_filter(float rate_hz) noexcept { return {true, lpf_alpha_q15(5.0f, rate_hz), 400}; }
+
+    /// @brief Slow pots: heavy smoothing only.
+    constexpr FilterSpec knob_filter(float rate_hz) noexcept { return {false, lpf_alpha_q15(2.0f, rate_hz), 0}; }
+
+    /// @brief Switches: ignore single-frame glitches.
+    constexpr FilterSpec switch_filter() noexcept { return {true, kAlphaOne, 0}; }
+
+    /**
+     * @brief O(1) filter state for one channel (12 bytes).
+     */
+    class Filter
+    {
+    public:
+        /// @brief Run one sample through the chain.
+        int16_t apply(int16_t x, const FilterSpec &f) noexcept
+        {
+            if (!primed_)
+            {
+                reset(x);
+                return x;
+            }
+
+            // Median-of-3 over the last three raw samples.
+            int16_t v = x;
+            if (f.median3)
+            {
+                v = median(x, h1_, h2_);
+                h2_ = h1_;
+                h1_ = x;
+            }
+
+            // One-pole low-pass: acc (Q15) += α·(v − y).
+            if (f.alpha_q15 < kAlphaOne)
+            {
+                acc_ += static_cast<int32_t>(f.alpha_q15) * (static_cast<int32_t>(v) - out_q15());
+                v = static_cast<int16_t>(out_q15());
+            }
+            else
+            {
+                acc_ = static_cast<int32_t>(v) * kAlphaOne;
+            }
+
+            // Slew limit on moves away from zero only: a release or stop (toward zero) must never lag.
+            if (f.slew_per_step > 0)
+            {
+                const int32_t s = f.slew_per_step;
+                const int32_t up = (last_ > 0) ? last_ : 0;   ///< Rise reference (zero if coming from below).
+                const int32_t down = (last_ < 0) ? last_ : 0; ///< Fall reference (zero if coming from above).
+                if (v > up + s)
+                    v = static_cast<int16_t>(up + s);
+                else if (v < down - s)
+                    v = static_cast<int16_t>(down - s);
+            }
+
+            last_ = v;
+            return v;
+        }
+
+        /// @brief Snap all state to @p x (used on start-up and failsafe).
+        void reset(int16_t x) noexcept
+        {
+            h1_ = h2_ = last_ = x;
+            acc_ = static_cast<int32_t>(x) * kAlphaOne;
+            primed_ = true;
+        }
+
+    private:
+        /// @brief Rounded low-pass output from the Q15 accumulator.
+        [[nodiscard]] int32_t out_q15() const noexcept { return (acc_ + (kAlphaOne >> 1)) >> 15; }
+
+        [[nodiscard]] static int16_t median(int16_t a, int16_t b, int16_t c) noexcept
+        {
+            if (a > b)
+            {
+                const int16_t t = a;
+                a = b;
+                b = t;
+            }
+            return (c <= a) ? a : ((c >= b) ? b : c);
+        }
+
+        int32_t acc_{0};     ///< Low-pass state (Q15).
+        int16_t h1_{0};      ///< Previous raw sample.
+        int16_t h2_{0};      ///< Raw sample before h1_.
+        int16_t last_{0};    ///< Previous output (slew reference).
+        bool primed_{false}; ///< False until the first sample seeds the state.
+    };
+
+    /**
+     * @brief Per-channel filter specs and state.
+     *
+     * @tparam N Number of channels.
+     */
+    template <size_t N>
+    class FilterBank
+    {
+    public:
+        /// @brief Set the chain for channel @p ch.
+        void configure(size_t ch, const FilterSpec &f) noexcept
+        {
+            if (ch < N)
+                spec_[ch] = f;
+        }
+
+        /// @brief Filter a frame in place.
+        void apply(int16_t *v, size_t n) noexcept
+        {
+            const size_t m = (n < N) ? n : N;
+            for (size_t i = 0; i < m; ++i)
+                v[i] = state_[i].apply(v[i], spec_[i]);
+        }
+
+        /// @brief Snap every channel to the given frame (no filtering).
+        void reset(const int16_t *v, size_t n) noexcept
+        {
+            const size_t m = (n < N) ? n : N;
+            for (size_t i = 0; i < m; ++i)
+                state_[i].reset(v[i]);
+        }
+
+    private:
+        std::array<FilterSpec, N> spec_{}; ///< Per-channel configuration.
+        std::array<Filter, N> state_{};    ///< Per-channel state.
+    };
+} ///< Namespace rcmap.
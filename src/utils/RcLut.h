@@ -0,0 +1,162 @@
+/**
+ * MIT License
+ *
+ * @brief Precomputed raw → output lookup tables for RC axes and switches.
+ *
+ * @file RcLut.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace rcmap
+{
+    // ---- Raw input range (µs) ---- //
+    constexpr int16_t kRawMin = 1000;                                         ///< Lowest raw pulse width accepted.
+    constexpr int16_t kRawMax = 2000;                                         ///< Highest raw pulse width accepted.
+    constexpr int16_t kRawCenter = 1500;                                      ///< Nominal stick center.
+    constexpr size_t kTableSize = static_cast<size_t>(kRawMax - kRawMin) + 1; ///< One entry per µs (1001).
+
+    // ---- Fixed-point output ---- //
+    constexpr float kScale = 100.0f;      ///< Output counts per engineering unit (0.01 resolution).
+    constexpr float kLsb = 1.0f / kScale; ///< Engineering units per output count.
+    constexpr size_t kMaxLevels = 3;      ///< Maximum positions on a switch.
+
+    /// @brief One lookup table: raw µs (offset by kRawMin) → fixed-point output.
+    using Table = std::array<int16_t, kTableSize>;
+
+    /**
+     * @brief Linear axis mapping with center and deadband (engineering units).
+     */
+    struct AxisSpec
+    {
+        int16_t raw_min{kRawMin};   ///< Raw µs mapped to out_min.
+        int16_t raw_max{kRawMax};   ///< Raw µs mapped to out_max.
+        int16_t center{kRawCenter}; ///< Raw µs of the rest position.
+        int16_t deadband_us{0};     ///< ± window around center that reads as rest.
+        float out_min{0.0f};        ///< Output at raw_min.
+        float out_max{0.0f};        ///< Output at raw_max.
+    };
+
+    /**
+     * @brief Discrete switch: raw levels snapped to the nearest value.
+     */
+    struct SwitchSpec
+    {
+        uint8_t count{0};           ///< Number of positions in use (2..kMaxLevels).
+        int16_t raw[kMaxLevels]{};  ///< Raw µs per position (ascending).
+        float values[kMaxLevels]{}; ///< Output per position (engineering units).
+    };
+
+    /// @brief Clamp a raw pulse width into the table range.
+    [[nodiscard]] constexpr int16_t clamp_raw(int16_t raw) noexcept
+    {
+        return raw < kRawMin ? kRawMin : (raw > kRawMax ? kRawMax : raw);
+    }
+
+    /// @brief Engineering units → fixed-point counts (round half away from zero).
+    [[nodiscard]] constexpr int16_t to_fixed(float v) noexcept
+    {
+        return static_cast<int16_t>(v >= 0.0f ? v * kScale + 0.5f : v * kScale - 0.5f);
+    }
+
+    /**
+     * @brief Fill a table with the axis mapping.
+     * @note Deadband edges map to the rest output, so there is no step when leaving it.
+     */
+    inline void build_axis(Table &t, const AxisSpec &a) noexcept
+    {
+        // Rest output: an end-stop center (e.g. throttle) rests at that end, otherwise mid-scale.
+        const float out_center = (a.center <= a.raw_min)   ? a.out_min
+                                 : (a.center >= a.raw_max) ? a.out_max
+                                                           : 0.5f * (a.out_min + a.out_max);
+
+        const int lo_edge = a.center - a.deadband_us; ///< Lower deadband edge (µs).
+        const int hi_edge = a.center + a.deadband_us; ///< Upper deadband edge (µs).
+
+        for (size_t i = 0; i < kTableSize; ++i)
+        {
+            int raw = static_cast<int>(kRawMin) + static_cast<int>(i);
+            raw = raw < a.raw_min ? a.raw_min : (raw > a.raw_max ? a.raw_max : raw);
+
+            float out = out_center;
+            if (raw > hi_edge && a.raw_max > hi_edge)
+                out = out_center + (a.out_max - out_center) * static_cast<float>(raw - hi_edge) /
+                                       static_cast<float>(a.raw_max - hi_edge);
+            else if (raw < lo_edge && lo_edge > a.raw_min)
+                out = out_center + (a.out_min - out_center) * static_cast<float>(lo_edge - raw) /
+                                       static_cast<float>(lo_edge - a.raw_min);
+
+            t[i] = to_fixed(out);
+        }
+    }
+
+    /**
+     * @brief Fill a table with the switch level snapping (midpoint thresholds).
+     */
+    inline void build_switch(Table &t, const SwitchSpec &s) noexcept
+    {
+        const size_t n = (s.count > kMaxLevels) ? kMaxLevels : s.count;
+
+        for (size_t i = 0; i < kTableSize; ++i)
+        {
+            const int raw = static_cast<int>(kRawMin) + static_cast<int>(i);
+
+            size_t level = 0;
+            while (level + 1 < n && raw * 2 >= s.raw[level] + s.raw[level + 1])
+                ++level; ///< Past the midpoint → next position.
+
+            t[i] = (n > 0) ? to_fixed(s.values[level]) : 0;
+        }
+    }
+
+    /**
+     * @brief A bank of per-channel tables; one indexed load maps one channel.
+     * @note RAM: 2002 bytes per channel, so the publisher's 10 roles hold about
+     *       20 KB (a full 18-channel bank, 36 KB) of the ESP32-S3's internal SRAM.
+     *       tools/rc/lut_bench.cpp measures what that buys against the float path.
+     *
+     * @tparam N Number of channels.
+     */
+    template <size_t N>
+    class Bank
+    {
+    public:
+        /// @brief Compile channel @p ch as an axis.
+        void set_axis(size_t ch, const AxisSpec &a) noexcept
+        {
+            if (ch < N)
+                build_axis(tables_[ch], a);
+        }
+
+        /// @brief Compile channel @p ch as a switch.
+        void set_switch(size_t ch, const SwitchSpec &s) noexcept
+        {
+            if (ch < N)
+                build_switch(tables_[ch], s);
+        }
+
+        /// @brief Map one raw value (µs) to fixed-point output.
+        [[nodiscard]] int16_t map(size_t ch, int16_t raw) const noexcept
+        {
+            return tables_[ch][static_cast<size_t>(clamp_raw(raw) - kRawMin)];
+        }
+
+        /// @brief Map a whole frame: raw µs → fixed-point output.
+        void map(const int16_t *raw, int16_t *out, size_t n) const noexcept
+        {
+            const size_t m = (n < N) ? n : N;
+            for (size_t i = 0; i < m; ++i)
+                out[i] = tables_[i][static_cast<size_t>(clamp_raw(raw[i]) - kRawMin)];
+        }
+
+    private:
+        std::array<Table, N> tables_{}; ///< N × 1001 × int16 (2002 B per channel).
+    };
+} ///< Namespace rcmap.
@@ -0,0 +1,258 @@
+/**
+ * MIT License
+ *
+ * @brief Streaming byte parsers for SBUS and CRSF receiver protocols.
+ *
+ * @file RcParsers.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace rcproto
+{
+    constexpr size_t kMaxChannels = 16; ///< Both protocols carry 16 proportional channels.
+
+    /**
+     * @brief Unpack LSB-first 11-bit channels (shared by SBUS and CRSF).
+     *
+     * @param p Packed payload (22 bytes for 16 channels).
+     * @param out Unpacked channel ticks.
+     * @param n Number of channels.
+     */
+    inline void unpack11(const uint8_t *p, uint16_t *out, size_t n) noexcept
+    {
+        uint32_t bits = 0; ///< Bit accumulator.
+        uint8_t have = 0;  ///< Valid bits in the accumulator.
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            while (have < 11)
+            {
+                bits |= static_cast<uint32_t>(*p++) << have;
+                have += 8;
+            }
+            out[i] = static_cast<uint16_t>(bits & 0x07FFu);
+            bits >>= 11;
+            have -= 11;
+        }
+    }
+
+    /// @brief 11-bit protocol ticks → µs (992 ticks = 1500 µs, 0.625 µs per tick).
+    [[nodiscard]] constexpr int16_t ticks_to_us(uint16_t t) noexcept
+    {
+        return static_cast<int16_t>(1500 + ((static_cast<int32_t>(t) - 992) * 5) / 8);
+    }
+
+    // ---- SBUS ---- //
+
+    /**
+     * @brief SBUS parser (25-byte frames, 100 kbaud 8E2 inverted, 7–14 ms).
+     */
+    class SbusParser
+    {
+    public:
+        static constexpr size_t kFrameLen = 25;   ///< Header + 22 data + flags + footer.
+        static constexpr uint8_t kHeader = 0x0F;  ///< Start byte.
+        static constexpr uint8_t kLostBit = 0x04; ///< Flags: frame lost.
+        static constexpr uint8_t kFsBit = 0x08;   ///< Flags: receiver failsafe.
+
+        /**
+         * @brief Feed one byte.
+         * @return true if this byte completed a valid frame.
+         */
+        bool push(uint8_t b) noexcept
+        {
+            if (len_ == 0 && b != kHeader)
+                return false; ///< Hunting for a header.
+
+            buf_[len_++] = b;
+            if (len_ < kFrameLen)
+                return false;
+
+            if (footer_ok(buf_[kFrameLen - 1]))
+            {
+                decode();
+                len_ = 0;
+                return true;
+            }
+
+            ++resyncs_;
+            resync();
+            return false;
+        }
+
+        [[nodiscard]] const int16_t *channels_us() const noexcept { return us_.data(); }
+        [[nodiscard]] size_t count() const noexcept { return kMaxChannels; }
+        [[nodiscard]] bool failsafe() const noexcept { return (flags_ & kFsBit) != 0; }
+        [[nodiscard]] bool frame_lost() const noexcept { return (flags_ & kLostBit) != 0; }
+        [[nodiscard]] uint32_t frames() const noexcept { return frames_; }
+        [[nodiscard]] uint32_t resyncs() const noexcept { return resyncs_; }
+
+    private:
+        /// @brief SBUS ends in 0x00; SBUS2 cycles 0x04/0x14/0x24/0x34.
+        [[nodiscard]] static bool footer_ok(uint8_t f) noexcept { return f == 0x00 || (f & 0x0F) == 0x04; }
+
+        void decode() noexcept
+        {
+            uint16_t t[kMaxChannels];
+            unpack11(&buf_[1], t, kMaxChannels);
+            for (size_t i = 0; i < kMaxChannels; ++i)
+                us_[i] = ticks_to_us(t[i]);
+            flags_ = buf_[23];
+            ++frames_;
+        }
+
+        /// @brief Bad footer: restart from the next header byte already buffered (if any).
+        void resync() noexcept
+        {
+            size_t k = 1;
+            while (k < len_ && buf_[k] != kHeader)
+                ++k;
+
+            size_t j = 0;
+            for (; k < len_; ++k, ++j)
+                buf_[j] = buf_[k];
+            len_ = j;
+        }
+
+        std::array<uint8_t, kFrameLen> buf_{};   ///< Frame under assembly.
+        size_t len_{0};                          ///< Bytes in buf_.
+        std::array<int16_t, kMaxChannels> us_{}; ///< Last decoded channels (µs).
+        uint8_t flags_{0};                       ///< Last flags byte.
+        uint32_t frames_{0};                     ///< Valid frames decoded.
+        uint32_t resyncs_{0};                    ///< Frames dropped on a bad footer.
+    };
+
+    // ---- CRSF ---- //
+
+    /// @brief CRC-8/DVB-S2 lookup table (poly 0xD5), built at compile time.
+    constexpr std::array<uint8_t, 256> make_crc8_d5() noexcept
+    {
+        std::array<uint8_t, 256> t{};
+        for (size_t i = 0; i < 256; ++i)
+        {
+            uint8_t c = static_cast<uint8_t>(i);
+            for (int b = 0; b < 8; ++b)
+                c = static_cast<uint8_t>((c & 0x80) ? (c << 1) ^ 0xD5 : (c << 1));
+            t[i] = c;
+        }
+        return t;
+    }
+
+    constexpr std::array<uint8_t, 256> kCrc8D5 = make_crc8_d5(); ///< CRSF frame CRC table.
+
+    /**
+     * @brief CRSF parser (420 kbaud 8N1, up to 500 Hz) with link statistics.
+     */
+    class CrsfParser
+    {
+    public:
+        static constexpr size_t kMaxFrame = 64;         ///< addr + len + (type + payload + crc ≤ 62).
+        static constexpr uint8_t kAddrFc = 0xC8;        ///< Flight-controller address (receiver → us).
+        static constexpr uint8_t kTypeLinkStats = 0x14; ///< LINK_STATISTICS.
+        static constexpr uint8_t kTypeChannels = 0x16;  ///< RC_CHANNELS_PACKED.
+
+        /// @brief Uplink quality as reported by the receiver.
+        struct LinkStats
+        {
+            uint8_t rssi_dbm{0}; ///< Uplink RSSI (−dBm, best antenna).
+            uint8_t lq{0};       ///< Uplink link quality (0–100 %).
+            int8_t snr{0};       ///< Uplink SNR (dB).
+            uint8_t rf_mode{0};  ///< Packet-rate index.
+        };
+
+        /**
+         * @brief Feed one byte.
+         * @return true if this byte completed a valid RC channels frame.
+         */
+        bool push(uint8_t b) noexcept
+        {
+            if (len_ == 0)
+            {
+                if (b == kAddrFc || b == 0xEE || b == 0xEA)
+                    buf_[len_++] = b; ///< Plausible sync byte.
+                return false;
+            }
+
+            if (len_ == 1)
+            {
+                if (b < 2 || b > kMaxFrame - 2)
+                {
+                    ++resyncs_;
+                    len_ = 0; ///< Impossible length → hunt again.
+                    return false;
+                }
+                buf_[len_++] = b;
+                return false;
+            }
+
+            buf_[len_++] = b;
+            const size_t total = static_cast<size_t>(buf_[1]) + 2;
+            if (len_ < total)
+                return false;
+
+            len_ = 0;
+
+            // CRC covers type + payload.
+            uint8_t crc = 0;
+            for (size_t i = 2; i < total - 1; ++i)
+                crc = kCrc8D5[crc ^ buf_[i]];
+            if (crc != buf_[total - 1])
+            {
+                ++crc_errors_;
+                return false;
+            }
+
+            return dispatch(buf_[2], &buf_[3], total - 4);
+        }
+
+        [[nodiscard]] const int16_t *channels_us() const noexcept { return us_.data(); }
+        [[nodiscard]] size_t count() const noexcept { return kMaxChannels; }
+        [[nodiscard]] const LinkStats &link() const noexcept { return link_; }
+        [[nodiscard]] bool has_link() const noexcept { return has_link_; } ///< link() is meaningful.
+        [[nodiscard]] bool failsafe() const noexcept { return has_link_ && link_.lq == 0; }
+        [[nodiscard]] uint32_t frames() const noexcept { return frames_; }
+        [[nodiscard]] uint32_t crc_errors() const noexcept { return crc_errors_; }
+        [[nodiscard]] uint32_t resyncs() const noexcept { return resyncs_; }
+
+    private:
+        bool dispatch(uint8_t type, const uint8_t *p, size_t n) noexcept
+        {
+            if (type == kTypeChannels && n >= 22)
+            {
+                uint16_t t[kMaxChannels];
+                unpack11(p, t, kMaxChannels);
+                for (size_t i = 0; i < kMaxChannels; ++i)
+                    us_[i] = ticks_to_us(t[i]);
+                ++frames_;
+                return true;
+            }
+
+            if (type == kTypeLinkStats && n >= 10)
+            {
+                link_.rssi_dbm = (p[0] < p[1]) ? p[0] : p[1]; ///< Smaller −dBm = stronger antenna.
+                link_.lq = p[2];
+                link_.snr = static_cast<int8_t>(p[3]);
+                link_.rf_mode = p[5];
+                has_link_ = true;
+            }
+            return false;
+        }
+
+        std::array<uint8_t, kMaxFrame> buf_{};   ///< Frame under assembly.
+        size_t len_{0};                          ///< Bytes in buf_.
+        std::array<int16_t, kMaxChannels> us_{}; ///< Last decoded channels (µs).
+        LinkStats link_{};                       ///< Last link statistics.
+        bool has_link_{false};                   ///< True once LINK_STATISTICS has been seen.
+        uint32_t frames_{0};                     ///< Valid channel frames decoded.
+        uint32_t crc_errors_{0};                 ///< Frames dropped on CRC mismatch.
+        uint32_t resyncs_{0};                    ///< Sync losses (bad length byte).
+    };
+} ///< Namespace rcproto.
@@ -0,0 +1,221 @@
+/**
+ * MIT License
+ *
+ * @brief Bounded, decaying extrapolation of RC axes across short frame gaps.
+ *
+ * @file RcPredictor.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace rcmap
+{
+    /**
+     * @brief Prediction limits for one channel (fixed-point counts).
+     */
+    struct PredictSpec
+    {
+        bool enabled{false}; ///< False → hold last value (switches).
+        int16_t lo{0};       ///< Lowest value a prediction may reach.
+        int16_t hi{0};       ///< Highest value a prediction may reach.
+    };
+
+    /**
+     * @brief Frame-interval tracker: tells the predictors when a frame is actually overdue.
+     *
+     * The receiver frame period is not the poll period (SBUS ~14 ms polled
+     * every 10 ms leaves polls with no new frame in normal running). The
+     * interval between fresh polls is averaged (EMA, 1/8), seeded with the
+     * protocol's expected period; gaps of two intervals or more are
+     * dropouts and do not feed the average. A stale poll only counts as a
+     * missed frame once the gap exceeds the interval by a quarter.
+     */
+    class FrameClock
+    {
+    public:
+        /// @param expected_us Nominal frame period for the protocol (seed for the average).
+        explicit FrameClock(uint32_t expected_us = 0) noexcept : iv_us_(expected_us) {}
+
+        /**
+         * @brief Advance one poll.
+         *
+         * @param fresh True if a new frame arrived this poll.
+         * @param now_us Poll time.
+         * @return Fresh: frame intervals since the previous real frame (≥ 1).
+         *         Stale: frames overdue (0 → not late yet, nothing to predict).
+         */
+        uint8_t tick(bool fresh, uint64_t now_us) noexcept
+        {
+            if (last_us_ == 0)
+            {
+                if (fresh)
+                    last_us_ = now_us;
+                return fresh ? 1 : 0;
+            }
+
+            const uint64_t dt = now_us - last_us_;
+            if (fresh)
+            {
+                if (iv_us_ == 0)
+                    iv_us_ = static_cast<uint32_t>(dt);
+                else if (dt < 2u * static_cast<uint64_t>(iv_us_))
+                    iv_us_ = static_cast<uint32_t>(static_cast<int64_t>(iv_us_) +
+                                                   (static_cast<int64_t>(dt) - static_cast<int64_t>(iv_us_)) / 8);
+                last_us_ = now_us;
+                return clamp_frames((dt + iv_us_ / 2) / (iv_us_ ? iv_us_ : 1), 1);
+            }
+
+            const uint64_t grace = iv_us_ + iv_us_ / 4;
+            if (iv_us_ == 0 || dt <= grace)
+                return 0;
+            return clamp_frames((dt - iv_us_ / 4) / iv_us_, 0);
+        }
+
+        /// @brief Current frame-interval estimate (µs, 0 → unknown).
+        uint32_t interval_us() const noexcept { return iv_us_; }
+
+        /// @brief Forget the last frame time (keep the interval estimate).
+        void reset() noexcept { last_us_ = 0; }
+
+    private:
+        static uint8_t clamp_frames(uint64_t n, uint8_t lo) noexcept
+        {
+            return static_cast<uint8_t>(n < lo ? lo : (n > 255 ? 255 : n));
+        }
+
+        uint64_t last_us_{0}; ///< Poll time of the last fresh frame (0 → none).
+        uint32_t iv_us_{0};   ///< Frame-interval estimate.
+    };
+
+    /**
+     * @brief O(1) per-channel predictor: velocity per frame from the last two real frames, halved each missed frame.
+     *
+     * @tparam MaxGap Missed frames to bridge before holding (watchdog/failsafe takes over after that).
+     */
+    template <uint8_t MaxGap>
+    class Predictor
+    {
+    public:
+        /**
+         * @brief Advance one poll.
+         *
+         * @param x Current mapped value (stale when @p fresh is false).
+         * @param fresh True if a new frame arrived this poll.
+         * @param frames FrameClock::tick() result: intervals since the last real frame (fresh) or frames overdue (stale).
+         * @param p Limits for this channel.
+         * @return Value to publish; @p predicted set if it was extrapolated.
+         */
+        int16_t step(int16_t x, bool fresh, uint8_t frames, const PredictSpec &p, bool &predicted) noexcept
+        {
+            if (fresh || !primed_)
+            {
+                // Velocity per frame over however many frame intervals the gap lasted.
+                const int32_t span = frames ? frames : 1;
+                v_ = primed_ ? static_cast<int16_t>((static_cast<int32_t>(x) - last_) / span) : 0;
+                last_ = pred_ = x;
+                gap_ = 0;
+                primed_ = true;
+                return x;
+            }
+
+            if (!p.enabled)
+                return pred_; ///< Hold.
+
+            // Catch up to the frames that are overdue, one decayed step each.
+            const uint8_t due = (frames < MaxGap) ? frames : MaxGap;
+            while (gap_ < due)
+            {
+                ++gap_;
+                v_ = static_cast<int16_t>(v_ / 2); ///< Decay: trust the trend less each missed frame.
+
+                int32_t y = static_cast<int32_t>(pred_) + v_;
+                y = (y < p.lo) ? p.lo : ((y > p.hi) ? p.hi : y);
+                pred_ = static_cast<int16_t>(y);
+            }
+
+            if (gap_ > 0)
+                predicted = true;
+            return pred_;
+        }
+
+        /// @brief Forget history (failsafe / link restart).
+        void reset(int16_t x) noexcept
+        {
+            last_ = pred_ = x;
+            v_ = 0;
+            gap_ = 0;
+            primed_ = true;
+        }
+
+    private:
+        int16_t last_{0};    ///< Last real value.
+        int16_t pred_{0};    ///< Last published value (real or predicted).
+        int16_t v_{0};       ///< Velocity (counts per frame).
+        uint8_t gap_{0};     ///< Missed frames bridged since the last real one.
+        bool primed_{false}; ///< False until the first value.
+    };
+
+    /**
+     * @brief Per-channel predictor specs and state.
+     *
+     * @tparam N Number of channels.
+     * @tparam MaxGap Missed frames to bridge.
+     */
+    template <size_t N, uint8_t MaxGap>
+    class PredictorBank
+    {
+    public:
+        /// @param expected_us Nominal frame period (seeds the frame-interval estimate).
+        explicit PredictorBank(uint32_t expected_us = 0) noexcept : clock_(expected_us) {}
+
+        /// @brief Set limits for channel @p ch.
+        void configure(size_t ch, const PredictSpec &p) noexcept
+        {
+            if (ch < N)
+                spec_[ch] = p;
+        }
+
+        /**
+         * @brief Run a frame in place.
+         *
+         * @param v Mapped values (stale when @p fresh is false).
+         * @param n Number of values.
+         * @param fresh True if a new frame arrived this poll.
+         * @param now_us Poll time.
+         * @return true if any channel was extrapolated.
+         */
+        bool apply(int16_t *v, size_t n, bool fresh, uint64_t now_us) noexcept
+        {
+            bool predicted = false;
+            const uint8_t frames = clock_.tick(fresh, now_us);
+            const size_t m = (n < N) ? n : N;
+            for (size_t i = 0; i < m; ++i)
+                v[i] = state_[i].step(v[i], fresh, frames, spec_[i], predicted);
+            return predicted;
+        }
+
+        /// @brief Reset every channel to the given frame.
+        void reset(const int16_t *v, size_t n) noexcept
+        {
+            const size_t m = (n < N) ? n : N;
+            for (size_t i = 0; i < m; ++i)
+                state_[i].reset(v[i]);
+            clock_.reset();
+        }
+
+        /// @brief Frame-interval tracker (for diagnostics).
+        const FrameClock &clock() const noexcept { return clock_; }
+
+    private:
+        std::array<PredictSpec, N> spec_{};        ///< Per-channel limits.
+        std::array<Predictor<MaxGap>, N> state_{}; ///< Per-channel state.
+        FrameClock clock_;                         ///< Shared frame-interval tracker.
+    };
+} ///< Namespace rcmap.
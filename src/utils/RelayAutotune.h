@@ -0,0 +1,161 @@
+/**
+ * MIT License
+ *
+ * @brief Relay-feedback (Åström–Hägglund) PID autotuner in fixed memory.
+ *
+ * @file RelayAutotune.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+#include <Pid.h>
+
+namespace ctl
+{
+    /**
+     * @brief Relay experiment settings (process units in, output units out).
+     */
+    struct RelaySpec
+    {
+        float setpoint{0.0f};      ///< Process value to oscillate around.
+        float bias{0.0f};          ///< Output centre (≈ open-loop output at setpoint).
+        float amplitude{0.0f};     ///< Relay swing d (output = bias ± d).
+        float hysteresis{0.0f};    ///< Switching band ε around the setpoint (noise immunity).
+        uint8_t settle_cycles{2};  ///< Cycles discarded while the oscillation settles.
+        uint8_t measure_cycles{4}; ///< Cycles averaged for Ku / Tu.
+        float timeout_s{20.0f};    ///< Give up if not finished by then.
+        float out_lo{0.0f};        ///< Output lower clamp.
+        float out_hi{100.0f};      ///< Output upper clamp.
+    };
+
+    /**
+     * @brief Drives a relay around the setpoint and derives PI gains from the limit cycle.
+     *
+     * Everything is running sums: O(1) per sample and no sample history, so it can
+     * run inside the drive loop. Gains use Tyreus–Luyben (Kp = Ku/3.2, Ti = 2.2·Tu),
+     * which trades a little speed for much less overshoot than Ziegler–Nichols.
+     */
+    class RelayAutotune
+    {
+    public:
+        enum class State : uint8_t
+        {
+            Idle = 0, ///< Not started.
+            Running,  ///< Relay active.
+            Done,     ///< result() valid.
+            Failed    ///< Timed out or no measurable oscillation.
+        };
+
+        /// @brief Start a new experiment.
+        void start(const RelaySpec &s) noexcept
+        {
+            s_ = s;
+            state_ = State::Running;
+            high_ = true;
+            t_s_ = 0.0f;
+            last_rise_s_ = -1.0f;
+            pmax_ = -INFINITY;
+            pmin_ = INFINITY;
+            cycles_ = 0;
+            n_ = 0;
+            sum_period_s_ = 0.0f;
+            sum_amp_ = 0.0f;
+        }
+
+        /// @brief Abandon the experiment.
+        void abort() noexcept { state_ = State::Idle; }
+
+        /**
+         * @brief Advance one sample.
+         *
+         * @param pv Measured process value.
+         * @param dt_s Sample period (s).
+         * @return Relay output to apply.
+         */
+        float step(float pv, float dt_s) noexcept
+        {
+            if (state_ != State::Running)
+                return s_.bias;
+
+            t_s_ += dt_s;
+            pmax_ = fmaxf(pmax_, pv);
+            pmin_ = fminf(pmin_, pv);
+
+            if (high_ && pv > s_.setpoint + s_.hysteresis)
+            {
+                high_ = false;
+            }
+            else if (!high_ && pv < s_.setpoint - s_.hysteresis)
+            {
+                high_ = true;
+                on_cycle(pv); ///< Rising switch closes one full cycle.
+            }
+
+            if (state_ == State::Running && t_s_ > s_.timeout_s)
+                state_ = State::Failed;
+
+            const float u = s_.bias + (high_ ? s_.amplitude : -s_.amplitude);
+            return fminf(fmaxf(u, s_.out_lo), s_.out_hi);
+        }
+
+        [[nodiscard]] State state() const noexcept { return state_; }
+        [[nodiscard]] float ku() const noexcept { return ku_; }   ///< Ultimate gain.
+        [[nodiscard]] float tu_s() const noexcept { return tu_; } ///< Ultimate period (s).
+
+        /// @brief Tuned gains (valid in State::Done); kff from the relay bias.
+        [[nodiscard]] PidGains result() const noexcept
+        {
+            const float kp = ku_ / 3.2f;
+            const float ti = 2.2f * tu_;
+            const float kff = (s_.setpoint > 0.0f) ? s_.bias / s_.setpoint : 0.0f;
+            return PidGains{kp, kp / ti, 0.0f, kff};
+        }
+
+    private:
+        void on_cycle(float pv) noexcept
+        {
+            if (last_rise_s_ >= 0.0f && ++cycles_ > s_.settle_cycles)
+            {
+                sum_period_s_ += t_s_ - last_rise_s_;
+                sum_amp_ += 0.5f * (pmax_ - pmin_);
+                ++n_;
+            }
+            last_rise_s_ = t_s_;
+            pmax_ = pmin_ = pv;
+
+            if (n_ < s_.measure_cycles || n_ == 0)
+                return;
+
+            const float a = sum_amp_ / static_cast<float>(n_);
+            tu_ = sum_period_s_ / static_cast<float>(n_);
+            if (a <= s_.hysteresis || tu_ <= 0.0f)
+            {
+                state_ = State::Failed; ///< Oscillation buried in the hysteresis band.
+                return;
+            }
+
+            // Describing function of a relay with hysteresis: Ku = 4d / (π·√(a² − ε²)).
+            ku_ = (4.0f * s_.amplitude) / (3.14159265f * sqrtf(a * a - s_.hysteresis * s_.hysteresis));
+            state_ = State::Done;
+        }
+
+        RelaySpec s_{};            ///< Experiment settings.
+        State state_{State::Idle}; ///< Progress.
+        bool high_{true};          ///< Relay position.
+        float t_s_{0.0f};          ///< Elapsed time (s).
+        float last_rise_s_{-1.0f}; ///< Time of the previous rising switch (s).
+        float pmax_{0.0f};         ///< Peak PV this cycle.
+        float pmin_{0.0f};         ///< Trough PV this cycle.
+        uint8_t cycles_{0};        ///< Complete cycles seen.
+        uint8_t n_{0};             ///< Cycles accumulated.
+        float sum_period_s_{0.0f}; ///< Σ period (s).
+        float sum_amp_{0.0f};      ///< Σ half peak-to-peak.
+        float ku_{0.0f};           ///< Ultimate gain.
+        float tu_{0.0f};           ///< Ultimate period (s).
+    };
+} ///< Namespace ctl.
@@ -0,0 +1,81 @@
+/**
+ * MIT License
+ *
+ * @brief Pulse-count → shaft speed estimator with an adaptive averaging window.
+ *
+ * @file SpeedEstimator.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace ctl
+{
+    /**
+     * @brief Estimator settings.
+     */
+    struct SpeedEstimatorSpec
+    {
+        float counts_per_rev{1.0f}; ///< Encoder counts per wheel revolution.
+        uint16_t min_counts{4};     ///< Close a window once this many counts arrived...
+        float max_window_s{0.1f};   ///< ...or this much time passed (sets the "stopped" latency).
+        float alpha{1.0f};          ///< One-pole smoothing on each window result (1 = off).
+    };
+
+    /**
+     * @brief Turns per-tick pulse counts into RPM.
+     *
+     * At speed a window closes every tick (low latency); at crawl speeds it
+     * stretches until min_counts pulses arrive, so one-pulse quantisation does
+     * not show up as speed ripple.
+     */
+    class SpeedEstimator
+    {
+    public:
+        void configure(const SpeedEstimatorSpec &s) noexcept { s_ = s; }
+
+        /**
+         * @brief Add one tick of counts.
+         *
+         * @param counts Pulses since the previous call.
+         * @param dt_s Time since the previous call (s).
+         * @return Current speed estimate (RPM).
+         */
+        float update(uint32_t counts, float dt_s) noexcept
+        {
+            acc_counts_ += counts;
+            acc_s_ += dt_s;
+
+            if (acc_counts_ >= s_.min_counts || acc_s_ >= s_.max_window_s)
+            {
+                const float raw = (acc_s_ > 0.0f)
+                                      ? (static_cast<float>(acc_counts_) * 60.0f) / (s_.counts_per_rev * acc_s_)
+                                      : 0.0f;
+                rpm_ += s_.alpha * (raw - rpm_);
+                acc_counts_ = 0;
+                acc_s_ = 0.0f;
+            }
+            return rpm_;
+        }
+
+        [[nodiscard]] float rpm() const noexcept { return rpm_; }
+
+        /// @brief Drop the open window and the estimate.
+        void reset() noexcept
+        {
+            acc_counts_ = 0;
+            acc_s_ = 0.0f;
+            rpm_ = 0.0f;
+        }
+
+    private:
+        SpeedEstimatorSpec s_{}; ///< Settings.
+        uint32_t acc_counts_{0}; ///< Counts in the open window.
+        float acc_s_{0.0f};      ///< Duration of the open window (s).
+        float rpm_{0.0f};        ///< Last estimate.
+    };
+} ///< Namespace ctl.
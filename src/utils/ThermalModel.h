@@ -0,0 +1,106 @@
+/**
+ * MIT License
+ *
+ * @brief First-order I²t thermal estimator with a smooth derating curve.
+ *
+ * @file ThermalModel.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cmath>
+
+namespace ctl
+{
+    /**
+     * @brief One thermal body (motor winding, driver die) and its derating curve.
+     */
+    struct ThermalSpec
+    {
+        float r_ohm{0.0f};          ///< Resistance dissipating I²R (Ω).
+        float rth_k_per_w{0.0f};    ///< Thermal resistance to ambient (K/W).
+        float tau_s{1.0f};          ///< Thermal time constant Rth·Cth (s).
+        float derate_start_c{0.0f}; ///< Full output up to this temperature...
+        float derate_end_c{0.0f};   ///< ...falling linearly to floor_pct here.
+        float floor_pct{0.0f};      ///< Output cap at and above derate_end_c (%).
+    };
+
+    /**
+     * @brief Temperature rise above ambient: rise' = (I²R·Rth − rise) / τ.
+     *
+     * Discretised exactly for a fixed step (the exp() is taken once in
+     * configure()), so each update is two multiplies and an add. State is one float.
+     */
+    class ThermalModel
+    {
+    public:
+        /**
+         * @brief Set the body and the step it will be updated at.
+         *
+         * @param s Thermal body.
+         * @param dt_s Update period (s).
+         */
+        void configure(const ThermalSpec &s, float dt_s) noexcept
+        {
+            s_ = s;
+            k_ = 1.0f - expf(-dt_s / s.tau_s);
+        }
+
+        /**
+         * @brief Advance one step.
+         *
+         * @param current_a Current through the body (A).
+         * @return Temperature rise above ambient (K).
+         */
+        float update(float current_a) noexcept
+        {
+            const float steady = current_a * current_a * s_.r_ohm * s_.rth_k_per_w;
+            rise_k_ += k_ * (steady - rise_k_);
+            return rise_k_;
+        }
+
+        /// @brief Estimated temperature for a given ambient (°C).
+        [[nodiscard]] float temp_c(float ambient_c) const noexcept { return ambient_c + rise_k_; }
+
+        /// @brief Output cap (%) for the current estimate: 100 → floor_pct across the derate band.
+        [[nodiscard]] float cap_pct(float ambient_c) const noexcept
+        {
+            const float t = temp_c(ambient_c);
+            if (t <= s_.derate_start_c)
+                return 100.0f;
+            if (t >= s_.derate_end_c)
+                return s_.floor_pct;
+            const float k = (t - s_.derate_start_c) / (s_.derate_end_c - s_.derate_start_c);
+            return 100.0f - k * (100.0f - s_.floor_pct);
+        }
+
+        /// @brief Seed the estimate (e.g. restored after a warm reboot).
+        void reset(float rise_k = 0.0f) noexcept { rise_k_ = rise_k; }
+
+    private:
+        ThermalSpec s_{};    ///< Body parameters.
+        float k_{0.0f};      ///< Per-step blend factor 1 − e^(−dt/τ).
+        float rise_k_{0.0f}; ///< Temperature rise above ambient (K).
+    };
+
+    /**
+     * @brief Motor current from duty when there is no current sensor.
+     *
+     * With a speed estimate, I ≈ I_stall·|duty − speed| (back-EMF removes the
+     * rest); without one, duty·I_full is a conservative stand-in.
+     *
+     * @param duty Applied duty (0..1).
+     * @param speed Speed as a fraction of no-load speed (0..1), or < 0 if unknown.
+     * @param stall_a Stall current at 100 % duty (A).
+     * @param full_a Assumed current at 100 % duty when speed is unknown (A).
+     */
+    [[nodiscard]] inline float current_proxy_a(float duty, float speed, float stall_a, float full_a) noexcept
+    {
+        if (speed < 0.0f)
+            return duty * full_a;
+        return fabsf(duty - speed) * stall_a; ///< duty < speed: braking through the low sides, still I²R.
+    }
+} ///< Namespace ctl.
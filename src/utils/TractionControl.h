@@ -0,0 +1,143 @@
+/**
+ * MIT License
+ *
+ * @brief Wheel-slip detection from expected vs measured acceleration, with duty cut/recover.
+ *
+ * @file TractionControl.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+namespace ctl
+{
+    /**
+     * @brief Traction settings.
+     */
+    struct TractionSpec
+    {
+        float max_rpm{300.0f};         ///< Wheel RPM at 100 % duty (loaded, steady state).
+        float tau_s{0.6f};             ///< Loaded drivetrain time constant: grip → this, spin → much faster.
+        float margin_rpm_s{400.0f};    ///< Excess acceleration that marks the onset of slip.
+        float cut_factor{0.6f};        ///< Scale multiplier applied at onset.
+        float ref_accel_rpm_s{150.0f}; ///< Vehicle acceleration assumed while slipping (low-grip surface).
+        float slip_band_rpm{15.0f};    ///< Wheel speed allowed above the vehicle reference.
+        float slip_gain{0.3f};         ///< Scale removed per second per RPM above the band.
+        float recover_per_s{1.0f};     ///< Scale regained per second while inside the band.
+        float min_scale{0.2f};         ///< Never cut below this fraction of the commanded duty.
+        float counts_per_rev{1.0f};    ///< Encoder counts per wheel revolution.
+    };
+
+    /**
+     * @brief Runs at the inner (sub-tick) rate from raw encoder counts.
+     *
+     * Acceleration is the second difference of the count over two back-to-back
+     * windows. If the wheel speeds up faster than the loaded drivetrain could for
+     * the applied duty, the tyre has let go: duty is cut at once, and from then on
+     * the wheel is held just above a vehicle-speed reference that starts at the
+     * pre-spin speed and grows at ref_accel_rpm_s (with one encoder there is no
+     * undriven wheel to measure ground speed). One count of jitter is
+     * 60/(cpr·T²) RPM/s with T the window, so margin_rpm_s must sit above that.
+     *
+     * @tparam Window Samples per window (sets noise vs. latency).
+     */
+    template <size_t Window>
+    class TractionControl
+    {
+    public:
+        void configure(const TractionSpec &s) noexcept { s_ = s; }
+
+        /**
+         * @brief Advance one inner step.
+         *
+         * @param counts Encoder total (unwrapped, monotonically increasing).
+         * @param duty Applied duty fraction (0..1), after this controller's scale.
+         * @param dt_s Inner step period (s).
+         * @return Scale (min_scale..1) to multiply the commanded duty by.
+         */
+        float step(uint32_t counts, float duty, float dt_s) noexcept
+        {
+            // c[n], c[n−W], c[n−2W] → speed and acceleration over two back-to-back windows.
+            if (!primed_)
+            {
+                hist_.fill(counts); ///< Start from rest: detection is live from the first step.
+                primed_ = true;
+            }
+
+            hist_[head_] = counts;
+            const uint32_t c1 = hist_[(head_ + kLen - Window) % kLen];
+            const uint32_t c2 = hist_[(head_ + 1) % kLen];
+            head_ = (head_ + 1) % kLen;
+
+            const float win_s = static_cast<float>(Window) * dt_s;
+            const float k = 60.0f / (s_.counts_per_rev * win_s); ///< Counts per window → RPM.
+            const float rpm = static_cast<float>(counts - c1) * k;
+            const float accel = (static_cast<float>(counts - c1) - static_cast<float>(c1 - c2)) * k / win_s;
+
+            if (!active_)
+            {
+                // Onset: the wheel is gaining speed faster than the loaded drivetrain could.
+                float expect = (duty * s_.max_rpm - rpm) / s_.tau_s;
+                expect = (expect > 0.0f) ? expect : 0.0f;
+                if (accel > expect + s_.margin_rpm_s)
+                {
+                    active_ = true;
+                    ref_rpm_ = static_cast<float>(c1 - c2) * k; ///< Speed before the spin-up.
+                    scale_ *= s_.cut_factor;
+                }
+                else
+                {
+                    scale_ += s_.recover_per_s * dt_s;
+                }
+            }
+            else
+            {
+                // Engaged: hold the wheel within slip_band_rpm of a vehicle reference.
+                ref_rpm_ += s_.ref_accel_rpm_s * dt_s;
+                ref_rpm_ = (rpm < ref_rpm_) ? rpm : ref_rpm_; ///< Driven wheel is never slower than the car.
+
+                const float excess = rpm - (ref_rpm_ + s_.slip_band_rpm);
+                if (excess > 0.0f)
+                    scale_ -= s_.slip_gain * excess * dt_s;
+                else
+                    scale_ += s_.recover_per_s * dt_s;
+
+                if (excess <= 0.0f && scale_ >= 1.0f)
+                    active_ = false; ///< Full duty without slipping: grip is back.
+            }
+
+            scale_ = (scale_ < s_.min_scale) ? s_.min_scale : ((scale_ > 1.0f) ? 1.0f : scale_);
+            return scale_;
+        }
+
+        [[nodiscard]] bool active() const noexcept { return active_; }
+        [[nodiscard]] float scale() const noexcept { return scale_; }
+
+        /// @brief Forget history; call at rest (stop, direction flip) since the next step assumes it.
+        void reset() noexcept
+        {
+            primed_ = false;
+            head_ = 0;
+            active_ = false;
+            ref_rpm_ = 0.0f;
+            scale_ = 1.0f;
+        }
+
+    private:
+        static constexpr size_t kLen = 2 * Window + 1; ///< c[n] … c[n−2W].
+
+        TractionSpec s_{};                  ///< Settings.
+        std::array<uint32_t, kLen> hist_{}; ///< Count history (ring).
+        size_t head_{0};                    ///< Next write (holds c[n−2W] before it).
+        bool primed_{false};                ///< False until the history is seeded.
+        bool active_{false};                ///< Slip detected, regulating to the reference.
+        float ref_rpm_{0.0f};               ///< Vehicle speed reference while active (RPM).
+        float scale_{1.0f};                 ///< Output scale.
+    };
+} ///< Namespace ctl.
@@ -0,0 +1,53 @@
+/**
+ * MIT License
+ *
+ * @brief Supply-voltage duty compensation and low-voltage power limiting.
+ *
+ * @file VoltageComp.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+namespace ctl
+{
+    /**
+     * @brief Compensation and limit curve (volts, percent).
+     */
+    struct VoltageCompSpec
+    {
+        float nominal_v{12.0f};    ///< Voltage at which duty passes through unchanged.
+        float limit_start_v{0.0f}; ///< Power cap starts falling below this voltage...
+        float limit_end_v{0.0f};   ///< ...and reaches floor_pct here.
+        float floor_pct{100.0f};   ///< Lowest cap (%).
+        float min_valid_v{1.0f};   ///< Below this the reading is treated as absent (no scaling).
+    };
+
+    /**
+     * @brief Duty that gives the same average motor voltage as @p pct at nominal.
+     * @note V_motor ≈ duty·V_batt, so duty' = duty·V_nom/V_batt (capped at 100 %).
+     */
+    [[nodiscard]] inline float compensate_pct(float pct, float volts, const VoltageCompSpec &s) noexcept
+    {
+        if (volts < s.min_valid_v)
+            return pct;
+        const float out = pct * (s.nominal_v / volts);
+        return (out > 100.0f) ? 100.0f : out;
+    }
+
+    /**
+     * @brief Output cap (%) for the present voltage: 100 above limit_start_v,
+     *        linear down to floor_pct at limit_end_v, floor_pct below that.
+     */
+    [[nodiscard]] inline float low_voltage_cap_pct(float volts, const VoltageCompSpec &s) noexcept
+    {
+        if (volts < s.min_valid_v || volts >= s.limit_start_v)
+            return 100.0f;
+        if (volts <= s.limit_end_v)
+            return s.floor_pct;
+        const float k = (volts - s.limit_end_v) / (s.limit_start_v - s.limit_end_v);
+        return s.floor_pct + k * (100.0f - s.floor_pct);
+    }
+} ///< Namespace ctl.
@@ -0,0 +1,97 @@
+/**
+ * MIT License
+ *
+ * @brief Bit-exactness check: every RC int16 → float kernel against the scalar reference.
+ *
+ * Build from the repository root:
+ *
+ *   g++ -O2 -std=gnu++17 -Isrc/utils tools/rc/convert_check.cpp -o rc_convert_check
+ *
+ * Usage: rc_convert_check
+ *
+ * Each kernel built for this host (SSE2 on x86, NEON on ARM, and the 4-way
+ * unrolled FPU loop the ESP32-S3 runs, which builds everywhere) plus the
+ * to_float dispatcher converts the whole int16 range, for several scales
+ * and at every start offset and length mod 8 (so each tail path runs). The
+ * output is compared with to_float_scalar as bit patterns, not values, so
+ * a −0.0 or a NaN payload difference would also fail. The exit status is
+ * the number of failing kernels.
+ *
+ * @file convert_check.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <RcConvert.h>
+#include <RcLut.h>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    using Kernel = void (*)(const int16_t *, float *, size_t, float);
+
+    /// @brief Run a kernel that converts a prefix, then the scalar tail, like to_float() does.
+    template <size_t (*K)(const int16_t *, float *, size_t, float)>
+    void with_tail(const int16_t *src, float *dst, size_t n, float scale)
+    {
+        const size_t i = K(src, dst, n, scale);
+        rcmap::to_float_scalar(src + i, dst + i, n - i, scale);
+    }
+
+    /// @brief Compare one kernel over the full int16 range; returns mismatching elements.
+    size_t check(Kernel k)
+    {
+        static const float kScales[] = {rcmap::kLsb, 1.0f, 0.001f, -3.7f, 1e-30f, 3.0e34f};
+
+        std::vector<int16_t> src(65536 + 16);
+        for (size_t i = 0; i < 65536; ++i)
+            src[i] = static_cast<int16_t>(static_cast<uint16_t>(i)); ///< 0 … 32767, −32768 … −1.
+        std::vector<float> want(src.size());
+        std::vector<float> got(src.size());
+
+        size_t bad = 0;
+        for (float scale : kScales)
+            for (size_t off = 0; off < 8; ++off)
+                for (size_t trim = 0; trim < 8; ++trim)
+                {
+                    const size_t n = 65536 - trim;
+                    rcmap::to_float_scalar(src.data() + off, want.data(), n, scale);
+                    memset(got.data(), 0xA5, got.size() * sizeof(float)); ///< Catch unwritten elements.
+                    k(src.data() + off, got.data(), n, scale);
+                    for (size_t i = 0; i < n; ++i)
+                        bad += memcmp(&want[i], &got[i], sizeof(float)) != 0;
+                }
+        return bad;
+    }
+}
+
+int main()
+{
+    struct Case
+    {
+        const char *name;
+        Kernel k;
+    };
+    const Case cases[] = {
+#if defined(__SSE2__)
+        {"sse2", &with_tail<rcmap::to_float_sse2>},
+#endif
+#if defined(__ARM_NEON)
+        {"neon", &with_tail<rcmap::to_float_neon>},
+#endif
+        {"unroll4", &with_tail<rcmap::to_float_unroll4>},
+        {"to_float", &rcmap::to_float},
+    };
+
+    int failed = 0;
+    for (const Case &c : cases)
+    {
+        const size_t bad = check(c.k);
+        printf("%-8s %s (%zu mismatching elements)\n", c.name, bad == 0 ? "bit-exact" : "MISMATCH", bad);
+        failed += bad == 0 ? 0 : 1;
+    }
+    return failed;
+}
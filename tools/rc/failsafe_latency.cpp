@@ -0,0 +1,157 @@
+/**
+ * MIT License
+ *
+ * @brief RC failsafe detection latency on a simulated cut link: frame watchdog against poll-only detection.
+ *
+ * Build from the repository root:
+ *
+ *   g++ -O2 -std=gnu++17 -Itools/sim/host -Isrc/config tools/rc/failsafe_latency.cpp tools/sim/host/SimHost.cpp \
+ *       -o rc_failsafe_latency
+ *
+ * Usage: rc_failsafe_latency [--cuts N] [--frame-ms F] [--poll-jitter-ms J] [--dispatch-us D] [--seed S]
+ *
+ * A receiver sends a frame every F ms (iBUS 7, SBUS 14, CRSF 2–7). RcPublisher
+ * polls every cfg::tick::LOOP_MS, but each poll lands up to J ms late
+ * because higher-priority tasks run first. A poll sees every frame that
+ * arrived since the last one. At a random instant the link is cut. Latency
+ * is measured from the last frame that arrived to the failsafe publish.
+ * It is measured N times for two detectors, both using
+ * cfg::rc::LINK_TIMEOUT_MS:
+ *
+ *  - poll-only (the old path): RcLink marks failsafe at the first poll that
+ *    is at least the timeout after the poll that saw the last frame.
+ *  - watchdog (RcPublisher now): the poll that sees a frame re-arms a
+ *    one-shot timer. Its expiry wakes the task, which publishes after the
+ *    esp_timer dispatch delay D, whatever the poll phase.
+ *
+ * The output is each detector's latency distribution (min, p50, p90, p99,
+ * max) and a histogram in 2 ms bins.
+ *
+ * @file failsafe_latency.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <app_config.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// @brief One detector's results (µs).
+    struct Dist
+    {
+        const char *name;
+        std::vector<double> us;
+    };
+
+    double pct(const std::vector<double> &v, double p)
+    {
+        return v[static_cast<size_t>(p * static_cast<double>(v.size() - 1))];
+    }
+
+    void report(Dist &d)
+    {
+        std::sort(d.us.begin(), d.us.end());
+        printf("%-10s min %6.2f  p50 %6.2f  p90 %6.2f  p99 %6.2f  max %6.2f ms\n", d.name, d.us.front() / 1000.0,
+               pct(d.us, 0.50) / 1000.0, pct(d.us, 0.90) / 1000.0, pct(d.us, 0.99) / 1000.0, d.us.back() / 1000.0);
+    }
+
+    void histogram(const Dist &a, const Dist &b)
+    {
+        const double lo = std::min(a.us.front(), b.us.front());
+        const double hi = std::max(a.us.back(), b.us.back());
+        const int first = static_cast<int>(lo / 2000.0);
+        const int last = static_cast<int>(hi / 2000.0);
+        printf("\n  bin (ms)   %-10s %-10s\n", a.name, b.name);
+        for (int k = first; k <= last; ++k)
+        {
+            auto count = [k](const Dist &d)
+            {
+                return std::count_if(d.us.begin(), d.us.end(),
+                                     [k](double x) { return static_cast<int>(x / 2000.0) == k; });
+            };
+            const double n = static_cast<double>(a.us.size());
+            printf("  %3d-%-3d    %5.1f %%    %5.1f %%\n", 2 * k, 2 * k + 2, 100.0 * count(a) / n, 100.0 * count(b) / n);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int cuts = 100000;
+    double frame_ms = 7.0;
+    double jitter_ms = 1.0;
+    double dispatch_us = 50.0;
+    unsigned seed = 54;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--cuts") && i + 1 < argc)
+            cuts = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--frame-ms") && i + 1 < argc)
+            frame_ms = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--poll-jitter-ms") && i + 1 < argc)
+            jitter_ms = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--dispatch-us") && i + 1 < argc)
+            dispatch_us = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+            seed = static_cast<unsigned>(atoi(argv[++i]));
+        else
+        {
+            fprintf(stderr, "usage: %s [--cuts N] [--frame-ms F] [--poll-jitter-ms J] [--dispatch-us D] [--seed S]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    if (cuts < 1 || frame_ms <= 0.0)
+        return 2;
+
+    const double poll_us = cfg::tick::LOOP_MS * 1000.0;
+    const double timeout_us = cfg::rc::LINK_TIMEOUT_MS * 1000.0;
+    const double frame_us = frame_ms * 1000.0;
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> u01(0.0, 1.0);
+    auto poll_at = [&](int64_t k) { return static_cast<double>(k) * poll_us + u01(rng) * jitter_ms * 1000.0; };
+
+    Dist poll{"poll-only", {}};
+    Dist wd{"watchdog", {}};
+    poll.us.reserve(static_cast<size_t>(cuts));
+    wd.us.reserve(static_cast<size_t>(cuts));
+
+    for (int c = 0; c < cuts; ++c)
+    {
+        // Frame phase and cut instant are independent of the poll grid.
+        const double phase = u01(rng) * frame_us;
+        const double cut = 1e6 + u01(rng) * 1e5;
+        const double last_frame = phase + std::floor((cut - phase) / frame_us) * frame_us;
+
+        // First poll at or after the last frame: it sees the frame and (re)arms both detectors.
+        int64_t k = static_cast<int64_t>(last_frame / poll_us);
+        double seen = poll_at(k);
+        while (seen < last_frame)
+            seen = poll_at(++k);
+
+        // Watchdog: deadline from the arming poll, published as soon as the timer task runs.
+        wd.us.push_back(seen + timeout_us + dispatch_us - last_frame);
+
+        // Poll-only: the first later poll at least the timeout after the arming poll.
+        double p = poll_at(++k);
+        while (p - seen < timeout_us)
+            p = poll_at(++k);
+        poll.us.push_back(p - last_frame);
+    }
+
+    printf("Cut link, %d trials: frame %.1f ms, poll %.0f ms (+0..%.1f ms late), timeout %u ms, timer dispatch %.0f us\n",
+           cuts, frame_ms, poll_us / 1000.0, jitter_ms, cfg::rc::LINK_TIMEOUT_MS, dispatch_us);
+    printf("Latency from the last frame to the failsafe publish:\n");
+    report(poll);
+    report(wd);
+    histogram(poll, wd);
+    return 0;
+}
@@ -0,0 +1,375 @@
+/**
+ * MIT License
+ *
+ * @brief RC filter check: noise variance on a noisy stream, spike rejection, throttle rise/release timing and cost.
+ *
+ * Build from the repository root:
+ *
+ *   g++ -O2 -std=gnu++17 -Isrc/utils tools/rc/filter_check.cpp -o rc_filter_check
+ *
+ * Usage: rc_filter_check [--rate HZ] [--seed S] [--frames N]
+ *        rc_filter_check --capture FILE [--preset stick|throttle|knob] [--rate HZ]
+ *
+ * Runs RcPublisher's presets (RcFilter.h) at the publisher poll rate. The
+ * input is a held stick position plus receiver jitter (Gaussian), then
+ * the same position with occasional single-frame spikes, in the fixed-point
+ * counts the publisher filters. Each preset must at least halve the jitter
+ * variance, and the presets with a median stage must keep spikes out of the
+ * output. The throttle chain must still slew a 0 → 100 % rise over
+ * ≥ 25 samples, and a 100 → 0 % release must not be slewed: it must fall
+ * below 1 % within the low-pass settling budget. Last, FilterBank::apply is
+ * timed over N frames at 10 and 18 channels (the publisher's role mix) and
+ * reported in ns/frame. The exit status is the number of failed checks.
+ *
+ * With --capture, a recorded stream replaces the synthetic one: a CSV of raw
+ * channel values in µs, one frame per line as polled (lines that are not
+ * numbers, such as a header, are skipped). Every channel runs through the
+ * chosen preset. Noise is what is left after subtracting a centred moving
+ * average from the signal, so slow stick movement in the recording barely
+ * counts; each channel that shows any noise must have its noise variance
+ * at least halved.
+ *
+ * @file filter_check.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <RcFilter.h>
+#include <RcLut.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr int kSamples = 20000;     ///< Noisy samples per preset.
+    constexpr float kJitterUs = 4.0f;   ///< Receiver jitter, 1 σ (µs).
+    constexpr float kSpikeRate = 0.01f; ///< Share of samples replaced by a spike...
+    constexpr float kSpikeUs = 300.0f;  ///< ...this far off (µs).
+
+    int failures = 0;
+
+    void verdict(bool ok, const char *what)
+    {
+        printf("  %-44s %s\n", what, ok ? "ok" : "FAIL");
+        failures += ok ? 0 : 1;
+    }
+
+    /// @brief Mean and σ of (y − hold) after the first 100 samples.
+    struct Stats
+    {
+        double sd{0.0}; ///< Standard deviation (counts).
+        int worst{0};   ///< Largest |y − hold| (counts).
+    };
+
+    /**
+     * @brief Run a held value through a preset with optional jitter and single-frame spikes.
+     *
+     * @param jitter_sd Gaussian jitter σ (counts, 0 = none).
+     * @param spike Spike height (counts, 0 = none); spikes are at least three samples apart (the median window).
+     * @param raw If true, measure the input instead of the output.
+     */
+    Stats run(const rcmap::FilterSpec &f, int16_t hold, float jitter_sd, float spike, bool raw, std::mt19937 &rng)
+    {
+        std::normal_distribution<float> jitter(0.0f, jitter_sd > 0.0f ? jitter_sd : 1.0f);
+        std::uniform_real_distribution<float> u(0.0f, 1.0f);
+
+        rcmap::Filter flt;
+        double sum = 0.0;
+        double sq = 0.0;
+        Stats st{};
+        int since_spike = 3;
+        for (int k = 0; k < kSamples; ++k)
+        {
+            float x = hold + (jitter_sd > 0.0f ? jitter(rng) : 0.0f);
+            const bool spiked = spike > 0.0f && since_spike >= 3 && u(rng) < kSpikeRate;
+            if (spiked)
+                x += (u(rng) < 0.5f ? -spike : spike);
+            since_spike = spiked ? 1 : since_spike + 1;
+
+            const int16_t in = static_cast<int16_t>(std::lround(x));
+            const int16_t y = raw ? in : flt.apply(in, f);
+            if (k < 100)
+                continue; ///< Let the chain settle.
+            const double d = static_cast<double>(y - hold);
+            sum += d;
+            sq += d * d;
+            const int dev = std::abs(y - hold);
+            st.worst = dev > st.worst ? dev : st.worst;
+        }
+        const int n = kSamples - 100;
+        st.sd = std::sqrt(sq / n - (sum / n) * (sum / n));
+        return st;
+    }
+
+    /// @brief Jitter variance and spike rejection for one preset.
+    void noisy(const char *name, const rcmap::FilterSpec &f, float counts_per_us, int16_t hold, std::mt19937 &rng)
+    {
+        const float sd = kJitterUs * counts_per_us;
+        const float spike = kSpikeUs * counts_per_us;
+        const Stats in = run(f, hold, sd, 0.0f, true, rng);
+        const Stats out = run(f, hold, sd, 0.0f, false, rng);
+        const Stats sp = run(f, hold, 0.0f, spike, false, rng);
+        printf("%-9s jitter σ in %6.1f out %6.1f counts (variance x%.2f); spikes of %.0f counts leak %d\n", name,
+               in.sd, out.sd, (out.sd * out.sd) / (in.sd * in.sd), spike, sp.worst);
+
+        char what[96];
+        snprintf(what, sizeof(what), "%s: jitter variance at most half", name);
+        verdict(out.sd * out.sd <= 0.5 * in.sd * in.sd, what);
+        if (f.median3)
+        {
+            snprintf(what, sizeof(what), "%s: single-frame spikes rejected", name);
+            verdict(sp.worst <= 2 * static_cast<int>(sd + 1.0f), what);
+        }
+    }
+
+    /// @brief Publisher role mix, repeated across the frame (stick, stick, throttle, knob, switch).
+    rcmap::FilterSpec role(size_t i, float rate_hz) noexcept
+    {
+        switch (i % 5)
+        {
+        case 2:
+            return rcmap::throttle_filter(rate_hz);
+        case 3:
+            return rcmap::knob_filter(rate_hz);
+        case 4:
+            return rcmap::switch_filter();
+        default:
+            return rcmap::stick_filter(rate_hz);
+        }
+    }
+
+    /// @brief Time FilterBank::apply on jittered N-channel frames; returns ns/frame.
+    template <size_t N>
+    double bench(size_t frames, float rate_hz, std::mt19937 &rng)
+    {
+        rcmap::FilterBank<N> bank;
+        for (size_t i = 0; i < N; ++i)
+            bank.configure(i, role(i, rate_hz));
+
+        // Frames reused round-robin so generation stays out of the timing.
+        constexpr size_t kPool = 4096;
+        std::normal_distribution<float> jitter(0.0f, kJitterUs * 200.0f * rcmap::kScale / 1000.0f);
+        std::vector<int16_t> pool(kPool * N);
+        for (size_t k = 0; k < pool.size(); ++k)
+            pool[k] = static_cast<int16_t>(std::lround(rcmap::to_fixed(30.0f) + jitter(rng)));
+
+        using clock = std::chrono::steady_clock;
+        int16_t v[N];
+        long sink = 0;
+        const auto t0 = clock::now();
+        for (size_t k = 0; k < frames; ++k)
+        {
+            memcpy(v, &pool[(k % kPool) * N], sizeof(v));
+            bank.apply(v, N);
+            sink += v[k % N];
+        }
+        const double ns = std::chrono::duration<double, std::nano>(clock::now() - t0).count() / frames;
+        printf("%2zu channels: FilterBank::apply %6.1f ns/frame (%.1f ns/channel), state %zu B [%ld]\n", N, ns,
+               ns / N, sizeof(bank), sink);
+        return ns;
+    }
+
+    /// @brief Noise σ about a centred moving average of @p x, after the first @p skip samples.
+    double residual_sd(const std::vector<int16_t> &x, size_t skip)
+    {
+        constexpr size_t kHalf = 15; ///< 31 samples: 310 ms at 100 Hz, slower than any jitter.
+        double sq = 0.0;
+        size_t n = 0;
+        for (size_t k = skip + kHalf; k + kHalf < x.size(); ++k)
+        {
+            long sum = 0;
+            for (size_t j = k - kHalf; j <= k + kHalf; ++j)
+                sum += x[j];
+            const double d = x[k] - static_cast<double>(sum) / (2 * kHalf + 1);
+            sq += d * d;
+            ++n;
+        }
+        return n == 0 ? 0.0 : std::sqrt(sq / n);
+    }
+
+    /**
+     * @brief Run a recorded raw-µs capture through @p f, channel by channel.
+     *
+     * @param bipolar True → ±100 around 1500 µs (sticks); false → 0–100 from 1000 µs.
+     * @return False if the file holds no frames.
+     */
+    bool capture(const char *path, const char *name, const rcmap::FilterSpec &f, bool bipolar)
+    {
+        FILE *fp = fopen(path, "r");
+        if (fp == nullptr)
+        {
+            fprintf(stderr, "cannot open %s\n", path);
+            return false;
+        }
+
+        const float cpu = (bipolar ? 200.0f : 100.0f) * rcmap::kScale / 1000.0f; ///< Counts per raw µs.
+        const float zero_us = bipolar ? 1500.0f : 1000.0f;
+        std::vector<std::vector<int16_t>> ch;
+        size_t frames = 0;
+        char line[1024];
+        while (fgets(line, sizeof(line), fp) != nullptr)
+        {
+            const char *c = line;
+            while (*c == ' ' || *c == '\t')
+                ++c;
+            if (*c < '0' || *c > '9')
+                continue; ///< Header or comment.
+            size_t i = 0;
+            char *end = nullptr;
+            for (const char *q = c;; q = end + 1)
+            {
+                const double us = strtod(q, &end);
+                if (end == q)
+                    break;
+                if (ch.size() <= i)
+                    ch.emplace_back(frames, static_cast<int16_t>(0)); ///< Late channel: pad earlier frames.
+                ch[i++].push_back(static_cast<int16_t>(std::lround((us - zero_us) * cpu)));
+                if (*end != ',' && *end != ';' && *end != '\t' && *end != ' ')
+                    break;
+            }
+            for (; i < ch.size(); ++i)
+                ch[i].push_back(ch[i].empty() ? 0 : ch[i].back()); ///< Short line: hold the last value.
+            ++frames;
+        }
+        fclose(fp);
+        if (frames < 200)
+        {
+            fprintf(stderr, "%s: %zu frames, need at least 200\n", path, frames);
+            return false;
+        }
+
+        printf("Capture %s (%zu frames, %zu channels, preset %s):\n", path, frames, ch.size(), name);
+        for (size_t i = 0; i < ch.size(); ++i)
+        {
+            rcmap::Filter flt;
+            std::vector<int16_t> out(ch[i].size());
+            for (size_t k = 0; k < ch[i].size(); ++k)
+                out[k] = flt.apply(ch[i][k], f);
+
+            const double in_sd = residual_sd(ch[i], 100);
+            const double out_sd = residual_sd(out, 100);
+            if (in_sd <= 0.0)
+            {
+                printf("  ch%-2zu quiet (no noise)\n", i + 1);
+                continue;
+            }
+            printf("  ch%-2zu noise σ in %6.1f out %6.1f counts (variance x%.2f)\n", i + 1, in_sd, out_sd,
+                   (out_sd * out_sd) / (in_sd * in_sd));
+            char what[96];
+            snprintf(what, sizeof(what), "ch%zu: noise variance at most half", i + 1);
+            verdict(out_sd * out_sd <= 0.5 * in_sd * in_sd, what);
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    float rate_hz = 100.0f; ///< cfg::tick::LOOP_MS = 10.
+    unsigned seed = 53;
+    size_t frames = 2000000;
+    const char *path = nullptr;
+    const char *preset = "stick";
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--rate") && i + 1 < argc)
+            rate_hz = static_cast<float>(atof(argv[++i]));
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+            seed = static_cast<unsigned>(atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = static_cast<size_t>(atoll(argv[++i]));
+        else if (!strcmp(argv[i], "--capture") && i + 1 < argc)
+            path = argv[++i];
+        else if (!strcmp(argv[i], "--preset") && i + 1 < argc)
+            preset = argv[++i];
+        else
+        {
+            fprintf(stderr,
+                    "usage: %s [--rate HZ] [--seed S] [--frames N]\n"
+                    "       %s --capture FILE [--preset stick|throttle|knob] [--rate HZ]\n",
+                    argv[0], argv[0]);
+            return 2;
+        }
+    }
+    if (frames == 0)
+        frames = 1;
+
+    std::mt19937 rng(seed);
+    const rcmap::FilterSpec stick = rcmap::stick_filter(rate_hz);
+    const rcmap::FilterSpec throttle = rcmap::throttle_filter(rate_hz);
+    const rcmap::FilterSpec knob = rcmap::knob_filter(rate_hz);
+
+    if (path != nullptr)
+    {
+        bool ok = false;
+        if (!strcmp(preset, "stick"))
+            ok = capture(path, preset, stick, true);
+        else if (!strcmp(preset, "throttle"))
+            ok = capture(path, preset, throttle, false);
+        else if (!strcmp(preset, "knob"))
+            ok = capture(path, preset, knob, false);
+        else
+            fprintf(stderr, "unknown preset %s\n", preset);
+        if (!ok)
+            return 2;
+        printf("%s (%d failed)\n", failures == 0 ? "PASS" : "FAIL", failures);
+        return failures;
+    }
+
+    // Output counts per raw µs: ±100 over 1000 µs for sticks, 0–100 over 1000 µs for throttle and knobs.
+    const float stick_cpu = 200.0f * rcmap::kScale / 1000.0f;
+    const float unipolar_cpu = 100.0f * rcmap::kScale / 1000.0f;
+
+    printf("Noisy stream (%d samples at %.0f Hz, jitter %.0f µs σ, %.0f %% spikes of %.0f µs):\n", kSamples, rate_hz,
+           kJitterUs, kSpikeRate * 100.0f, kSpikeUs);
+    noisy("stick", stick, stick_cpu, rcmap::to_fixed(30.0f), rng);
+    noisy("throttle", throttle, unipolar_cpu, rcmap::to_fixed(50.0f), rng);
+    noisy("knob", knob, unipolar_cpu, rcmap::to_fixed(50.0f), rng);
+
+    // Throttle step response.
+    const int16_t full = rcmap::to_fixed(100.0f);
+    const int16_t one_pct = rcmap::to_fixed(1.0f);
+    rcmap::Filter flt;
+    flt.reset(0);
+    int rise = -1;
+    for (int k = 0; k < 200 && rise < 0; ++k)
+        if (flt.apply(full, throttle) >= full - one_pct)
+            rise = k + 1;
+    for (int k = 0; k < 200; ++k)
+        flt.apply(full, throttle); ///< Settle at 100 %.
+
+    int release = -1;
+    int zero = -1;
+    for (int k = 0; k < 400 && zero < 0; ++k)
+    {
+        const int16_t y = flt.apply(0, throttle);
+        if (release < 0 && y <= one_pct)
+            release = k + 1;
+        if (y == 0)
+            zero = k + 1;
+    }
+
+    const float ms = 1000.0f / rate_hz;
+    const float keep = 1.0f - static_cast<float>(throttle.alpha_q15) / rcmap::kAlphaOne;  ///< Low-pass decay per sample.
+    const int settle = static_cast<int>(std::ceil(std::log(0.01f) / std::log(keep))) + 2; ///< To 1 %, + median + rounding.
+    printf("Throttle: rise 0 -> 99 %% in %d samples (%.0f ms), release 100 -> 1 %% in %d samples (%.0f ms), "
+           "-> 0 in %d samples (%.0f ms)\n",
+           rise, rise * ms, release, release * ms, zero, zero * ms);
+    verdict(rise >= 25, "throttle: rise slewed (>= 25 samples)");
+    char what[96];
+    snprintf(what, sizeof(what), "throttle: release not slewed (<= %d samples)", settle);
+    verdict(release > 0 && release <= settle, what);
+
+    printf("Cost (%zu frames, role mix stick/stick/throttle/knob/switch):\n", frames);
+    bench<10>(frames, rate_hz, rng); ///< The publisher's roles today.
+    bench<18>(frames, rate_hz, rng); ///< A full 16-channel SBUS/CRSF frame plus two.
+
+    printf("%s (%d failed)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    return failures;
+}
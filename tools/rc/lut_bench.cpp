@@ -0,0 +1,168 @@
+/**
+ * MIT License
+ *
+ * @brief RC mapping cost: per-role lookup tables against the per-sample float path, at 10 and 18 channels.
+ *
+ * Build from the repository root:
+ *
+ *   g++ -O2 -std=gnu++17 -Isrc/utils tools/rc/lut_bench.cpp -o rc_lut_bench
+ *
+ * Usage: rc_lut_bench [--frames N]
+ *
+ * The float path is the mapping RcLink did per sample before the tables:
+ * clamp, deadband, then a divide and multiply per axis (or a threshold walk
+ * per switch), giving float engineering units. The table path is what
+ * RcPublisher runs now: Bank::map (one indexed load per channel) then
+ * to_float. Both see the same random frames. First every raw value from
+ * 900 to 2100 µs is checked: the table must equal the float path rounded to
+ * the fixed-point grid, on every channel. The exit status is non-zero on
+ * any mismatch.
+ *
+ * @file lut_bench.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <RcLut.h>
+#include <RcConvert.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// @brief One channel: axis or switch (the publisher's role mix, repeated).
+    struct Channel
+    {
+        bool is_switch;
+        rcmap::AxisSpec axis;
+        rcmap::SwitchSpec sw;
+    };
+
+    Channel channel(size_t i)
+    {
+        static const Channel kMix[] = {
+            {false, {1000, 2000, 1500, 8, -100.f, 100.f}, {}},    ///< Stick.
+            {false, {1000, 2000, 1000, 8, 0.f, 100.f}, {}},       ///< Throttle (end-stop center).
+            {false, {1000, 2000, 1500, 4, 0.f, 100.f}, {}},       ///< Knob.
+            {true, {}, {2, {1000, 2000}, {0.f, 1.f}}},            ///< Two-position switch.
+            {true, {}, {3, {1000, 1500, 2000}, {0.f, 1.f, 2.f}}}, ///< Three-position switch.
+        };
+        return kMix[i % (sizeof(kMix) / sizeof(kMix[0]))];
+    }
+
+    /// @brief Per-sample float mapping (the pre-table path; same arithmetic build_axis() uses).
+    float map_axis_float(int raw, const rcmap::AxisSpec &a) noexcept
+    {
+        raw = raw < rcmap::kRawMin ? rcmap::kRawMin : (raw > rcmap::kRawMax ? rcmap::kRawMax : raw);
+        raw = raw < a.raw_min ? a.raw_min : (raw > a.raw_max ? a.raw_max : raw);
+        const float c = (a.center <= a.raw_min)   ? a.out_min
+                        : (a.center >= a.raw_max) ? a.out_max
+                                                  : 0.5f * (a.out_min + a.out_max);
+        const int lo = a.center - a.deadband_us;
+        const int hi = a.center + a.deadband_us;
+        if (raw > hi && a.raw_max > hi)
+            return c + (a.out_max - c) * static_cast<float>(raw - hi) / static_cast<float>(a.raw_max - hi);
+        if (raw < lo && lo > a.raw_min)
+            return c + (a.out_min - c) * static_cast<float>(lo - raw) / static_cast<float>(lo - a.raw_min);
+        return c;
+    }
+
+    float map_switch_float(int raw, const rcmap::SwitchSpec &s) noexcept
+    {
+        raw = raw < rcmap::kRawMin ? rcmap::kRawMin : (raw > rcmap::kRawMax ? rcmap::kRawMax : raw);
+        size_t level = 0;
+        while (level + 1 < s.count && raw * 2 >= s.raw[level] + s.raw[level + 1])
+            ++level;
+        return s.values[level];
+    }
+
+    /// @brief Check, then time both paths for an N-channel frame; false on a table mismatch.
+    template <size_t N>
+    bool bench(size_t frames)
+    {
+        Channel ch[N];
+        rcmap::Bank<N> bank;
+        for (size_t i = 0; i < N; ++i)
+        {
+            ch[i] = channel(i);
+            if (ch[i].is_switch)
+                bank.set_switch(i, ch[i].sw);
+            else
+                bank.set_axis(i, ch[i].axis);
+        }
+
+        // Exhaustive check over the raw range (and past both ends).
+        size_t bad = 0;
+        for (size_t i = 0; i < N; ++i)
+            for (int raw = 900; raw <= 2100; ++raw)
+            {
+                const float f = ch[i].is_switch ? map_switch_float(raw, ch[i].sw) : map_axis_float(raw, ch[i].axis);
+                if (bank.map(i, static_cast<int16_t>(raw)) != rcmap::to_fixed(f))
+                    ++bad;
+            }
+
+        // Random frames, reused round-robin so generation stays out of the timing.
+        constexpr size_t kPool = 4096;
+        std::mt19937 rng(51);
+        std::uniform_int_distribution<int> us(980, 2020);
+        std::vector<int16_t> raw(kPool * N);
+        for (int16_t &r : raw)
+            r = static_cast<int16_t>(us(rng));
+
+        using clock = std::chrono::steady_clock;
+        float out[N];
+        double sink = 0.0;
+
+        auto t0 = clock::now();
+        for (size_t k = 0; k < frames; ++k)
+        {
+            const int16_t *fr = &raw[(k % kPool) * N];
+            for (size_t i = 0; i < N; ++i)
+                out[i] = ch[i].is_switch ? map_switch_float(fr[i], ch[i].sw) : map_axis_float(fr[i], ch[i].axis);
+            sink += out[k % N];
+        }
+        const double float_ns = std::chrono::duration<double, std::nano>(clock::now() - t0).count() / frames;
+
+        t0 = clock::now();
+        for (size_t k = 0; k < frames; ++k)
+        {
+            const int16_t *fr = &raw[(k % kPool) * N];
+            int16_t mapped[N];
+            bank.map(fr, mapped, N);
+            rcmap::to_float(mapped, out, N, rcmap::kLsb);
+            sink += out[k % N];
+        }
+        const double lut_ns = std::chrono::duration<double, std::nano>(clock::now() - t0).count() / frames;
+
+        printf("%2zu channels: float %6.1f ns/frame, table %6.1f ns/frame (%.1fx), tables %5zu B RAM, "
+               "check %s (%zu mismatches) [%g]\n",
+               N, float_ns, lut_ns, float_ns / lut_ns, sizeof(bank), bad == 0 ? "ok" : "FAILED", bad, sink);
+        return bad == 0;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t frames = 2000000;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = static_cast<size_t>(atoll(argv[++i]));
+        else
+        {
+            fprintf(stderr, "usage: %s [--frames N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (frames == 0)
+        frames = 1;
+
+    const bool ok10 = bench<10>(frames); ///< The publisher's roles today.
+    const bool ok18 = bench<18>(frames); ///< A full 16-channel SBUS/CRSF frame plus two.
+    return (ok10 && ok18) ? 0 : 1;
+}
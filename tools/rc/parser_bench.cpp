@@ -0,0 +1,362 @@
+/**
+ * MIT License
+ *
+ * @brief SBUS and CRSF streaming parser throughput and correctness on byte streams.
+ *
+ * Build from the repository root:
+ *
+ *   g++ -O2 -std=gnu++17 -Isrc/utils tools/rc/parser_bench.cpp -o rc_parser_bench
+ *
+ * Usage: rc_parser_bench [--frames N] [--noise PCT] [--seed S]
+ *        rc_parser_bench --file sbus|crsf CAPTURE
+ *
+ * Without --file, a stream is synthesised for each protocol. It holds N
+ * channel frames with random sticks, and CRSF gets a LINK_STATISTICS frame
+ * every 10 channel frames. Optional line noise (--noise: that share of
+ * frames get a flipped byte, or a burst of garbage ahead of them) makes the
+ * resync paths run too. Every intact frame must decode to exactly the
+ * channels that were packed, CRSF link quality must stay unreported until
+ * the first statistics frame, and damaged frames must not decode. The bench
+ * reports parse cost per byte and per frame, throughput, and the frame's
+ * wire time at the protocol baud rate, which is the latency the parser adds
+ * to. The exit status is non-zero if any check fails.
+ *
+ * With --file, a raw UART capture (bytes exactly as read from the receiver
+ * port) is parsed and its frame, resync and CRC counts reported with the
+ * same timing.
+ *
+ * @file parser_bench.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <RcParsers.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using clock = std::chrono::steady_clock;
+
+    /// @brief Pack 16 × 11-bit ticks LSB first (inverse of rcproto::unpack11).
+    void pack11(const uint16_t *t, uint8_t *out)
+    {
+        uint32_t bits = 0;
+        uint8_t have = 0;
+        size_t o = 0;
+        for (size_t i = 0; i < rcproto::kMaxChannels; ++i)
+        {
+            bits |= static_cast<uint32_t>(t[i] & 0x07FFu) << have;
+            have += 11;
+            while (have >= 8)
+            {
+                out[o++] = static_cast<uint8_t>(bits);
+                bits >>= 8;
+                have -= 8;
+            }
+        }
+    }
+
+    /// @brief Stream plus what should come out of it.
+    struct Stream
+    {
+        std::vector<uint8_t> bytes;                   ///< Wire bytes.
+        std::vector<std::vector<int16_t>> expect;     ///< Channels (µs) of each intact channel frame, in order.
+        size_t damaged{0};                            ///< Channel frames with a flipped byte.
+        size_t disturbed{0};                          ///< Channel frames damaged or preceded by garbage.
+        size_t first_link_frame{0};                   ///< Channel frames before the first LINK_STATISTICS.
+        std::map<std::vector<int16_t>, size_t> index; ///< Intact frame channels → position in expect.
+    };
+
+    /// @brief Noise ahead of a frame, or a flipped byte inside it; returns true if the frame itself is damaged.
+    template <typename Rng>
+    bool disturb(std::vector<uint8_t> &frame, Stream &s, float noise, Rng &rng)
+    {
+        std::uniform_real_distribution<float> u(0.0f, 1.0f);
+        std::vector<uint8_t> &out = s.bytes;
+        if (u(rng) >= noise)
+            return false;
+        ++s.disturbed;
+        if (u(rng) < 0.5f)
+        {
+            const size_t n = 1 + rng() % 40;
+            for (size_t i = 0; i < n; ++i)
+                out.push_back(static_cast<uint8_t>(rng())); ///< Garbage burst (the frame itself survives).
+            return false;
+        }
+        frame[2 + rng() % (frame.size() - 3)] ^= static_cast<uint8_t>(1u << (rng() % 8));
+        return true;
+    }
+
+    template <typename Rng>
+    std::vector<int16_t> random_channels(uint16_t *ticks, Rng &rng)
+    {
+        std::vector<int16_t> us(rcproto::kMaxChannels);
+        for (size_t i = 0; i < rcproto::kMaxChannels; ++i)
+        {
+            ticks[i] = static_cast<uint16_t>(172 + rng() % (1811 - 172 + 1));
+            us[i] = rcproto::ticks_to_us(ticks[i]);
+        }
+        return us;
+    }
+
+    template <typename Rng>
+    Stream make_sbus(size_t frames, float noise, Rng &rng)
+    {
+        Stream s;
+        for (size_t f = 0; f < frames; ++f)
+        {
+            uint16_t t[rcproto::kMaxChannels];
+            std::vector<int16_t> us = random_channels(t, rng);
+            std::vector<uint8_t> fr(rcproto::SbusParser::kFrameLen, 0);
+            fr[0] = rcproto::SbusParser::kHeader;
+            pack11(t, &fr[1]);
+            fr[23] = 0x00;
+            fr[24] = 0x00;
+            if (disturb(fr, s, noise, rng))
+                ++s.damaged; ///< SBUS has no CRC: only a broken footer is caught, so damaged frames are not checked.
+            else
+            {
+                s.index.emplace(us, s.expect.size()); ///< Random sticks: duplicates are vanishingly rare.
+                s.expect.push_back(us);
+            }
+            s.bytes.insert(s.bytes.end(), fr.begin(), fr.end());
+        }
+        return s;
+    }
+
+    std::vector<uint8_t> crsf_frame(uint8_t type, const uint8_t *payload, size_t n)
+    {
+        std::vector<uint8_t> fr;
+        fr.reserve(n + 4);
+        fr.push_back(rcproto::CrsfParser::kAddrFc);
+        fr.push_back(static_cast<uint8_t>(n + 2));
+        fr.push_back(type);
+        for (size_t i = 0; i < n; ++i)
+            fr.push_back(payload[i]);
+        uint8_t crc = 0;
+        for (size_t i = 2; i < fr.size(); ++i)
+            crc = rcproto::kCrc8D5[crc ^ fr[i]];
+        fr.push_back(crc);
+        return fr;
+    }
+
+    template <typename Rng>
+    Stream make_crsf(size_t frames, float noise, Rng &rng)
+    {
+        Stream s;
+        s.first_link_frame = 5;
+        for (size_t f = 0; f < frames; ++f)
+        {
+            if (f % 10 == s.first_link_frame)
+            {
+                const uint8_t stats[10] = {40, 45, 87, 9, 0, 4, 0, 0, 0, 0}; ///< RSSI, RSSI2, LQ 87 %, SNR, …
+                const std::vector<uint8_t> fr = crsf_frame(rcproto::CrsfParser::kTypeLinkStats, stats, sizeof(stats));
+                s.bytes.insert(s.bytes.end(), fr.begin(), fr.end());
+            }
+            uint16_t t[rcproto::kMaxChannels];
+            std::vector<int16_t> us = random_channels(t, rng);
+            uint8_t packed[22];
+            pack11(t, packed);
+            std::vector<uint8_t> fr = crsf_frame(rcproto::CrsfParser::kTypeChannels, packed, sizeof(packed));
+            if (disturb(fr, s, noise, rng))
+                ++s.damaged;
+            else
+            {
+                s.index.emplace(us, s.expect.size()); ///< Random sticks: duplicates are vanishingly rare.
+                s.expect.push_back(us);
+            }
+            s.bytes.insert(s.bytes.end(), fr.begin(), fr.end());
+        }
+        return s;
+    }
+
+    int failures = 0;
+
+    /**
+     * @brief Match a decoded frame against the intact frames, which must come out in order.
+     * @note Garbage can swallow the frames after it (the parser is mid-way through a false
+     *       frame), so expected frames may be skipped; a decoded frame never matches backwards.
+     */
+    bool match(const Stream &s, const int16_t *us, size_t &next)
+    {
+        const auto it = s.index.find(std::vector<int16_t>(us, us + rcproto::kMaxChannels));
+        if (it == s.index.end() || it->second < next)
+            return false;
+        next = it->second + 1;
+        return true;
+    }
+
+    void verdict(bool ok, const char *what)
+    {
+        printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+        failures += ok ? 0 : 1;
+    }
+
+    /// @brief Time one pass over the stream; returns frames decoded.
+    template <typename Parser>
+    size_t timed(const std::vector<uint8_t> &bytes, double &ns)
+    {
+        Parser p;
+        size_t frames = 0;
+        const auto t0 = clock::now();
+        for (uint8_t b : bytes)
+            frames += p.push(b) ? 1 : 0;
+        ns = std::chrono::duration<double, std::nano>(clock::now() - t0).count();
+        return frames;
+    }
+
+    template <typename Parser>
+    void throughput(const char *name, const std::vector<uint8_t> &bytes, size_t frame_bytes, double bits_per_byte,
+                    double baud)
+    {
+        double best = 1e300;
+        size_t frames = 0;
+        for (int rep = 0; rep < 5; ++rep)
+        {
+            double ns = 0.0;
+            frames = timed<Parser>(bytes, ns);
+            best = ns < best ? ns : best;
+        }
+        const double wire_us = static_cast<double>(frame_bytes) * bits_per_byte / baud * 1e6;
+        printf("%-5s %zu bytes, %zu frames: %.2f ns/byte, %.0f ns/frame, %.0f MB/s; frame wire time %.0f us "
+               "at %.0f baud (parse adds %.3f %%)\n",
+               name, bytes.size(), frames, best / static_cast<double>(bytes.size()),
+               best / static_cast<double>(frames ? frames : 1), static_cast<double>(bytes.size()) * 1e3 / best,
+               wire_us, baud, 100.0 * (best / static_cast<double>(frames ? frames : 1)) / (wire_us * 1000.0));
+    }
+
+    void check_sbus(const Stream &s)
+    {
+        rcproto::SbusParser p;
+        size_t next = 0;
+        size_t got = 0;
+        size_t wrong = 0;
+        for (uint8_t b : s.bytes)
+            if (p.push(b))
+                (match(s, p.channels_us(), next) ? got : wrong) += 1;
+
+        const size_t lost = s.expect.size() - got;
+        char what[96];
+        snprintf(what, sizeof(what), "sbus: intact frames lost (%zu) <= disturbed (%zu)", lost, s.disturbed);
+        verdict(lost <= s.disturbed, what);
+        snprintf(what, sizeof(what), "sbus: wrong frames (%zu) <= disturbed (%zu, no CRC)", wrong, s.disturbed);
+        verdict(wrong <= s.disturbed, what);
+        printf("  sbus: %zu of %zu intact frames decoded exactly, %u resyncs\n", got, s.expect.size(), p.resyncs());
+    }
+
+    void check_crsf(const Stream &s)
+    {
+        rcproto::CrsfParser p;
+        size_t next = 0;
+        size_t got = 0;
+        size_t wrong = 0;
+        size_t before_link = 0;
+        bool unknown_ok = true;
+        for (uint8_t b : s.bytes)
+            if (p.push(b))
+            {
+                (match(s, p.channels_us(), next) ? got : wrong) += 1;
+                if (!p.has_link())
+                    ++before_link;
+                unknown_ok = unknown_ok && (p.has_link() || !p.failsafe());
+            }
+
+        const size_t lost = s.expect.size() - got;
+        char what[96];
+        snprintf(what, sizeof(what), "crsf: intact frames lost (%zu) <= disturbed (%zu)", lost, s.disturbed);
+        verdict(lost <= s.disturbed, what);
+        verdict(wrong == 0, "crsf: no damaged frame decoded (CRC)");
+        verdict(before_link > 0 && unknown_ok, "crsf: link quality unreported before LINK_STATISTICS");
+        verdict(p.has_link() && p.link().lq == 87, "crsf: link quality 87 % after LINK_STATISTICS");
+        printf("  crsf: %zu of %zu intact frames decoded exactly, %u CRC errors, %u resyncs, %zu frames before link "
+               "statistics\n",
+               got, s.expect.size(), p.crc_errors(), p.resyncs(), before_link);
+    }
+
+    int from_file(const char *proto, const char *path)
+    {
+        FILE *f = fopen(path, "rb");
+        if (f == nullptr)
+        {
+            fprintf(stderr, "cannot read %s\n", path);
+            return 1;
+        }
+        std::vector<uint8_t> bytes;
+        uint8_t buf[65536];
+        for (size_t n; (n = fread(buf, 1, sizeof(buf), f)) > 0;)
+            bytes.insert(bytes.end(), buf, buf + n);
+        fclose(f);
+
+        if (!strcmp(proto, "sbus"))
+        {
+            rcproto::SbusParser p;
+            for (uint8_t b : bytes)
+                p.push(b);
+            printf("%s: %u frames, %u resyncs\n", path, p.frames(), p.resyncs());
+            throughput<rcproto::SbusParser>("sbus", bytes, rcproto::SbusParser::kFrameLen, 12.0, 100000.0);
+        }
+        else if (!strcmp(proto, "crsf"))
+        {
+            rcproto::CrsfParser p;
+            for (uint8_t b : bytes)
+                p.push(b);
+            printf("%s: %u frames, %u CRC errors, %u resyncs, link quality %s %u\n", path, p.frames(), p.crc_errors(),
+                   p.resyncs(), p.has_link() ? "" : "(none)", p.link().lq);
+            throughput<rcproto::CrsfParser>("crsf", bytes, 26, 10.0, 420000.0);
+        }
+        else
+        {
+            fprintf(stderr, "protocol must be sbus or crsf\n");
+            return 2;
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t frames = 200000;
+    float noise = 0.02f;
+    unsigned seed = 55;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--file") && i + 2 < argc)
+            return from_file(argv[i + 1], argv[i + 2]);
+        if (!strcmp(argv[i], "--frames") && i + 1 < argc)
+            frames = static_cast<size_t>(atoll(argv[++i]));
+        else if (!strcmp(argv[i], "--noise") && i + 1 < argc)
+            noise = static_cast<float>(atof(argv[++i])) / 100.0f;
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+            seed = static_cast<unsigned>(atoi(argv[++i]));
+        else
+        {
+            fprintf(stderr, "usage: %s [--frames N] [--noise PCT] [--seed S]\n       %s --file sbus|crsf CAPTURE\n",
+                    argv[0], argv[0]);
+            return 2;
+        }
+    }
+    if (frames < 20)
+        frames = 20;
+
+    std::mt19937 rng(seed);
+    const Stream sbus = make_sbus(frames, noise, rng);
+    const Stream crsf = make_crsf(frames, noise, rng);
+
+    printf("Checks (%zu frames per protocol, %.1f %% disturbed):\n", frames, noise * 100.0f);
+    check_sbus(sbus);
+    check_crsf(crsf);
+
+    printf("Throughput (best of 5):\n");
+    throughput<rcproto::SbusParser>("sbus", sbus.bytes, rcproto::SbusParser::kFrameLen, 12.0, 100000.0); ///< 8E2.
+    throughput<rcproto::CrsfParser>("crsf", crsf.bytes, 26, 10.0, 420000.0);                             ///< 8N1.
+
+    printf("%s (%d failed)\n", failures == 0 ? "PASS" : "FAIL", failures);
+    return failures;
+}
@@ -0,0 +1,357 @@
+/**
+ * MIT License
+ *
+ * @brief RcPublisher on the host: the firmware RC path from UART bytes to RcBus, per receiver protocol.
+ *
+ * Build from the repository root, once per protocol (Ibus, Sbus or Crsf):
+ *
+ *   g++ -O2 -std=gnu++17 -DRC_PROTOCOL=Sbus -Itools/sim/host -Isrc/config -Isrc/include -Isrc/lib -Isrc/utils \
+ *       tools/rc/publisher_check.cpp src/lib/RcPublisher/RcPublisher.cpp src/lib/RcTransports/RcTransports.cpp \
+ *       tools/sim/host/SimHost.cpp -o rc_publisher_check_sbus
+ *
+ * Usage: rc_publisher_check [--verbose]
+ *
+ * The unmodified RcPublisher and RcTransports are compiled against the host
+ * stand-in for RCLink (tools/sim/host/RCLink.h), which spells out the RCLink
+ * surface the firmware assumes. Encoded receiver frames are injected into
+ * Serial2 every cfg::rc::FRAME_US on a simulated 1 ms clock. RcPublisher::step()
+ * runs every cfg::tick::LOOP_MS, and also right away when the frame watchdog
+ * notifies the task, as the firmware task would. Checks:
+ *
+ *  - UART opened at cfg::rc::BAUD with the protocol's framing.
+ *  - Boot with nothing received → failsafe, not linked.
+ *  - Live frames → sticks, knobs and switches mapped to engineering units.
+ *  - Link cut → failsafe frame within LINK_TIMEOUT_MS + one poll, still linked,
+ *    recorded once on the RcLinkLost event bus.
+ *  - Frames resume → live again within one frame and one poll.
+ *  - Receiver failsafe signature → failsafe outputs (speed 0).
+ *  - SBUS failsafe flag / CRSF link quality: reported through the RcSnapshot.
+ *
+ * The exit status is the number of failed checks.
+ *
+ * @file publisher_check.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <RcPublisher/RcPublisher.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    using Proto = cfg::rc::Protocol;
+    constexpr Proto kProto = cfg::rc::PROTOCOL;
+    constexpr size_t kCh = rcproto::kMaxChannels; ///< Channels encoded per frame (iBUS sends the first 14).
+
+    const char *proto_name()
+    {
+        return kProto == Proto::Sbus ? "SBUS" : kProto == Proto::Crsf ? "CRSF" : "iBUS";
+    }
+
+    /// @brief µs → 11-bit ticks (inverse of rcproto::ticks_to_us).
+    uint16_t to_ticks(int16_t us) { return static_cast<uint16_t>(992 + ((us - 1500) * 8) / 5); }
+
+    /// @brief Pack 16 × 11-bit ticks LSB first (inverse of rcproto::unpack11).
+    void pack11(const uint16_t *t, uint8_t *out)
+    {
+        uint32_t bits = 0;
+        uint8_t have = 0;
+        size_t o = 0;
+        for (size_t i = 0; i < kCh; ++i)
+        {
+            bits |= static_cast<uint32_t>(t[i] & 0x07FFu) << have;
+            have += 11;
+            while (have >= 8)
+            {
+                out[o++] = static_cast<uint8_t>(bits);
+                bits >>= 8;
+                have -= 8;
+            }
+        }
+    }
+
+    std::vector<uint8_t> crsf_frame(uint8_t type, const uint8_t *payload, size_t n)
+    {
+        std::vector<uint8_t> fr;
+        fr.reserve(n + 4);
+        fr.push_back(rcproto::CrsfParser::kAddrFc);
+        fr.push_back(static_cast<uint8_t>(n + 2));
+        fr.push_back(type);
+        for (size_t i = 0; i < n; ++i)
+            fr.push_back(payload[i]);
+        uint8_t crc = 0;
+        for (size_t i = 2; i < fr.size(); ++i)
+            crc = rcproto::kCrc8D5[crc ^ fr[i]];
+        fr.push_back(crc);
+        return fr;
+    }
+
+    /// @brief One receiver frame on the wire for the selected protocol.
+    std::vector<uint8_t> encode(const int16_t *us, bool sbus_failsafe)
+    {
+        if (kProto == Proto::Sbus)
+        {
+            uint16_t t[kCh];
+            for (size_t i = 0; i < kCh; ++i)
+                t[i] = to_ticks(us[i]);
+            std::vector<uint8_t> fr(rcproto::SbusParser::kFrameLen, 0);
+            fr[0] = rcproto::SbusParser::kHeader;
+            pack11(t, &fr[1]);
+            fr[23] = sbus_failsafe ? rcproto::SbusParser::kFsBit : 0x00;
+            return fr;
+        }
+
+        if (kProto == Proto::Crsf)
+        {
+            uint16_t t[kCh];
+            uint8_t payload[22];
+            for (size_t i = 0; i < kCh; ++i)
+                t[i] = to_ticks(us[i]);
+            pack11(t, payload);
+            return crsf_frame(rcproto::CrsfParser::kTypeChannels, payload, sizeof(payload));
+        }
+
+        std::vector<uint8_t> fr(rc::RcIbusTransport::kFrameLen, 0);
+        fr[0] = 0x20;
+        fr[1] = 0x40;
+        for (size_t i = 0; i < rc::RcIbusTransport::kChannels; ++i)
+        {
+            fr[2 + 2 * i] = static_cast<uint8_t>(us[i] & 0xFF);
+            fr[3 + 2 * i] = static_cast<uint8_t>(us[i] >> 8);
+        }
+        uint16_t sum = 0xFFFF;
+        for (size_t i = 0; i < fr.size() - 2; ++i)
+            sum = static_cast<uint16_t>(sum - fr[i]);
+        fr[30] = static_cast<uint8_t>(sum & 0xFF);
+        fr[31] = static_cast<uint8_t>(sum >> 8);
+        return fr;
+    }
+
+    /// @brief What the receiver is sending.
+    struct Tx
+    {
+        bool on{false};      ///< Frames on the wire.
+        int16_t us[kCh]{};   ///< Channel values (µs).
+        bool sbus_fs{false}; ///< SBUS failsafe flag.
+    };
+
+    /// @brief Publisher on the simulated clock, fed by a simulated receiver.
+    struct Bench
+    {
+        RcPublisher pub{};         ///< Unit under test.
+        Tx tx{};                   ///< Receiver output.
+        uint64_t t_us{0};          ///< Simulated time.
+        uint64_t next_frame_us{0}; ///< Next frame due.
+        uint64_t last_frame_us{0}; ///< Last frame injected.
+        uint64_t next_poll_us{0};  ///< Next periodic step().
+        RcSnapshot snap{};         ///< Last published.
+        uint32_t seq{0};           ///< Bus publishes seen.
+        bool verbose{false};       ///< Print every publish that changes failsafe.
+
+        void begin()
+        {
+            pub.begin();
+            next_poll_us = cfg::tick::LOOP_MS * 1000ULL;
+        }
+
+        /// @brief Advance @p ms in 1 ms steps; stops early once @p until holds for a published frame.
+        template <typename Pred>
+        bool run(uint32_t ms, Pred until)
+        {
+            const uint64_t end = t_us + ms * 1000ULL;
+            while (t_us < end)
+            {
+                t_us += 1000;
+                simhost::set_now_us(t_us);
+
+                if (tx.on && t_us >= next_frame_us)
+                {
+                    const std::vector<uint8_t> fr = encode(tx.us, tx.sbus_fs);
+                    Serial2.inject(fr.data(), fr.size());
+                    last_frame_us = t_us;
+                    next_frame_us = t_us + cfg::rc::FRAME_US;
+                }
+
+                simhost::run_timers();
+                const bool woken = simhost::take_notify(&pub) > 0; ///< Watchdog wake, as the task would see it.
+                if (woken || t_us >= next_poll_us)
+                {
+                    if (!woken)
+                        next_poll_us += cfg::tick::LOOP_MS * 1000ULL;
+                    pub.step();
+                    if (buses::rc().seq() != seq)
+                    {
+                        const RcSnapshot s = buses::rc().peek();
+                        if (verbose && s.failsafe != snap.failsafe)
+                            printf("    %7.1f ms  failsafe %d  linked %d\n", t_us / 1000.0, s.failsafe, s.linked);
+                        snap = s;
+                        seq = buses::rc().seq();
+                        if (until(snap))
+                            return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        bool run(uint32_t ms)
+        {
+            return run(ms, [](const RcSnapshot &) { return false; });
+        }
+
+        float get(RC role) const { return rc_get(snap, role); }
+    };
+
+    int failures = 0;
+
+    void verdict(bool ok, const char *what)
+    {
+        printf("  [%s] %s\n", ok ? "PASS" : "FAIL", what);
+        if (!ok)
+            ++failures;
+    }
+
+    bool near(float v, float want, float tol = 1.0f) { return std::fabs(v - want) <= tol; }
+
+    void set(Tx &tx, RC role, int16_t us) { tx.us[static_cast<size_t>(role)] = us; }
+}
+
+int main(int argc, char **argv)
+{
+    bool verbose = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--verbose"))
+            verbose = true;
+        else
+        {
+            fprintf(stderr, "usage: %s [--verbose]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    static Bench b; ///< RcPublisher is large; keep it off the stack.
+    b.verbose = verbose;
+    b.begin();
+    char what[128];
+
+    printf("RcPublisher on the host, %s (frame %u us, poll %u ms, link timeout %u ms)\n", proto_name(),
+           static_cast<unsigned>(cfg::rc::FRAME_US), static_cast<unsigned>(cfg::tick::LOOP_MS),
+           static_cast<unsigned>(cfg::rc::LINK_TIMEOUT_MS));
+
+    // ---- UART ---- //
+    const uint32_t want_cfg = (kProto == Proto::Sbus) ? SERIAL_8E2 : SERIAL_8N1;
+    snprintf(what, sizeof(what), "Serial2 opened at %u baud, %s%s", static_cast<unsigned>(cfg::rc::BAUD),
+             want_cfg == SERIAL_8E2 ? "8E2" : "8N1", kProto == Proto::Sbus ? " inverted" : "");
+    verdict(Serial2.open() && Serial2.baud() == cfg::rc::BAUD && Serial2.config() == want_cfg &&
+                Serial2.inverted() == (kProto == Proto::Sbus),
+            what);
+
+    // ---- Boot, nothing received ---- //
+    b.run(100);
+    verdict(b.seq > 0 && b.snap.failsafe && !b.snap.linked && b.snap.source == RcSource::None,
+            "boot with no receiver: failsafe, not linked");
+
+    // ---- Live ---- //
+    for (size_t i = 0; i < kCh; ++i)
+        b.tx.us[i] = 1500;
+    set(b.tx, RC::steering, 2000);
+    set(b.tx, RC::speed, 1500);
+    set(b.tx, RC::volume, 1000);
+    set(b.tx, RC::power, 2000);
+    set(b.tx, RC::override, 1000);
+    set(b.tx, RC::lights, 2000);
+    set(b.tx, RC::mode, 1500);
+    set(b.tx, RC::obstacle, 1000);
+    b.tx.on = true;
+    b.next_frame_us = b.t_us;
+    const uint64_t on_us = b.t_us;
+    const bool live = b.run(100, [](const RcSnapshot &s) { return !s.failsafe; });
+    snprintf(what, sizeof(what), "first frames → live in %.0f ms (budget %u ms)", (b.t_us - on_us) / 1000.0,
+             static_cast<unsigned>(cfg::rc::FRAME_US / 1000 + cfg::tick::LOOP_MS + 1));
+    verdict(live && b.t_us - on_us <= cfg::rc::FRAME_US + cfg::tick::LOOP_MS * 1000ULL + 1000ULL, what);
+
+    b.run(1000); ///< Let the knob and throttle filters settle.
+    if (verbose)
+        printf("    steering %.1f speed %.1f power %.1f volume %.1f mode %.0f lights %.0f override %.0f\n",
+               b.get(RC::steering), b.get(RC::speed), b.get(RC::power), b.get(RC::volume), b.get(RC::mode),
+               b.get(RC::lights), b.get(RC::override));
+    verdict(!b.snap.failsafe && b.snap.linked && b.snap.source == RcSource::Primary, "live: linked, primary");
+    verdict(near(b.get(RC::steering), 100.0f) && near(b.get(RC::direction), 0.0f) && near(b.get(RC::speed), 50.0f),
+            "live: steering 100, direction 0, speed 50");
+    verdict(near(b.get(RC::power), 100.0f) && near(b.get(RC::volume), 0.0f), "live: power 100, volume 0");
+    verdict(b.get(RC::mode) == 1.0f && b.get(RC::lights) == 1.0f && b.get(RC::override) == 0.0f &&
+                b.get(RC::obstacle) == 0.0f,
+            "live: mode 1, lights 1, override 0, obstacle 0");
+
+    // ---- Cut ---- //
+    b.tx.on = false;
+    const uint64_t last = b.last_frame_us;
+    const bool lost = b.run(500, [](const RcSnapshot &s) { return s.failsafe; });
+    const double cut_ms = (b.t_us - last) / 1000.0;
+    snprintf(what, sizeof(what), "cut → failsafe %.0f ms after the last frame (budget %u ms)", cut_ms,
+             static_cast<unsigned>(cfg::rc::LINK_TIMEOUT_MS + cfg::tick::LOOP_MS + 1));
+    verdict(lost && cut_ms <= cfg::rc::LINK_TIMEOUT_MS + cfg::tick::LOOP_MS + 1, what);
+    verdict(b.snap.linked && b.snap.source == RcSource::None && b.snap.link_quality == 0 &&
+                b.get(RC::speed) == 0.0f && b.get(RC::steering) == 0.0f,
+            "cut: still linked, failsafe outputs (speed 0, steering 0), link quality 0");
+    const EventSnapshot lost_ev = buses::event(Event::RcLinkLost).peek();
+    snprintf(what, sizeof(what), "cut recorded for EventLogger: %u event, %.0f ms after the last frame",
+             static_cast<unsigned>(lost_ev.count), lost_ev.latency_us / 1000.0);
+    verdict(lost_ev.count == 1 && lost_ev.stamp_us == b.snap.stamp_us, what);
+
+    // ---- Resume ---- //
+    b.tx.on = true;
+    b.next_frame_us = b.t_us;
+    const uint64_t back_us = b.t_us;
+    const bool back = b.run(100, [](const RcSnapshot &s) { return !s.failsafe; });
+    snprintf(what, sizeof(what), "frames resume → live in %.0f ms", (b.t_us - back_us) / 1000.0);
+    verdict(back && b.t_us - back_us <= cfg::rc::FRAME_US + cfg::tick::LOOP_MS * 1000ULL + 1000ULL, what);
+
+    // ---- Receiver failsafe signature ---- //
+    b.run(500);
+    set(b.tx, RC::steering, 2000);
+    set(b.tx, RC::direction, 2000);
+    set(b.tx, RC::speed, 2000);
+    set(b.tx, RC::indicators, 1000);
+    const bool sig = b.run(100, [](const RcSnapshot &s) { return s.failsafe; });
+    verdict(sig && b.get(RC::speed) == 0.0f && b.snap.linked, "receiver failsafe signature → failsafe, speed 0");
+    set(b.tx, RC::direction, 1500);
+    set(b.tx, RC::speed, 1500);
+    set(b.tx, RC::indicators, 1500);
+    verdict(b.run(100, [](const RcSnapshot &s) { return !s.failsafe; }), "signature cleared → live");
+
+    // ---- Protocol extras ---- //
+    if (kProto == Proto::Sbus)
+    {
+        b.tx.sbus_fs = true;
+        const bool fs = b.run(100, [](const RcSnapshot &s) { return s.failsafe; });
+        verdict(fs && b.get(RC::speed) == 0.0f, "SBUS failsafe flag → failsafe, speed 0");
+        b.tx.sbus_fs = false;
+        verdict(b.run(100, [](const RcSnapshot &s) { return !s.failsafe; }), "SBUS flag cleared → live");
+    }
+    else if (kProto == Proto::Crsf)
+    {
+        verdict(b.snap.link_quality == 255, "CRSF before link statistics: quality 255 (unknown)");
+        const uint8_t stats[10] = {40, 45, 87, 9, 0, 4, 0, 0, 0, 0}; ///< RSSI, RSSI2, LQ 87 %, SNR, …
+        const std::vector<uint8_t> fr = crsf_frame(rcproto::CrsfParser::kTypeLinkStats, stats, sizeof(stats));
+        Serial2.inject(fr.data(), fr.size());
+        b.run(100, [](const RcSnapshot &s) { return s.link_quality != 255; });
+        snprintf(what, sizeof(what), "CRSF link statistics → quality %u %%", b.snap.link_quality);
+        verdict(b.snap.link_quality == 87, what);
+    }
+    else
+    {
+        verdict(b.snap.link_quality == 255, "iBUS: quality 255 (not reported)");
+    }
+
+    verdict(Serial2.overflows() == 0, "no UART overflow");
+
+    printf("\n%d check(s) failed\n", failures);
+    return failures;
+}
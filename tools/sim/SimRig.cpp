@@ -0,0 +1,258 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of the host rig.
+ *
+ * @file SimRig.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "SimRig.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+// Wire the stack the way main.cpp does, then begin the drive.
+SimRig::SimRig(const SimRigSpec &spec) noexcept
+    : car_(spec.car), encoder_(car_), imu_src_(car_, spec.imu_hz), imu_(imu_src_, imu_bus_),
+      motors_(std::clamp<size_t>(spec.motors, 1, kTaps)),
+      tapped_(motors_ > 1 || spec.pwm), core_(input_, control_),
+      drive_(wheels(motors_, tapped_).data(), motors_, control_, state_),
+      battery_on_(spec.battery), start_us_(spec.start_us), now_us_(spec.start_us), next_battery_us_(spec.start_us)
+{
+    simhost::set_now_us(now_us_);
+    drive_.set_features(spec.features);
+    drive_.attach_events(events_);
+    core_.set_features(spec.core);
+    core_.attach_events(events_);
+    if (spec.rc)
+        core_.attach_rc(rc_);
+    if (spec.encoder)
+        drive_.attach_speed_sensor(encoder_);
+    if (spec.pwm)
+    {
+        pwm_tap_.rig = this;
+        drive_.attach_pwm_frequency(pwm_tap_);
+    }
+    if (battery_on_)
+    {
+        drive_.attach_battery(battery_);
+        battery_.publish(car_.sample_battery(now_us_));
+        next_battery_us_ += static_cast<uint64_t>(cfg::battery::PERIOD_MS) * 1000ULL;
+    }
+    if (spec.wall_m > 0.0f)
+    {
+        wall_m_ = spec.wall_m;
+        drive_.attach_obstacle(obstacle_);
+        next_ping_us_ = now_us_;
+    }
+    drive_.begin();
+    if (spec.imu_hz > 0 && imu_.begin())
+        next_imu_us_ = now_us_ + static_cast<uint64_t>(cfg::imu::PERIOD_MS) * 1000ULL;
+}
+
+// Motors in main.cpp order: left side first, then right.
+SimRig::Wheels SimRig::wheels(size_t motors, bool tapped) noexcept
+{
+    Wheels w{};
+    if (!tapped)
+    {
+        w[0] = {&car_, PowerDriveHandler::Side::Both};
+        return w;
+    }
+    for (size_t i = 0; i < motors; ++i)
+    {
+        taps_[i].rig = this;
+        PowerDriveHandler::Side side = PowerDriveHandler::Side::Both;
+        if (motors > 1)
+            side = (i < motors / 2) ? PowerDriveHandler::Side::Left : PowerDriveHandler::Side::Right;
+        w[i] = {&taps_[i], side};
+    }
+    return w;
+}
+
+// Plant forward, noting the first wheelspin.
+void SimRig::advance_car(uint32_t dt_us, uint64_t end_us) noexcept
+{
+    car_.advance(static_cast<float>(dt_us) * 1e-6f);
+    if (slip_.onset_us == 0 && car_.slipping())
+        slip_.onset_us = end_us;
+}
+
+// Mean duty of the taps onto the single-mass plant.
+void SimRig::drive_plant(Dir dir) noexcept
+{
+    float sum = 0.0f;
+    for (size_t i = 0; i < motors_; ++i)
+        sum += taps_[i].pct;
+    car_.setSpeedPercent(sum / static_cast<float>(motors_), dir);
+    freq_pending_ = false;
+}
+
+// Log the change; the duty writes that follow clear the pending flag.
+bool SimRig::PwmTap::set_pwm_frequency(uint32_t hz) noexcept
+{
+    PwmLog &log = rig->pwm_;
+    if (log.changes > 0)
+        log.min_gap_us = std::min(log.min_gap_us, rig->now_us_ - log.last_us);
+    log.hz = hz;
+    log.last_us = rig->now_us_;
+    ++log.changes;
+    rig->freq_pending_ = true;
+    return true;
+}
+
+void SimRig::WheelTap::setSpeedPercent(float p, Dir d)
+{
+    pct = p;
+    dir = d;
+    rig->drive_plant(d);
+}
+
+// RC frame, stamped now.
+void SimRig::set_rc(RcSnapshot f) noexcept
+{
+    f.stamp_us = now_us_;
+    rc_.publish(f);
+}
+
+// One period in task order.
+void SimRig::tick() noexcept
+{
+    simhost::set_now_us(now_us_);
+
+    if (!input_stalled_)
+    {
+        InputState in{};
+        in.buttons = buttons_;
+        in.stamp_ms = static_cast<uint32_t>(now_us_ / 1000ULL);
+        input_.publish(in);
+    }
+
+    prev_ = state_.peek();
+    using clock = std::chrono::steady_clock;
+    clock::duration spent{};
+    auto t0 = clock::now();
+    core_.step();
+    if (accel_override_ > 0.0f || decel_override_ > 0.0f)
+    {
+        ControlSnapshot c = control_.peek();
+        c.accel_pct_s = (accel_override_ > 0.0f) ? accel_override_ : c.accel_pct_s;
+        c.decel_pct_s = (decel_override_ > 0.0f) ? decel_override_ : c.decel_pct_s;
+        control_.publish(c);
+    }
+    drive_.step();
+    spent += clock::now() - t0;
+    if (wall_.brake_us != 0 && wall_.cut_us == 0 && state_.peek().duty_pct <= 0.0f &&
+        (state_.peek().limits & MotorStateSnapshot::kLimitObstacle) != 0)
+        wall_.cut_us = now_us_;
+    if (slip_.cut_us == 0 && (state_.peek().limits & MotorStateSnapshot::kLimitTraction) != 0)
+        slip_.cut_us = now_us_;
+    if (freq_pending_)
+    {
+        ++pwm_.late; ///< Carrier changed after the duty: the new period ran a tick with stale compares.
+        freq_pending_ = false;
+    }
+
+    // Plant to the next tick, with the traction inner steps at their instants.
+    const uint32_t inner = drive_.inner_steps();
+    const uint32_t sub_us = cfg::traction::SUBSTEP_MS * 1000u;
+    for (uint32_t k = 1; k <= inner; ++k)
+    {
+        const uint64_t at = now_us_ + static_cast<uint64_t>(k) * sub_us;
+        advance_car(sub_us, at);
+        simhost::set_now_us(at);
+        const float before = fabsf(car_.duty_pct());
+        t0 = clock::now();
+        drive_.inner_step();
+        spent += clock::now() - t0;
+        if (slip_.cut_us == 0 && fabsf(car_.duty_pct()) < before)
+            slip_.cut_us = at; ///< Only traction writes between ticks.
+    }
+    stack_ns_ = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(spent).count());
+    stack_steps_ = 1 + inner;
+    advance_car(kTickUs - inner * sub_us, now_us_ + kTickUs);
+    now_us_ += kTickUs;
+
+    peak_m_ = std::max(peak_m_, car_.distance_m());
+    roll_.max_back_m = std::max(roll_.max_back_m, peak_m_ - car_.distance_m());
+    if (roll_.back_us == 0 && car_.speed_mps() < 0.0f)
+        roll_.back_us = now_us_;
+    if (roll_.back_us != 0 && roll_.hold_us == 0 && state_.peek().phase == MotorStateSnapshot::RampPhase::Holding)
+        roll_.hold_us = now_us_;
+
+    if (wall_m_ > 0.0f)
+    {
+        const float gap = wall_m_ - car_.distance_m();
+        if (wall_.brake_us == 0 && gap <= cfg::obstacle::STOP_M + car_.speed_mps() * cfg::obstacle::BRAKE_S)
+            wall_.brake_us = now_us_; ///< Tick resolution.
+        wall_.min_gap_m = std::min(wall_.min_gap_m, gap);
+
+        echo();
+        while (next_ping_us_ <= now_us_)
+        {
+            ping(next_ping_us_);
+            next_ping_us_ += static_cast<uint64_t>(cfg::obstacle::PERIOD_MS) * 1000ULL;
+            echo();
+        }
+    }
+
+    while (next_imu_us_ != 0 && next_imu_us_ <= now_us_)
+    {
+        simhost::set_now_us(next_imu_us_);
+        const auto t0 = clock::now();
+        imu_.step();
+        imu_ns_ +=
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - t0).count());
+        next_imu_us_ += static_cast<uint64_t>(cfg::imu::PERIOD_MS) * 1000ULL;
+    }
+
+    if (battery_on_)
+    {
+        while (next_battery_us_ <= now_us_)
+        {
+            simhost::set_now_us(next_battery_us_);
+            battery_.publish(car_.sample_battery(next_battery_us_));
+            next_battery_us_ += static_cast<uint64_t>(cfg::battery::PERIOD_MS) * 1000ULL;
+        }
+    }
+    simhost::set_now_us(now_us_);
+}
+
+// Range the wall now; the echo ends one round trip later (or at the clear timeout).
+void SimRig::ping(uint64_t at_us) noexcept
+{
+    constexpr float kFlightS = 2.0f * cfg::obstacle::MAX_RANGE_M / cfg::obstacle::SOUND_MPS + 0.002f;
+    const float d = std::max(wall_m_ - car_.distance_m(), 0.0f);
+    echo_m_ = d;
+    const float flight_s = d < cfg::obstacle::MAX_RANGE_M ? 2.0f * d / cfg::obstacle::SOUND_MPS : kFlightS;
+    echo_us_ = at_us + static_cast<uint64_t>(flight_s * 1e6f);
+    ++pings_;
+}
+
+// Publish the way UltrasonicRanger does, stamped when the echo ended.
+void SimRig::echo() noexcept
+{
+    if (echo_us_ == 0 || echo_us_ > now_us_)
+        return;
+    ObstacleSnapshot s{};
+    s.seq = pings_;
+    s.valid = true;
+    s.clear = echo_m_ >= cfg::obstacle::MAX_RANGE_M;
+    s.distance_m = s.clear ? cfg::obstacle::MAX_RANGE_M : echo_m_;
+    s.stamp_us = echo_us_;
+    simhost::set_now_us(echo_us_);
+    obstacle_.publish(s);
+    simhost::set_now_us(now_us_);
+    echo_us_ = 0;
+}
+
+// Whole periods.
+void SimRig::run_for(float seconds) noexcept
+{
+    const uint64_t end = now_us_ + static_cast<uint64_t>(seconds * 1e6f);
+    while (now_us_ < end)
+        tick();
+}
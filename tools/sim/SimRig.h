@@ -0,0 +1,251 @@
+/**
+ * MIT License
+ *
+ * @brief Host rig: the unmodified ControlCore and PowerDriveHandler on a VehicleSim.
+ *
+ * @file SimRig.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <InputBus.h>
+#include <ControlBus.h>
+#include <MotorStateBus.h>
+#include <BatteryBus.h>
+#include <RcBus.h>
+#include <ImuBus.h>
+#include <ObstacleBus.h>
+#include <EventBus.h>
+#include <ControlCore/ControlCore.h>
+#include <PowerDriveHandler/PowerDriveHandler.h>
+#include <ImuService/ImuService.h>
+#include <VehicleSim.h>
+#include <array>
+
+using DriveFeatures = PowerDriveHandler::Features;
+using CoreFeatures = ControlCore::Features;
+
+/**
+ * @brief Rig options.
+ */
+struct SimRigSpec
+{
+    VehicleParams car{};                 ///< Vehicle.
+    bool encoder{cfg::encoder::ENABLED}; ///< Attach a SimEncoder (quadrature) to the drive.
+    bool battery{true};                  ///< Publish simulated battery sense.
+    bool rc{false};                      ///< Attach the RC bus to ControlCore (frames come from set_rc()).
+    uint8_t motors{1};                   ///< Driven motors: 1 → the plant itself, 2 → left/right, 4 → two per side.
+    DriveFeatures features{};            ///< Drive stages (cfg defaults).
+    bool pwm{false};                     ///< Attach a carrier-frequency tap (checks it lands before the duty).
+    uint16_t imu_hz{0};                  ///< Run ImuService on a SimImu at this rate (0 → no IMU).
+    CoreFeatures core{};                 ///< Control policies (cfg defaults).
+    float wall_m{0.0f};                  ///< Wall this far ahead of the start, with a ranger facing it (0 → none).
+    uint64_t start_us{1000000};          ///< Simulated boot-to-start time.
+};
+
+/**
+ * @brief One simulated car: own buses, own control stack, own clock.
+ *
+ * Each tick() is one cfg::tick::LOOP_MS period in task order: buttons are
+ * sampled onto the InputBus, ControlCore steps, PowerDriveHandler steps, then
+ * the car is integrated to the next tick with the traction inner steps (if
+ * active) spread through it. The battery is sampled at its own cadence.
+ * With several motors each one is a tap that records its duty; the plant is
+ * one mass, so it runs on the mean of the wheels (no yaw). A carrier tap
+ * logs frequency changes and flags any that the duty does not follow.
+ * With an IMU, ImuService drains a SimImu every cfg::imu::PERIOD_MS. With a
+ * wall, a ranger pings it every cfg::obstacle::PERIOD_MS and publishes when
+ * the echo would end, as UltrasonicRanger does.
+ * Single-threaded; run one rig per thread for parallel simulations.
+ */
+class SimRig
+{
+public:
+    explicit SimRig(const SimRigSpec &spec = SimRigSpec{}) noexcept;
+
+    SimRig(const SimRig &) = delete;
+    SimRig &operator=(const SimRig &) = delete;
+
+    /// @brief Hold or release a button (takes effect at the next tick()).
+    void set_button(ButtonIndex b, bool down) noexcept { buttons_.set(idx(b), down); }
+
+    /// @brief Publish an RC frame now (stamped with the simulated time).
+    void set_rc(RcSnapshot f) noexcept;
+
+    /**
+     * @brief Replace the pull-away rate ControlCore publishes (what a drive mode sets).
+     * @note For tuning sweeps: the candidate rides the same ControlSnapshot field the
+     *       mode table fills, so PowerDriveHandler runs exactly as built.
+     *
+     * @param pct_s Rise rate (%/s); 0 → leave ControlCore's value.
+     */
+    void set_accel_override(float pct_s) noexcept { accel_override_ = pct_s; }
+
+    /**
+     * @brief Set the release rate on every ControlSnapshot (the drive's fall-rate field).
+     *
+     * @param pct_s Fall rate (%/s); 0 → leave ControlCore's value.
+     */
+    void set_decel_override(float pct_s) noexcept { decel_override_ = pct_s; }
+
+    /**
+     * @brief Freeze the input task: the InputBus keeps its last snapshot (and stamp).
+     *
+     * @param stalled True → stop publishing buttons.
+     */
+    void set_input_stalled(bool stalled) noexcept { input_stalled_ = stalled; }
+
+    /// @brief Carrier changes the drive made (needs SimRigSpec::pwm).
+    struct PwmLog
+    {
+        uint32_t hz{cfg::motor::PWM_LOW_DUTY_HZ}; ///< Carrier now.
+        uint32_t changes{0};                      ///< Frequency writes.
+        uint32_t late{0};                         ///< Writes not followed by a duty write in the same tick.
+        uint64_t last_us{0};                      ///< Time of the last write.
+        uint64_t min_gap_us{UINT64_MAX};          ///< Shortest time between two writes.
+    };
+
+    [[nodiscard]] const PwmLog &pwm() const noexcept { return pwm_; }
+
+    /// @brief First wheelspin and the traction stage's first cut (0 → not yet), at inner-step resolution.
+    struct SlipLog
+    {
+        uint64_t onset_us{0}; ///< Plant first slipped.
+        uint64_t cut_us{0};   ///< Drive first cut duty for traction.
+    };
+
+    [[nodiscard]] const SlipLog &slip() const noexcept { return slip_; }
+
+    /// @brief Rollback: furthest the car has come back from its furthest point, and when it first rolled.
+    struct RollLog
+    {
+        float max_back_m{0.0f}; ///< Largest drop from the furthest distance reached.
+        uint64_t back_us{0};    ///< Car first moving backwards (0 → not yet).
+        uint64_t hold_us{0};    ///< Drive first holding after that (0 → not yet).
+    };
+
+    [[nodiscard]] const RollLog &roll() const noexcept { return roll_; }
+
+    /// @brief Approach to the wall (needs SimRigSpec::wall_m).
+    struct WallLog
+    {
+        float min_gap_m{INFINITY}; ///< Closest the car came (negative → it hit the wall).
+        uint64_t brake_us{0};      ///< Car first inside STOP_M + speed × BRAKE_S of it (0 → never).
+        uint64_t cut_us{0};        ///< Drive first at 0 % for the obstacle after that (0 → not yet).
+    };
+
+    [[nodiscard]] const WallLog &wall() const noexcept { return wall_; }
+
+    /// @brief Latest @p e the core or drive recorded for EventLogger.
+    [[nodiscard]] EventSnapshot events(Event e) const noexcept { return events_[e].peek(); }
+
+    /// @brief Advance one control period.
+    void tick() noexcept;
+
+    /// @brief Advance whole periods covering at least seconds.
+    void run_for(float seconds) noexcept;
+
+    [[nodiscard]] uint64_t now_us() const noexcept { return now_us_; }
+    [[nodiscard]] float time_s() const noexcept { return static_cast<float>(now_us_ - start_us_) * 1e-6f; }
+    [[nodiscard]] VehicleSim &car() noexcept { return car_; }
+    [[nodiscard]] const VehicleSim &car() const noexcept { return car_; }
+    [[nodiscard]] ControlSnapshot control() const noexcept { return control_.peek(); }
+    [[nodiscard]] MotorStateSnapshot state() const noexcept { return state_.peek(); }
+    [[nodiscard]] const MotorStateSnapshot &previous() const noexcept { return prev_; } ///< State one tick earlier.
+    [[nodiscard]] ImuSnapshot imu() const noexcept { return imu_bus_.peek(); }
+    [[nodiscard]] uint64_t imu_ns() const noexcept { return imu_ns_; } ///< Host wall time spent in ImuService.
+
+    /// @brief Wall time the control stack (ControlCore + drive, inner steps included) took last tick (ns).
+    [[nodiscard]] uint32_t stack_ns() const noexcept { return stack_ns_; }
+
+    /// @brief Steps stack_ns() covers: the tick plus its traction inner steps.
+    [[nodiscard]] uint32_t stack_steps() const noexcept { return stack_steps_; }
+
+    static constexpr uint32_t kTickUs = cfg::tick::LOOP_MS * 1000u; ///< Control period (µs).
+
+private:
+    static constexpr size_t kTaps = cfg::motor::MAX_MOTORS; ///< Most motors a rig can drive.
+    using Wheels = std::array<PowerDriveHandler::Wheel, kTaps>;
+
+    /// @brief One motor of a multi-motor build: keeps its duty and drives the plant with the mean.
+    class WheelTap : public IMotorDriver
+    {
+    public:
+        void setSpeedPercent(float pct, Dir dir) override;
+
+        SimRig *rig{nullptr}; ///< Owner.
+        float pct{0.0f};      ///< Duty last written.
+        Dir dir{Dir::CW};     ///< Direction last written.
+    };
+
+    /// @brief Carrier-frequency control as the drive sees it.
+    class PwmTap : public IPwmFrequency
+    {
+    public:
+        bool set_pwm_frequency(uint32_t hz) noexcept override;
+
+        SimRig *rig{nullptr}; ///< Owner.
+    };
+
+    /// @brief Motors as the drive sees them (the plant itself, or taps).
+    Wheels wheels(size_t motors, bool tapped) noexcept;
+
+    /// @brief Advance the plant and note the first wheelspin.
+    void advance_car(uint32_t dt_us, uint64_t end_us) noexcept;
+
+    /// @brief Send a ping at @p at_us; the echo is published once it would have ended.
+    void ping(uint64_t at_us) noexcept;
+
+    /// @brief Publish the pending echo if it has ended by now.
+    void echo() noexcept;
+
+    /// @brief Write the mean of the taps to the plant.
+    void drive_plant(Dir dir) noexcept;
+
+    InputBus input_{};                   ///< Buttons.
+    ControlBus control_{};               ///< ControlCore → drive.
+    MotorStateBus state_{};              ///< Drive → observers.
+    BatteryBus battery_{};               ///< Battery sense.
+    RcBus rc_{};                         ///< RC frames.
+    VehicleSim car_;                     ///< Plant (and motor driver).
+    SimEncoder encoder_;                 ///< Wheel encoder on the plant.
+    SimImu imu_src_;                     ///< IMU on the plant.
+    ImuBus imu_bus_{};                   ///< Attitude.
+    ImuService imu_;                     ///< Unmodified IMU service.
+    ObstacleBus obstacle_{};             ///< Ranger output.
+    EventBuses events_{};                ///< Edge events recorded by the core and drive.
+    std::array<WheelTap, kTaps> taps_{}; ///< Multi-motor taps.
+    size_t motors_{1};                   ///< Motors driven (1..kTaps).
+    bool tapped_{false};                 ///< Motors go through taps (several, or a carrier check).
+    PwmTap pwm_tap_{};                   ///< Carrier-frequency tap.
+    PwmLog pwm_{};                       ///< Carrier changes.
+    bool freq_pending_{false};           ///< Frequency written, no duty written after it yet.
+    SlipLog slip_{};                     ///< First slip and traction cut.
+    RollLog roll_{};                     ///< Rollback and hill-hold.
+    float peak_m_{0.0f};                 ///< Furthest distance reached.
+    WallLog wall_{};                     ///< Approach to the wall.
+    float wall_m_{0.0f};                 ///< Wall position (0 → none).
+    uint64_t next_ping_us_{0};           ///< Next ping (0 → no ranger).
+    uint64_t echo_us_{0};                ///< Pending echo ends (0 → none).
+    float echo_m_{0.0f};                 ///< Pending echo distance.
+    uint32_t pings_{0};                  ///< Pings sent.
+    ControlCore core_;                   ///< Unmodified control policy.
+    PowerDriveHandler drive_;            ///< Unmodified drive.
+    bool battery_on_{true};              ///< Publish battery sense.
+    std::bitset<NUM_BUTTONS> buttons_{}; ///< Buttons held.
+    uint64_t start_us_{0};               ///< Simulated start.
+    uint64_t now_us_{0};                 ///< Simulated time.
+    uint64_t next_battery_us_{0};        ///< Next battery sample.
+    uint64_t next_imu_us_{0};            ///< Next IMU drain (0 → no IMU).
+    uint64_t imu_ns_{0};                 ///< ImuService wall time so far.
+    float accel_override_{0.0f};         ///< Rise-rate override (%/s, 0 = off).
+    float decel_override_{0.0f};         ///< Fall-rate override (%/s, 0 = off).
+    bool input_stalled_{false};          ///< Skip the InputBus publish.
+    uint32_t stack_ns_{0};               ///< Control stack cost last tick.
+    uint32_t stack_steps_{1};            ///< Steps timed last tick.
+    MotorStateSnapshot prev_{};          ///< Drive state before the last tick.
+};
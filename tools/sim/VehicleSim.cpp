@@ -0,0 +1,241 @@
+/**
+ * MIT License
+ *
+ * @brief Implementation of the vehicle simulator and its encoder.
+ *
+ * @file VehicleSim.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include "VehicleSim.h"
+#include <cmath>
+
+// ---- VehicleSim ---- //
+
+// Precompute the per-step constants.
+VehicleSim::VehicleSim(const VehicleParams &p) noexcept : p_(p), soc_(p.soc)
+{
+    decay_ = expf(-p_.step_s * p_.motor_r_ohm / p_.motor_l_h);
+    j_axle_ = p_.wheels_j + static_cast<float>(p_.motors) * p_.rotor_j * p_.gear_ratio * p_.gear_ratio;
+    set_slope_deg(p_.slope_deg);
+    v_bat_ = p_.ocv_empty_v + soc_ * (p_.ocv_full_v - p_.ocv_empty_v);
+}
+
+// Duty latch.
+void VehicleSim::setSpeedPercent(float pct, Dir dir)
+{
+    duty_ = fminf(fmaxf(pct, 0.0f), 100.0f) * 0.01f;
+    dir_sign_ = (dir == Dir::CW) ? 1.0f : -1.0f;
+}
+
+// Slope-dependent forces.
+void VehicleSim::set_slope_deg(float deg) noexcept
+{
+    p_.slope_deg = deg;
+    const float th = deg * kPi / 180.0f;
+    const float normal = p_.mass_kg * kG * cosf(th);
+    f_grade_ = p_.mass_kg * kG * sinf(th);
+    f_roll_ = p_.crr * normal;
+    f_grip_ = p_.mu * p_.drive_share * normal;
+    f_slide_ = p_.mu_slide * p_.drive_share * normal;
+}
+
+// Whole steps, then the remainder.
+void VehicleSim::advance(float dt_s) noexcept
+{
+    while (dt_s > 1e-9f)
+    {
+        const float h = (dt_s < p_.step_s) ? dt_s : p_.step_s;
+        substep(h);
+        dt_s -= h;
+    }
+}
+
+// One step: winding current, pack, then wheel and body.
+void VehicleSim::substep(float h) noexcept
+{
+    const float n = static_cast<float>(p_.motors);
+    const float r = p_.wheel_r_m;
+
+    // Electrical. The pack's share of the loop resistance is folded in (each motor sees n·d²·R_int).
+    const float ocv = p_.ocv_empty_v + soc_ * (p_.ocv_full_v - p_.ocv_empty_v);
+    const float r_loop = p_.motor_r_ohm + n * duty_ * duty_ * p_.r_int_ohm;
+    const float i_ss = (dir_sign_ * duty_ * ocv - p_.motor_k * p_.gear_ratio * w_) / r_loop;
+    const float k = (h < p_.step_s) ? expf(-h * p_.motor_r_ohm / p_.motor_l_h) : decay_;
+    i_ = i_ss + (i_ - i_ss) * k;
+    i_bat_ = n * dir_sign_ * duty_ * i_;
+    v_bat_ = ocv - p_.r_int_ohm * i_bat_;
+    soc_ = fmaxf(soc_ - i_bat_ * h / (3600.0f * p_.capacity_ah), 0.0f);
+
+    // Torque at the driven axle.
+    const float t_axle = n * p_.motor_k * i_ * p_.gear_ratio * p_.gear_eff;
+    const float v0 = v_;
+
+    if (!slipping_)
+    {
+        // Wheels and body move together: one equation with the rotating inertia lumped in.
+        const float f_drive = t_axle / r - f_grade_;
+        if (fabsf(v_) < kRestMps && fabsf(f_drive) <= f_roll_)
+        {
+            v_ = 0.0f; ///< Rolling resistance holds it.
+            a_ = 0.0f;
+        }
+        else
+        {
+            const float roll = (fabsf(v_) >= kRestMps) ? copysignf(f_roll_, v_) : copysignf(f_roll_, f_drive);
+            const float a = (f_drive - roll) / (p_.mass_kg + j_axle_ / (r * r));
+            const float f_trac = p_.mass_kg * a + roll + f_grade_; ///< What the tyres must transmit.
+            if (fabsf(f_trac) > f_grip_)
+                slipping_ = true;
+            else
+            {
+                v_ += a * h;
+                if (v0 != 0.0f && v_ * v0 < 0.0f && fabsf(f_drive) <= f_roll_)
+                    v_ = 0.0f; ///< Came to rest inside the step.
+                a_ = (v_ - v0) / h;
+            }
+        }
+        w_ = v_ / r;
+    }
+
+    if (slipping_)
+    {
+        // Separate: sliding friction couples them, each integrates on its own.
+        const float slip = w_ * r - v_;
+        const float f_trac = (slip != 0.0f) ? copysignf(f_slide_, slip) : copysignf(f_slide_, t_axle);
+        const float roll = (fabsf(v_) >= kRestMps) ? copysignf(f_roll_, v_) : 0.0f;
+        a_ = (f_trac - roll - f_grade_) / p_.mass_kg;
+        v_ += a_ * h;
+        w_ += (t_axle - f_trac * r) / j_axle_ * h;
+
+        const float slip_after = w_ * r - v_;
+        if (slip_after * slip <= 0.0f)
+        {
+            // Speeds met: lock together, conserving momentum.
+            const float m_rot = j_axle_ / (r * r);
+            v_ = (p_.mass_kg * v_ + m_rot * w_ * r) / (p_.mass_kg + m_rot);
+            w_ = v_ / r;
+            slipping_ = false;
+        }
+    }
+
+    x_ += v_ * h;
+    theta_ += w_ * h;
+}
+
+// BatteryMonitor's filter on the terminal voltage.
+BatterySnapshot VehicleSim::sample_battery(uint64_t stamp_us) noexcept
+{
+    if (sense_samples_ == 0)
+        sense_v_ = v_bat_;
+    else
+        sense_v_ += cfg::battery::FILTER_ALPHA * (v_bat_ - sense_v_);
+    if (sense_samples_ < cfg::battery::SETTLE_SAMPLES)
+        ++sense_samples_;
+
+    BatterySnapshot s{};
+    s.volts = sense_v_;
+    s.raw_volts = v_bat_;
+    s.low = sense_v_ < cfg::battery::LIMIT_START_V;
+    s.valid = sense_samples_ >= cfg::battery::SETTLE_SAMPLES;
+    s.stamp_us = stamp_us;
+    return s;
+}
+
+// ---- SimEncoder ---- //
+
+// Estimator set up as WheelEncoder::begin() does.
+SimEncoder::SimEncoder(const VehicleSim &car, bool quadrature) noexcept : car_(&car), quadrature_(quadrature)
+{
+    est_.configure({car.params().counts_per_rev, cfg::encoder::MIN_WINDOW_COUNTS, cfg::encoder::MAX_WINDOW_S,
+                    cfg::encoder::SMOOTHING});
+}
+
+// Edges crossed since the last read.
+uint32_t SimEncoder::read_counts() noexcept
+{
+    const int32_t now = static_cast<int32_t>(floorf(car_->wheel_turns() * car_->params().counts_per_rev));
+    const int32_t delta = now - position_;
+    position_ = now;
+    total_ += static_cast<uint32_t>((delta < 0) ? -delta : delta);
+    return total_;
+}
+
+// One tick into the estimator.
+float SimEncoder::sample_rpm(float dt_s) noexcept
+{
+    const uint32_t total = read_counts();
+    const uint32_t delta = total - sampled_;
+    sampled_ = total;
+    return est_.update(delta, dt_s);
+}
+
+// ---- SimImu ---- //
+
+// Start the clock from the car at rest.
+bool SimImu::begin() noexcept
+{
+    next_us_ = now_us();
+    mark(next_us_);
+    return true;
+}
+
+// Hand out the samples that arrived since the last call.
+size_t SimImu::read_batch(ctl::ImuSample *out, size_t max) noexcept
+{
+    const uint64_t now = now_us();
+    const float period_us = 1e6f / hz_;
+    if (now < next_us_)
+        return 0;
+
+    size_t due = static_cast<size_t>(static_cast<float>(now - next_us_) / period_us) + 1;
+    if (due > kFifoFrames)
+    {
+        ++overflows_; ///< Read too late: the FIFO is reset and its frames are gone.
+        next_us_ = now;
+        mark(now);
+        return 0;
+    }
+    due = (due < max) ? due : max;
+
+    // The car's motion between the previous read and now, spread over the batch.
+    const float span_s = static_cast<float>(now - last_us_) * 1e-6f;
+    const float slope = car_->params().slope_deg;
+    const float accel_g = (span_s > 0.0f) ? (car_->speed_mps() - last_v_) / (span_s * kG) : 0.0f;
+    const float pitch_dps = (span_s > 0.0f) ? (slope - last_slope_) / span_s : 0.0f;
+
+    for (size_t i = 0; i < due; ++i)
+    {
+        const uint64_t t = next_us_ + static_cast<uint64_t>(static_cast<float>(i) * period_us);
+        const float f = (span_s > 0.0f) ? static_cast<float>(t - last_us_) * 1e-6f / span_s : 1.0f;
+        const float p = (last_slope_ + f * (slope - last_slope_)) * kRad;
+
+        ctl::ImuSample &s = out[i];
+        s.ax = sinf(p) + accel_g + noise(0.01f); ///< Gravity reaction plus the car's own acceleration.
+        s.ay = noise(0.01f);
+        s.az = cosf(p) + noise(0.01f);
+        s.gx = noise(0.2f);
+        s.gy = -pitch_dps + noise(0.2f); ///< Nose-up is negative about y.
+        s.gz = noise(0.2f);
+    }
+    next_us_ += static_cast<uint64_t>(static_cast<float>(due) * period_us);
+    mark(now);
+    return due;
+}
+
+// State at this read.
+void SimImu::mark(uint64_t t_us) noexcept
+{
+    last_us_ = t_us;
+    last_v_ = car_->speed_mps();
+    last_slope_ = car_->params().slope_deg;
+}
+
+// Uniform noise in ±amplitude.
+float SimImu::noise(float amplitude) noexcept
+{
+    seed_ = seed_ * 1664525u + 1013904223u;
+    return amplitude * (static_cast<float>(seed_ >> 8) / 8388608.0f - 1.0f);
+}
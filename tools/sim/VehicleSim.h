@@ -0,0 +1,237 @@
+/**
+ * MIT License
+ *
+ * @brief Ride-on car physics behind IMotorDriver, with simulated encoder, IMU and battery sense.
+ *
+ * @file VehicleSim.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <app_config.h>
+#include <cstdint>
+#include <ESP32_MCPWM.h>
+#include <BatteryBus.h>
+#include <SpeedEstimator.h>
+#include <WheelEncoder/WheelEncoder.h>
+#include <ImuSources/ImuSources.h>
+
+/**
+ * @brief Car, drivetrain and pack (SI units; per-motor figures where noted).
+ *
+ * Defaults are a 12 V two-motor ride-on: 550-size motors matching cfg::thermal
+ * (0.3 Ω, 40 A stall), ~45:1 gearboxes, 10 cm wheels, 45 kg with the driver,
+ * a 12 Ah SLA pack. Top speed lands near cfg::speed::MAX_RPM at the wheel.
+ */
+struct VehicleParams
+{
+    // ---- Motors (each) ---- //
+    float motor_r_ohm{cfg::thermal::MOTOR_R_OHM}; ///< Winding + brush resistance.
+    float motor_l_h{100e-6f};                     ///< Winding inductance.
+    float motor_k{0.0076f};                       ///< Torque / back-EMF constant (N·m/A = V·s/rad).
+    float rotor_j{2.0e-5f};                       ///< Rotor inertia (kg·m²).
+    uint8_t motors{2};                            ///< Motors driven in parallel from the one duty.
+
+    // ---- Gearbox and wheels ---- //
+    float gear_ratio{45.0f};                            ///< Motor turns per wheel turn.
+    float gear_eff{0.85f};                              ///< Gearbox efficiency (both directions).
+    float wheel_r_m{0.10f};                             ///< Driven wheel radius.
+    float wheels_j{0.02f};                              ///< Driven wheels + axle inertia (kg·m²).
+    float counts_per_rev{cfg::encoder::COUNTS_PER_REV}; ///< Encoder counts per wheel turn.
+
+    // ---- Body and ground ---- //
+    float mass_kg{45.0f};    ///< Car + driver.
+    float drive_share{0.6f}; ///< Weight fraction on the driven wheels.
+    float crr{0.03f};        ///< Rolling resistance coefficient.
+    float mu{0.6f};          ///< Tyre/ground friction (grip limit).
+    float mu_slide{0.45f};   ///< Friction while spinning.
+    float slope_deg{0.0f};   ///< Nose-up positive.
+
+    // ---- Pack ---- //
+    float ocv_full_v{12.8f};  ///< Open-circuit voltage, full.
+    float ocv_empty_v{11.6f}; ///< Open-circuit voltage, flat.
+    float capacity_ah{12.0f}; ///< Capacity.
+    float r_int_ohm{0.06f};   ///< Internal + wiring resistance.
+    float soc{1.0f};          ///< Starting state of charge (0..1).
+
+    float step_s{0.0005f}; ///< Integration step (current lag is solved exactly, so it may exceed L/R).
+};
+
+/**
+ * @brief Averaged-PWM car model: plugs in where the Motor goes.
+ *
+ * The H-bridge is taken as synchronous (as the BTS7960 runs with EN held), so
+ * the motors see duty × pack voltage in either current direction and 0 % is the
+ * short-circuit brake. Winding current follows its L/R lag (exact per step),
+ * the pack sags by its internal resistance, and torque goes through the gearbox
+ * to the driven wheels. The wheels grip until the traction force would exceed
+ * μ·N on them; then wheel and body separate (wheelspin or lock) until their
+ * speeds meet again. Rolling resistance and the slope act on the body, and
+ * rolling resistance holds the car at rest until it is overcome.
+ *
+ * No RTOS or hardware calls: advance() is pure arithmetic, so a host build runs
+ * it (with the unmodified drive stack on top) as fast as the CPU allows.
+ * Forward is Dir::CW (as PowerDriveHandler drives it).
+ */
+class VehicleSim : public IMotorDriver
+{
+public:
+    /**
+     * @brief Construct at rest.
+     *
+     * @param p Vehicle parameters (copied).
+     */
+    explicit VehicleSim(const VehicleParams &p = VehicleParams{}) noexcept;
+
+    /// @brief Latch the duty the drive just wrote (held until the next write).
+    void setSpeedPercent(float pct, Dir dir) override;
+
+    /**
+     * @brief Integrate forward in time.
+     *
+     * @param dt_s Time to advance (s); split into VehicleParams::step_s steps.
+     */
+    void advance(float dt_s) noexcept;
+
+    /// @brief Change the slope under the car (°, nose-up positive).
+    void set_slope_deg(float deg) noexcept;
+
+    /**
+     * @brief What BatteryMonitor would publish now (seeded, then cfg::battery::FILTER_ALPHA; valid after SETTLE_SAMPLES).
+     * @note Call at the monitor cadence (cfg::battery::PERIOD_MS).
+     *
+     * @param stamp_us Timestamp for the snapshot.
+     */
+    BatterySnapshot sample_battery(uint64_t stamp_us) noexcept;
+
+    // ---- Observation ---- //
+    [[nodiscard]] float speed_mps() const noexcept { return v_; }
+    [[nodiscard]] float wheel_rpm() const noexcept { return w_ * kRadToRpm; }
+    [[nodiscard]] float distance_m() const noexcept { return x_; }
+    [[nodiscard]] float wheel_turns() const noexcept { return theta_ * kInv2Pi; }
+    [[nodiscard]] float motor_current_a() const noexcept { return i_; }       ///< Per motor (signed).
+    [[nodiscard]] float battery_current_a() const noexcept { return i_bat_; } ///< + = discharge.
+    [[nodiscard]] float battery_v() const noexcept { return v_bat_; }         ///< Terminal voltage.
+    [[nodiscard]] float soc() const noexcept { return soc_; }
+    [[nodiscard]] float accel_mps2() const noexcept { return a_; } ///< Body acceleration.
+    [[nodiscard]] bool slipping() const noexcept { return slipping_; }
+    [[nodiscard]] float duty_pct() const noexcept { return duty_ * 100.0f * dir_sign_; } ///< Signed duty applied.
+    [[nodiscard]] const VehicleParams &params() const noexcept { return p_; }
+
+private:
+    /// @brief One integration step of h seconds.
+    void substep(float h) noexcept;
+
+    static constexpr float kG = 9.81f;                  ///< Gravity (m/s²).
+    static constexpr float kPi = 3.14159265f;           ///< π.
+    static constexpr float kInv2Pi = 0.5f / kPi;        ///< 1 / 2π.
+    static constexpr float kRadToRpm = 60.0f * kInv2Pi; ///< rad/s → RPM.
+    static constexpr float kRestMps = 1e-3f;            ///< Below this the car counts as stopped.
+
+    VehicleParams p_{};    ///< Parameters.
+    float duty_{0.0f};     ///< Applied duty (0..1).
+    float dir_sign_{1.0f}; ///< +1 forward (CW), −1 reverse.
+    float decay_{0.0f};    ///< exp(−h·R/L) for a full step.
+    float j_axle_{0.0f};   ///< Rotating inertia at the driven axle (kg·m²).
+    float f_grade_{0.0f};  ///< Slope force on the body, + = backwards (N).
+    float f_roll_{0.0f};   ///< Rolling resistance magnitude (N).
+    float f_grip_{0.0f};   ///< Static grip limit on the driven wheels (N).
+    float f_slide_{0.0f};  ///< Sliding friction on the driven wheels (N).
+
+    float i_{0.0f};            ///< Motor current, each (A).
+    float i_bat_{0.0f};        ///< Pack current (A).
+    float v_bat_{0.0f};        ///< Pack terminal voltage (V).
+    float soc_{1.0f};          ///< State of charge.
+    float v_{0.0f};            ///< Body speed (m/s).
+    float a_{0.0f};            ///< Body acceleration (m/s²).
+    float x_{0.0f};            ///< Distance travelled (m).
+    float w_{0.0f};            ///< Wheel speed (rad/s).
+    float theta_{0.0f};        ///< Wheel angle (rad).
+    bool slipping_{false};     ///< Wheel and body speeds differ.
+    float sense_v_{0.0f};      ///< Battery monitor filter state.
+    uint8_t sense_samples_{0}; ///< Battery monitor samples filtered (saturating).
+};
+
+/**
+ * @brief Wheel encoder on a VehicleSim: quadrature counts from the wheel angle.
+ *
+ * Speed goes through the same SpeedEstimator settings as WheelEncoder, so the
+ * drive sees the same quantisation and windowing it would on the car.
+ */
+class SimEncoder : public ISpeedSensor
+{
+public:
+    /**
+     * @brief Construct on a vehicle.
+     *
+     * @param car Vehicle whose driven wheel is read (non-owning).
+     * @param quadrature False → distance only (like an encoder without PIN_B).
+     */
+    explicit SimEncoder(const VehicleSim &car, bool quadrature = true) noexcept;
+
+    float sample_rpm(float dt_s) noexcept override;
+    uint32_t read_counts() noexcept override;
+    [[nodiscard]] uint32_t total_counts() const noexcept override { return total_; }
+    [[nodiscard]] int32_t position() const noexcept override { return position_; }
+    [[nodiscard]] bool has_direction() const noexcept override { return quadrature_; }
+    [[nodiscard]] float counts_per_rev() const noexcept override { return car_->params().counts_per_rev; }
+
+private:
+    const VehicleSim *car_{nullptr}; ///< Non-owning vehicle.
+    bool quadrature_{true};          ///< Reports direction.
+    int32_t position_{0};            ///< Signed count.
+    uint32_t total_{0};              ///< Unsigned count total.
+    uint32_t sampled_{0};            ///< Total at the previous sample_rpm().
+    ctl::SpeedEstimator est_{};      ///< Counts → RPM.
+};
+
+/**
+ * @brief IMU on a VehicleSim: gravity for the slope plus the body's own acceleration, FIFO-buffered.
+ *
+ * Samples pile up at the sample rate between reads like the MPU-6050 FIFO
+ * (85 frames; reading later than that loses them, as an overflow reset
+ * would). Each drained sample is interpolated between the car's state at the
+ * previous read and now, so a batch carries the motion it spans: the
+ * launch shows up as forward acceleration, and driving onto a hill as pitch
+ * rate and then gravity along x.
+ */
+class SimImu : public IImuSource
+{
+public:
+    /**
+     * @brief Construct on a vehicle.
+     *
+     * @param car Vehicle the sensor is bolted to (non-owning).
+     * @param rate_hz Sample rate (Hz).
+     */
+    explicit SimImu(const VehicleSim &car, uint16_t rate_hz = cfg::imu::RATE_HZ) noexcept
+        : car_(&car), hz_(static_cast<float>(rate_hz)) {}
+
+    bool begin() noexcept override;
+    size_t read_batch(ctl::ImuSample *out, size_t max) noexcept override;
+    [[nodiscard]] float sample_hz() const noexcept override { return hz_; }
+    [[nodiscard]] uint32_t overflows() const noexcept override { return overflows_; }
+
+private:
+    /// @brief Small zero-mean noise (LCG; deterministic run to run).
+    float noise(float amplitude) noexcept;
+
+    /// @brief Take the car's state as the start of the next batch.
+    void mark(uint64_t t_us) noexcept;
+
+    static constexpr size_t kFifoFrames = 85;           ///< MPU-6050 FIFO depth.
+    static constexpr float kG = 9.81f;                  ///< Gravity (m/s²).
+    static constexpr float kRad = 3.14159265f / 180.0f; ///< Degrees → radians.
+
+    const VehicleSim *car_{nullptr}; ///< Non-owning vehicle.
+    float hz_{0.0f};                 ///< Sample rate.
+    uint64_t next_us_{0};            ///< Time of the next sample to hand out.
+    uint64_t last_us_{0};            ///< Previous read.
+    float last_v_{0.0f};             ///< Speed at the previous read (m/s).
+    float last_slope_{0.0f};         ///< Slope at the previous read (°).
+    uint32_t overflows_{0};          ///< Simulated FIFO overflows.
+    uint32_t seed_{0x2468ace1u};     ///< Noise state.
+};
@@ -0,0 +1,119 @@
+/**
+ * MIT License
+ *
+ * @brief Work-stealing parallel-for over an index range (host tools).
+ *
+ * @file WorkPool.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace simtools
+{
+    /**
+     * @brief Run fn(i) for every i in [0, n) on `threads` workers.
+     *
+     * Each worker starts with an equal slice and takes indices from its front;
+     * a worker that runs dry steals the back half of the next non-empty
+     * slice round from it. Simulations differ in cost (a long stall, a slope),
+     * so the slices drain unevenly and stealing keeps every core busy until the
+     * end. Locks are per slice and touched once per index, which is noise next
+     * to a simulation.
+     *
+     * fn must be safe to call concurrently for different i; results should go
+     * to slot i of a preallocated array so the outcome never depends on which
+     * worker ran what.
+     */
+    template <typename Fn>
+    void parallel_for(size_t n, unsigned threads, Fn fn)
+    {
+        struct Slice
+        {
+            std::mutex m; ///< Guards lo/hi.
+            size_t lo{0}; ///< Next index to run.
+            size_t hi{0}; ///< One past the last.
+        };
+
+        threads = (threads == 0) ? 1 : threads;
+        std::vector<Slice> slices(threads);
+        for (unsigned w = 0; w < threads; ++w)
+        {
+            slices[w].lo = n * w / threads;
+            slices[w].hi = n * (w + 1) / threads;
+        }
+
+        auto worker = [&](unsigned self)
+        {
+            for (;;)
+            {
+                size_t i = 0;
+                bool got = false;
+                {
+                    Slice &s = slices[self];
+                    std::lock_guard<std::mutex> lock(s.m);
+                    if (s.lo < s.hi)
+                    {
+                        i = s.lo++;
+                        got = true;
+                    }
+                }
+
+                if (!got)
+                {
+                    // Steal: scan from the next worker round, take the back half of the first non-empty slice.
+                    for (unsigned k = 1; k < threads && !got; ++k)
+                    {
+                        Slice &v = slices[(self + k) % threads];
+                        size_t lo = 0;
+                        size_t hi = 0;
+                        {
+                            std::lock_guard<std::mutex> lock(v.m);
+                            const size_t left = v.hi - v.lo;
+                            if (left == 0)
+                                continue;
+                            hi = v.hi;
+                            lo = v.hi - (left + 1) / 2;
+                            v.hi = lo;
+                        }
+                        Slice &s = slices[self];
+                        std::lock_guard<std::mutex> lock(s.m);
+                        s.lo = lo + 1;
+                        s.hi = hi;
+                        i = lo;
+                        got = true;
+                    }
+                    if (!got)
+                        return; ///< Everything taken.
+                }
+
+                fn(i);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (unsigned w = 1; w < threads; ++w)
+            pool.emplace_back(worker, w);
+        worker(0);
+        for (std::thread &t : pool)
+            t.join();
+    }
+
+    /// @brief SplitMix64: decorrelated per-index seeds from one base seed.
+    inline uint64_t mix_seed(uint64_t x) noexcept
+    {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+} ///< Namespace simtools.
@@ -0,0 +1,320 @@
+/**
+ * MIT License
+ *
+ * @brief Dual-receiver failover: failsafe frames published under staggered receiver dropouts.
+ *
+ * Build from the repository root:
+ *
+ *   g++ -O2 -std=gnu++17 -Itools/sim/host -Isrc/config -Isrc/utils tools/sim/failover_main.cpp \
+ *       tools/sim/host/SimHost.cpp -o vehicle_failover
+ *
+ * Usage: vehicle_failover [--frame-ms F] [--drop-ms D] [--every-ms P] [--poll-jitter-ms J] [--fades N] [--seed S]
+ *
+ * Each receiver sends a frame every F ms unless it is in a dropout. Then it
+ * goes silent, and RcLink raises proto_failsafe once no frame has arrived for
+ * cfg::rc::LINK_TIMEOUT_MS. RcPublisher polls every cfg::tick::LOOP_MS (up to
+ * J ms late). It picks a receiver with the real rcmap::Diversity selector and
+ * re-arms the frame watchdog on any valid frame. A poll publishes failsafe
+ * when the watchdog has expired or the selected receiver is unhealthy, as
+ * RcPublisher::run() does.
+ *
+ * Every schedule runs twice. The first run has the primary receiver alone
+ * (DIVERSITY=false). The second has both receivers. The schedules are:
+ *
+ *  - staggered: both receivers drop for D ms every P ms, with the secondary
+ *    offset by P/2, so the dropouts never overlap.
+ *  - overlap 20/60/120: as staggered, but the secondary drop is moved so the
+ *    two overlap by that many ms.
+ *  - fades: N random fades per receiver (10–300 ms, independent), over 10 min.
+ *
+ * Per run the tool reports the failsafe polls, the failsafe episodes, the
+ * source switches and the longest run of polls with no fresh frame. Checks:
+ *
+ *  - staggered: dual publishes no failsafe frame; single does.
+ *  - dual never publishes more failsafe than single.
+ *  - an overlap is bridged without failsafe when the overlap, two frame
+ *    periods and one late poll still fit inside the link timeout.
+ *  - dual switches receiver within one frame interval of a dropout: no longer
+ *    run of frameless polls than ceil(F / poll) during staggered dropouts.
+ *
+ * The exit status is the number of failed checks.
+ *
+ * @file failover_main.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <app_config.h>
+#include <RcDiversity.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// @brief One receiver's dropouts, [from, to) in µs.
+    struct Drop
+    {
+        double from;
+        double to;
+    };
+    using Schedule = std::vector<Drop>;
+
+    /// @brief Simulation settings shared by every run.
+    struct Setup
+    {
+        double frame_us{7000.0};  ///< Receiver frame period.
+        double poll_us{0.0};      ///< Publisher poll period.
+        double jitter_us{1000.0}; ///< Poll lateness, uniform 0..jitter.
+        double timeout_us{0.0};   ///< Link timeout (proto failsafe and watchdog).
+        double length_us{0.0};    ///< Simulated time.
+        unsigned seed{56};        ///< Poll-jitter seed (same for single and dual).
+    };
+
+    /// @brief Results of one run.
+    struct Result
+    {
+        int polls{0};      ///< Polls simulated.
+        int fs_polls{0};   ///< Polls that published failsafe.
+        int episodes{0};   ///< Separate failsafe stretches.
+        int switches{0};   ///< Changes of selected receiver while healthy.
+        int max_stale{0};  ///< Longest run of polls without a fresh frame.
+        double fs_ms{0.0}; ///< Time spent in failsafe.
+    };
+
+    bool dropped(const Schedule &s, double t)
+    {
+        for (const Drop &d : s)
+            if (t >= d.from && t < d.to)
+                return true;
+        return false;
+    }
+
+    /// @brief Time of the last frame receiver @p s sent at or before @p t (-1 → none).
+    double last_frame(const Schedule &s, double t, double frame_us, double phase)
+    {
+        double f = phase + std::floor((t - phase) / frame_us) * frame_us;
+        while (f >= 0.0 && dropped(s, f))
+            f -= frame_us;
+        return f;
+    }
+
+    /// @brief Run N receivers over their schedules, polled the way RcPublisher polls them.
+    template <size_t N>
+    Result run(const Setup &st, const Schedule *rx)
+    {
+        std::mt19937 rng(st.seed);
+        std::uniform_real_distribution<double> u01(0.0, 1.0);
+
+        rcmap::Diversity<N> div;
+        const double phase[2] = {1300.0, 4700.0}; ///< Receivers are not frame-aligned.
+        double got_us[N]{};                       ///< Frame last consumed per receiver.
+        double wd_deadline = 0.0;
+        bool linked = false;
+        bool was_fs = false;
+        size_t prev = 0;
+        int stale = 0;
+        Result r;
+
+        for (double k = 1.0;; k += 1.0)
+        {
+            const double now = k * st.poll_us + u01(rng) * st.jitter_us;
+            if (now >= st.length_us)
+                break;
+            ++r.polls;
+
+            bool up[N];
+            bool fresh = false;
+            for (size_t i = 0; i < N; ++i)
+            {
+                const double f = last_frame(rx[i], now, st.frame_us, phase[i]);
+                up[i] = f >= 0.0 && now - f < st.timeout_us; ///< RcLink proto_failsafe.
+                if (f > got_us[i] && up[i])
+                {
+                    got_us[i] = f;
+                    div.seen(i, static_cast<uint64_t>(now));
+                    fresh = true;
+                }
+            }
+            const size_t sel = div.select(up);
+
+            if (fresh)
+            {
+                wd_deadline = now + st.timeout_us;
+                linked = true;
+                stale = 0;
+            }
+            else
+                r.max_stale = std::max(r.max_stale, ++stale);
+
+            const bool fs = !linked || now >= wd_deadline || !up[sel];
+            if (fs)
+            {
+                ++r.fs_polls;
+                r.fs_ms += st.poll_us / 1000.0;
+                if (!was_fs && linked)
+                    ++r.episodes;
+            }
+            else if (sel != prev)
+                ++r.switches;
+            was_fs = fs;
+            prev = sel;
+        }
+        return r;
+    }
+
+    Schedule periodic(double from, double every, double len, double end)
+    {
+        Schedule s;
+        for (double t = from; t < end; t += every)
+            s.push_back({t, t + len});
+        return s;
+    }
+
+    Schedule fades(std::mt19937 &rng, int n, double end)
+    {
+        std::uniform_real_distribution<double> at(1e6, end - 1e6);
+        std::uniform_real_distribution<double> len(10e3, 300e3);
+        Schedule s;
+        for (int i = 0; i < n; ++i)
+        {
+            const double t = at(rng);
+            s.push_back({t, t + len(rng)});
+        }
+        return s;
+    }
+
+    int failures = 0;
+
+    void verdict(bool ok, const char *what)
+    {
+        printf("  [%s] %s\n", ok ? "PASS" : "FAIL", what);
+        if (!ok)
+            ++failures;
+    }
+
+    void row(const char *name, const char *rx, const Result &r)
+    {
+        printf("%-12s %-6s %7d %9d %9d %9.0f %9d %10d\n", name, rx, r.polls, r.fs_polls, r.episodes, r.fs_ms,
+               r.switches, r.max_stale);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Setup st;
+    st.poll_us = cfg::tick::LOOP_MS * 1000.0;
+    st.timeout_us = cfg::rc::LINK_TIMEOUT_MS * 1000.0;
+    double drop_ms = 200.0;
+    double every_ms = 2000.0;
+    int n_fades = 200;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--frame-ms") && i + 1 < argc)
+            st.frame_us = atof(argv[++i]) * 1000.0;
+        else if (!strcmp(argv[i], "--drop-ms") && i + 1 < argc)
+            drop_ms = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--every-ms") && i + 1 < argc)
+            every_ms = atof(argv[++i]);
+        else if (!strcmp(argv[i], "--poll-jitter-ms") && i + 1 < argc)
+            st.jitter_us = atof(argv[++i]) * 1000.0;
+        else if (!strcmp(argv[i], "--fades") && i + 1 < argc)
+            n_fades = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+            st.seed = static_cast<unsigned>(atoi(argv[++i]));
+        else
+        {
+            fprintf(stderr,
+                    "usage: %s [--frame-ms F] [--drop-ms D] [--every-ms P] [--poll-jitter-ms J] [--fades N] "
+                    "[--seed S]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    if (st.frame_us <= 0.0 || drop_ms <= 0.0 || every_ms < 2.0 * drop_ms || n_fades < 0)
+        return 2;
+
+    const double drop = drop_ms * 1000.0;
+    const double every = every_ms * 1000.0;
+    st.length_us = 120e6;
+
+    printf("Frame %.1f ms, poll %u ms (+0..%.1f ms late), link timeout %u ms, dropouts %.0f ms every %.0f ms\n\n",
+           st.frame_us / 1000.0, cfg::tick::LOOP_MS, st.jitter_us / 1000.0, cfg::rc::LINK_TIMEOUT_MS, drop_ms,
+           every_ms);
+    printf("%-12s %-6s %7s %9s %9s %9s %9s %10s\n", "schedule", "rx", "polls", "fs polls", "episodes", "fs ms",
+           "switches", "max stale");
+
+    // ---- Staggered and overlapping dropouts ---- //
+    const int max_gap = static_cast<int>(std::ceil(st.frame_us / st.poll_us)); ///< Frameless polls in normal running.
+    const double overlaps[] = {0.0, 20.0, 60.0, 120.0};
+    for (double ov : overlaps)
+    {
+        const double lead = every / 2.0;
+        const double b_from = ov > 0.0 ? lead + drop - ov * 1000.0 : lead + every / 2.0;
+        const Schedule rx[2] = {periodic(lead, every, drop, st.length_us),
+                                periodic(b_from, every, drop, st.length_us)};
+        char name[24];
+        if (ov > 0.0)
+            snprintf(name, sizeof(name), "overlap %.0f", ov);
+        else
+            snprintf(name, sizeof(name), "staggered");
+
+        const Result one = run<1>(st, rx);
+        const Result two = run<2>(st, rx);
+        row(name, "single", one);
+        row(name, "dual", two);
+
+        char what[128];
+        if (ov == 0.0)
+        {
+            verdict(two.fs_polls == 0 && one.fs_polls > 0, "staggered: dual publishes no failsafe frame, single does");
+            verdict(two.max_stale <= max_gap, "staggered: dual switches receiver within one frame interval");
+        }
+        else if (ov * 1000.0 + 2.0 * st.frame_us + st.poll_us + st.jitter_us < st.timeout_us)
+        {
+            snprintf(what, sizeof(what), "overlap %.0f ms + frame/poll slack < link timeout: bridged without failsafe", ov);
+            verdict(two.fs_polls == 0, what);
+        }
+        snprintf(what, sizeof(what), "%s: dual failsafe polls <= single", name);
+        verdict(two.fs_polls <= one.fs_polls, what);
+    }
+
+    // ---- Independent random fades over 10 minutes ---- //
+    {
+        Setup lf = st;
+        lf.length_us = 600e6;
+        std::mt19937 rng(st.seed);
+        const Schedule rx[2] = {fades(rng, n_fades, lf.length_us), fades(rng, n_fades, lf.length_us)};
+        const Result one = run<1>(lf, rx);
+        const Result two = run<2>(lf, rx);
+        row("fades", "single", one);
+        row("fades", "dual", two);
+        verdict(two.fs_polls <= one.fs_polls, "fades: dual failsafe polls <= single");
+    }
+
+    // ---- Selection cost ---- //
+    {
+        rcmap::Diversity<2> div;
+        bool up[2] = {true, true};
+        constexpr int kIters = 10000000;
+        size_t sink = 0;
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < kIters; ++i)
+        {
+            div.seen(static_cast<size_t>(i & 1), static_cast<uint64_t>(i));
+            up[(i >> 3) & 1] = (i & 7) != 0;
+            sink += div.select(up);
+        }
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+        printf("\nDiversity<2> seen+select: %.2f ns per poll (host, checksum %zu)\n", ns / kIters, sink);
+    }
+
+    printf("\n%d check(s) failed\n", failures);
+    return failures;
+}
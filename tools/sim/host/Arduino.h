@@ -0,0 +1,94 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for the parts of Arduino-ESP32 the drive stack touches.
+ *
+ * @file Arduino.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cmath>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/portmacro.h>
+#include <esp_timer.h>
+#include <SimHost.h>
+
+/**
+ * @brief Serial: discarded unless simhost::set_echo(true), then stdout.
+ */
+class HostSerial
+{
+public:
+    size_t print(const char *s) noexcept;
+    size_t print(char c) noexcept;
+    size_t print(long v) noexcept;
+    size_t print(unsigned long v) noexcept;
+    size_t print(int v) noexcept { return print(static_cast<long>(v)); }
+    size_t print(unsigned v) noexcept { return print(static_cast<unsigned long>(v)); }
+    size_t print(double v, int digits = 2) noexcept;
+    template <typename T>
+    size_t println(const T &v) noexcept
+    {
+        const size_t n = print(v);
+        return n + print('\n');
+    }
+    size_t println(double v, int digits) noexcept { return print(v, digits) + print('\n'); }
+    int printf(const char *fmt, ...) noexcept __attribute__((format(printf, 2, 3)));
+    void begin(unsigned long) noexcept {}
+};
+
+extern HostSerial Serial; ///< The one console.
+
+// UART framing (Arduino-ESP32 encodings).
+constexpr uint32_t SERIAL_8N1 = 0x800001c;
+constexpr uint32_t SERIAL_8E2 = 0x800003e;
+
+/**
+ * @brief Receiver UART: bytes arrive only through inject(), in the order the host check feeds them.
+ */
+class HardwareSerial
+{
+public:
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rx = -1, int8_t tx = -1,
+               bool invert = false) noexcept;
+    size_t setRxBufferSize(size_t n) noexcept;
+    int available() const noexcept { return static_cast<int>(len_ - head_); }
+    size_t read(uint8_t *buf, size_t n) noexcept;
+
+    /// @brief Host only: queue bytes as if they had come down the wire (dropped past the RX buffer size).
+    void inject(const uint8_t *buf, size_t n) noexcept;
+
+    [[nodiscard]] bool open() const noexcept { return open_; }             ///< begin() has run.
+    [[nodiscard]] unsigned long baud() const noexcept { return baud_; }    ///< Rate passed to begin().
+    [[nodiscard]] uint32_t config() const noexcept { return config_; }     ///< Framing passed to begin().
+    [[nodiscard]] bool inverted() const noexcept { return invert_; }       ///< Line inversion passed to begin().
+    [[nodiscard]] size_t overflows() const noexcept { return overflows_; } ///< Bytes dropped on a full buffer.
+
+private:
+    static constexpr size_t kMax = 1024; ///< Largest RX buffer the host models.
+
+    uint8_t buf_[kMax]{};   ///< Received bytes.
+    size_t head_{0};        ///< Next byte to read.
+    size_t len_{0};         ///< Bytes in buf_.
+    size_t cap_{256};       ///< RX buffer size (setRxBufferSize).
+    bool open_{false};      ///< begin() has run.
+    unsigned long baud_{0}; ///< Configured rate.
+    uint32_t config_{0};    ///< Configured framing.
+    bool invert_{false};    ///< Configured inversion.
+    size_t overflows_{0};   ///< Dropped bytes.
+};
+
+extern HardwareSerial Serial1; ///< Secondary receiver UART.
+extern HardwareSerial Serial2; ///< Primary receiver UART.
+
+inline uint32_t millis() { return static_cast<uint32_t>(simhost::now_us() / 1000ULL); }
+inline uint32_t micros() { return static_cast<uint32_t>(simhost::now_us()); }
+void delay(uint32_t ms); ///< Blocking wait: aborts on the host, like the task delays.
@@ -0,0 +1,27 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for Universal_Button's BUTTON_LIST expansion.
+ *
+ * @file ButtonHandler_Config.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <Universal_Button.h>
+
+#define BUTTONS_HOST_ENUM(name, pin) name,
+#define BUTTONS_HOST_COUNT(name, pin) +1
+
+/// @brief Logical buttons, in BUTTON_LIST order.
+enum class ButtonIndex : uint8_t
+{
+    BUTTON_LIST(BUTTONS_HOST_ENUM)
+};
+
+constexpr size_t NUM_BUTTONS = 0 BUTTON_LIST(BUTTONS_HOST_COUNT); ///< Number of buttons.
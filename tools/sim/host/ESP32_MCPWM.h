@@ -0,0 +1,31 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for the ESP32_MCPWM motor interface.
+ *
+ * @file ESP32_MCPWM.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/// @brief H-bridge direction.
+enum class Dir : uint8_t
+{
+    CW = 0,
+    CCW
+};
+
+/**
+ * @brief Anything that takes a duty and direction.
+ */
+class IMotorDriver
+{
+public:
+    virtual ~IMotorDriver() = default;
+    virtual void setSpeedPercent(float pct, Dir dir) = 0;
+};
@@ -0,0 +1,47 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for SnapshotBus's input model (button bitset + edges).
+ *
+ * @file InputModel.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+namespace snapshot
+{
+    namespace input
+    {
+        /// @brief Button states and when they were sampled.
+        template <size_t N>
+        struct State
+        {
+            std::bitset<N> buttons{}; ///< Pressed = 1.
+            uint32_t stamp_ms{0};     ///< Sample time (ms).
+        };
+
+        /// @brief Call fn(index, pressed, stamp_ms) for every button that changed.
+        template <size_t N, typename Fn>
+        inline void for_each_edge(const State<N> &prev, const State<N> &cur, Fn fn)
+        {
+            const std::bitset<N> changed = prev.buttons ^ cur.buttons;
+            for (size_t i = 0; i < N; ++i)
+                if (changed.test(i))
+                    fn(i, cur.buttons.test(i), cur.stamp_ms);
+        }
+
+        /// @brief Enum → bit index.
+        template <typename E>
+        constexpr size_t idx(E e) noexcept
+        {
+            return static_cast<size_t>(e);
+        }
+    } ///< Namespace input.
+} ///< Namespace snapshot.
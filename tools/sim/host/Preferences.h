@@ -0,0 +1,64 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for NVS Preferences (in memory, per thread).
+ *
+ * @file Preferences.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Key/value blobs that live as long as the thread (one simulated boot).
+ */
+class Preferences
+{
+public:
+    bool begin(const char *ns, bool /*read_only*/ = false)
+    {
+        ns_ = ns;
+        return true;
+    }
+    void end() {}
+
+    size_t putBytes(const char *key, const void *v, size_t n)
+    {
+        const uint8_t *p = static_cast<const uint8_t *>(v);
+        store()[ns_ + "/" + key].assign(p, p + n);
+        return n;
+    }
+
+    size_t getBytesLength(const char *key)
+    {
+        const auto it = store().find(ns_ + "/" + key);
+        return (it == store().end()) ? 0 : it->second.size();
+    }
+
+    size_t getBytes(const char *key, void *out, size_t n)
+    {
+        const auto it = store().find(ns_ + "/" + key);
+        if (it == store().end() || it->second.size() > n)
+            return 0;
+        memcpy(out, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+
+private:
+    static std::map<std::string, std::vector<uint8_t>> &store()
+    {
+        thread_local std::map<std::string, std::vector<uint8_t>> s; ///< Namespace/key → bytes.
+        return s;
+    }
+
+    std::string ns_{}; ///< Open namespace.
+};
@@ -0,0 +1,261 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for RCLink: the role enum builder, the config builder and an RcLink over a transport.
+ *
+ * This is the RCLink surface the firmware relies on, written down in one
+ * place so RcPublisher and RcTransports compile and run on the host:
+ *
+ *  - rc::Config<E>: axis(role).raw().deadband_us().out().done(),
+ *    setFailsafePolicy(), setLinkTimeout(), via RC_CONFIG / RC_CFG_MAP_DEFAULT.
+ *  - rc::RcLink<T, E>: constructed on a transport; begin(port, baud, rx, tx)
+ *    opens it; update() polls it and returns true on a new frame; frame().vals
+ *    holds raw µs per role; status() reports rx_failsafe_sig / proto_failsafe;
+ *    apply_rxfs_outputs() / apply_config() / RC_SET_FS_SIGNATURE_SELECTED.
+ *  - Transports (rc::RcIbusTransport here, RcUartTransport in RcTransports.h):
+ *    begin(), poll() → bool, channels(), channel(i), failsafe().
+ *
+ * On a library update that changes any of these, the host check
+ * (tools/rc/publisher_check.cpp) is where the firmware side stops compiling.
+ *
+ * @file RCLink.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#define RCLINK_HOST_ROLE_ENUM(name) name,
+#define RC_DECLARE_ROLES(E, LIST)                \
+    enum class E : uint8_t                       \
+    {                                            \
+        LIST(RCLINK_HOST_ROLE_ENUM) Count        \
+    };
+
+namespace rc
+{
+    /// @brief What a role outputs while the link is in failsafe.
+    struct Failsafe
+    {
+        enum class Mode : uint8_t
+        {
+            Hold, ///< Keep the last value.
+            Value ///< Substitute a fixed raw value.
+        };
+    };
+
+    /**
+     * @brief Role → channel map, axis shaping and failsafe policy.
+     *
+     * @tparam E Role enum declared with RC_DECLARE_ROLES.
+     */
+    template <typename E>
+    class Config
+    {
+    public:
+        static constexpr size_t N = static_cast<size_t>(E::Count); ///< Roles.
+
+        /// @brief Axis builder (the host keeps only what the firmware sets: a raw pass-through).
+        struct Axis
+        {
+            Axis &raw(int /*min*/, int /*max*/, int /*center*/) noexcept { return *this; }
+            Axis &deadband_us(int /*us*/) noexcept { return *this; }
+            Axis &out(int /*min*/, int /*max*/) noexcept { return *this; }
+            void done() noexcept {}
+        };
+
+        /// @brief Role i reads channel i (declared order).
+        void map_default() noexcept
+        {
+            for (size_t i = 0; i < N; ++i)
+                ch[i] = static_cast<uint8_t>(i);
+        }
+
+        Axis axis(E /*role*/) noexcept { return {}; }
+
+        void setFailsafePolicy(E role, Failsafe::Mode mode, int16_t value) noexcept
+        {
+            fs_mode[static_cast<size_t>(role)] = mode;
+            fs_value[static_cast<size_t>(role)] = value;
+        }
+
+        void setLinkTimeout(uint32_t ms) noexcept { link_timeout_ms = ms; }
+
+        uint8_t ch[N]{};               ///< Channel per role.
+        Failsafe::Mode fs_mode[N]{};   ///< Failsafe policy per role.
+        int16_t fs_value[N]{};         ///< Failsafe raw value per role (Mode::Value).
+        uint32_t link_timeout_ms{200}; ///< No frame for this long → proto_failsafe.
+    };
+
+    /// @brief One pin of a receiver failsafe signature: role and the raw value the receiver parks it at.
+    template <typename E>
+    struct FsPin
+    {
+        E role;        ///< Role.
+        int16_t value; ///< Raw µs while the receiver is in failsafe.
+    };
+
+    /// @brief Link state as RcPublisher reads it.
+    struct Status
+    {
+        bool rx_failsafe_sig{false}; ///< Selected channels match the receiver's failsafe signature.
+        bool proto_failsafe{false};  ///< Protocol flag set, or no frame within the link timeout.
+    };
+
+    /// @brief Raw µs per role.
+    template <size_t N>
+    struct Frame
+    {
+        int16_t vals[N]{};
+    };
+
+    /**
+     * @brief iBUS transport (32-byte frames, 14 channels, checksum), driven through the same surface as RcUartTransport.
+     */
+    class RcIbusTransport
+    {
+    public:
+        static constexpr size_t kFrameLen = 32; ///< Length byte + command + 14 × 2 + checksum.
+        static constexpr size_t kChannels = 14; ///< Channels per frame.
+
+        void begin(HardwareSerial &port, uint32_t baud, int rx, int tx) noexcept
+        {
+            port_ = &port;
+            port.begin(baud, SERIAL_8N1, static_cast<int8_t>(rx), static_cast<int8_t>(tx));
+        }
+
+        bool poll() noexcept
+        {
+            if (!port_)
+                return false;
+
+            bool fresh = false;
+            uint8_t b = 0;
+            while (port_->read(&b, 1) == 1)
+                fresh |= push(b);
+            return fresh;
+        }
+
+        [[nodiscard]] size_t channels() const noexcept { return kChannels; }
+        [[nodiscard]] int16_t channel(size_t i) const noexcept { return us_[i]; }
+        [[nodiscard]] bool failsafe() const noexcept { return false; } ///< iBUS has no failsafe flag.
+
+    private:
+        bool push(uint8_t b) noexcept
+        {
+            if ((len_ == 0 && b != 0x20) || (len_ == 1 && b != 0x40))
+            {
+                len_ = 0; ///< Hunting for the 0x20 0x40 header.
+                return false;
+            }
+
+            buf_[len_++] = b;
+            if (len_ < kFrameLen)
+                return false;
+            len_ = 0;
+
+            uint16_t sum = 0xFFFF;
+            for (size_t i = 0; i < kFrameLen - 2; ++i)
+                sum = static_cast<uint16_t>(sum - buf_[i]);
+            if (sum != static_cast<uint16_t>(buf_[30] | (buf_[31] << 8)))
+                return false;
+
+            for (size_t i = 0; i < kChannels; ++i)
+                us_[i] = static_cast<int16_t>(buf_[2 + 2 * i] | (buf_[3 + 2 * i] << 8));
+            return true;
+        }
+
+        HardwareSerial *port_{nullptr}; ///< Non-owning UART.
+        uint8_t buf_[kFrameLen]{};      ///< Frame under assembly.
+        size_t len_{0};                 ///< Bytes in buf_.
+        int16_t us_[kChannels]{};       ///< Last decoded channels (µs).
+    };
+
+    /**
+     * @brief Receiver link: polls a transport, maps channels to roles, applies failsafe.
+     *
+     * @tparam T Transport (begin/poll/channels/channel/failsafe).
+     * @tparam E Role enum.
+     */
+    template <typename T, typename E>
+    class RcLink
+    {
+    public:
+        static constexpr size_t N = static_cast<size_t>(E::Count); ///< Roles.
+
+        explicit RcLink(T &transport) noexcept : t_(&transport) {}
+
+        void begin(HardwareSerial &port, uint32_t baud, int rx, int tx) noexcept { t_->begin(port, baud, rx, tx); }
+
+        void apply_config(const Config<E> &cfg) noexcept { cfg_ = cfg; }
+        void apply_rxfs_outputs(bool on) noexcept { rxfs_outputs_ = on; }
+
+        /// @brief Receiver failsafe signature: every pinned role within @p tol µs of its value.
+        void set_fs_signature(int tol, uint32_t /*hold_ms*/, std::initializer_list<FsPin<E>> pins) noexcept
+        {
+            sig_n_ = 0;
+            for (const FsPin<E> &p : pins)
+                if (sig_n_ < N)
+                    sig_[sig_n_++] = p;
+            sig_tol_ = tol;
+        }
+
+        /// @brief Poll the transport. Returns true if a new frame arrived.
+        bool update() noexcept
+        {
+            const bool fresh = t_->poll();
+            const uint64_t t = simhost::now_us();
+
+            if (fresh)
+            {
+                last_us_ = t;
+                for (size_t i = 0; i < N; ++i)
+                    raw_.vals[i] = (cfg_.ch[i] < t_->channels()) ? t_->channel(cfg_.ch[i]) : 0;
+            }
+
+            st_.rx_failsafe_sig = sig_n_ > 0;
+            for (size_t k = 0; k < sig_n_; ++k)
+            {
+                const int d = raw_.vals[static_cast<size_t>(sig_[k].role)] - sig_[k].value;
+                st_.rx_failsafe_sig = st_.rx_failsafe_sig && d <= sig_tol_ && d >= -sig_tol_;
+            }
+            st_.proto_failsafe = t_->failsafe() || last_us_ == 0 ||
+                                 t - last_us_ > static_cast<uint64_t>(cfg_.link_timeout_ms) * 1000ULL;
+
+            out_ = raw_;
+            if (st_.proto_failsafe || (rxfs_outputs_ && st_.rx_failsafe_sig))
+            {
+                for (size_t i = 0; i < N; ++i)
+                    if (cfg_.fs_mode[i] == Failsafe::Mode::Value)
+                        out_.vals[i] = cfg_.fs_value[i];
+            }
+            return fresh;
+        }
+
+        [[nodiscard]] Frame<N> frame() const noexcept { return out_; }
+        [[nodiscard]] const Status &status() const noexcept { return st_; }
+
+    private:
+        T *t_{nullptr};            ///< Non-owning transport.
+        Config<E> cfg_{};          ///< Applied configuration.
+        bool rxfs_outputs_{false}; ///< Substitute failsafe values on a receiver signature too.
+        FsPin<E> sig_[N]{};        ///< Failsafe signature pins.
+        size_t sig_n_{0};          ///< Pins in use.
+        int sig_tol_{0};           ///< Signature tolerance (µs).
+        Frame<N> raw_{};           ///< Last frame from the transport.
+        Frame<N> out_{};           ///< Frame after failsafe substitution.
+        Status st_{};              ///< Link state after the last update().
+        uint64_t last_us_{0};      ///< Arrival time of the last frame (0 → none yet).
+    };
+} ///< Namespace rc.
+
+#define RC_CONFIG(E, name) rc::Config<E> name
+#define RC_CFG_MAP_DEFAULT(E, name) (name).map_default()
+#define RC_SET_FS_SIGNATURE_SELECTED(E, link, tol, hold_ms, ...) \
+    (link).set_fs_signature((tol), (hold_ms), std::initializer_list<rc::FsPin<E>> __VA_ARGS__)
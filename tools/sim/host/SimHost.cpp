@@ -0,0 +1,207 @@
+/**
+ * MIT License
+ *
+ * @brief Host runtime: simulated clock, console, UARTs, timers and the FreeRTOS calls that must not run.
+ *
+ * @file SimHost.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    thread_local uint64_t t_now_us = 0; ///< Simulated time.
+    thread_local bool t_echo = false;   ///< Console to stdout.
+
+    thread_local std::vector<esp_timer *> t_timers;                 ///< Timers created on this thread.
+    thread_local std::vector<std::pair<void *, uint32_t>> t_notify; ///< Pending notifications per task handle.
+
+    [[noreturn]] void no_rtos(const char *what)
+    {
+        fprintf(stderr, "%s called on the host: step objects, do not run their task loops\n", what);
+        abort();
+    }
+}
+
+/// @brief One-shot timer: due time plus callback, fired by simhost::run_timers().
+struct esp_timer
+{
+    esp_timer_cb_t cb{nullptr}; ///< Expiry callback.
+    void *arg{nullptr};         ///< Callback argument.
+    uint64_t due_us{0};         ///< Expiry time (simulated clock).
+    bool armed{false};          ///< Started and not yet fired or stopped.
+};
+
+HostSerial Serial;
+HardwareSerial Serial1;
+HardwareSerial Serial2;
+TwoWire Wire;
+
+// ---- Clock and echo ---- //
+
+uint64_t simhost::now_us() noexcept { return t_now_us; }
+void simhost::set_now_us(uint64_t us) noexcept { t_now_us = us; }
+void simhost::set_echo(bool on) noexcept { t_echo = on; }
+bool simhost::echo() noexcept { return t_echo; }
+
+int simhost::run_timers() noexcept
+{
+    int fired = 0;
+    for (esp_timer *t : t_timers)
+    {
+        if (!t->armed || t->due_us > t_now_us)
+            continue;
+        t->armed = false; ///< Disarm first: the callback may re-arm.
+        t->cb(t->arg);
+        ++fired;
+    }
+    return fired;
+}
+
+uint32_t simhost::take_notify(void *task) noexcept
+{
+    for (auto &n : t_notify)
+    {
+        if (n.first == task)
+        {
+            const uint32_t c = n.second;
+            n.second = 0;
+            return c;
+        }
+    }
+    return 0;
+}
+
+// ---- Console ---- //
+
+size_t HostSerial::print(const char *s) noexcept { return t_echo ? static_cast<size_t>(fputs(s, stdout)) : 0; }
+size_t HostSerial::print(char c) noexcept { return t_echo ? static_cast<size_t>(fputc(c, stdout) != EOF) : 0; }
+size_t HostSerial::print(long v) noexcept { return t_echo ? static_cast<size_t>(::printf("%ld", v)) : 0; }
+size_t HostSerial::print(unsigned long v) noexcept { return t_echo ? static_cast<size_t>(::printf("%lu", v)) : 0; }
+size_t HostSerial::print(double v, int digits) noexcept
+{
+    return t_echo ? static_cast<size_t>(::printf("%.*f", digits, v)) : 0;
+}
+
+int HostSerial::printf(const char *fmt, ...) noexcept
+{
+    if (!t_echo)
+        return 0;
+    va_list ap;
+    va_start(ap, fmt);
+    const int n = vprintf(fmt, ap);
+    va_end(ap);
+    return n;
+}
+
+// ---- Receiver UARTs ---- //
+
+void HardwareSerial::begin(unsigned long baud, uint32_t config, int8_t, int8_t, bool invert) noexcept
+{
+    open_ = true;
+    baud_ = baud;
+    config_ = config;
+    invert_ = invert;
+    head_ = len_ = 0;
+}
+
+size_t HardwareSerial::setRxBufferSize(size_t n) noexcept
+{
+    cap_ = (n < kMax) ? n : kMax;
+    return cap_;
+}
+
+size_t HardwareSerial::read(uint8_t *buf, size_t n) noexcept
+{
+    const size_t k = (n < len_ - head_) ? n : len_ - head_;
+    memcpy(buf, buf_ + head_, k);
+    head_ += k;
+    if (head_ == len_)
+        head_ = len_ = 0;
+    return k;
+}
+
+void HardwareSerial::inject(const uint8_t *buf, size_t n) noexcept
+{
+    if (!open_)
+        return; ///< Nothing listens on a closed port.
+
+    memmove(buf_, buf_ + head_, len_ - head_);
+    len_ -= head_;
+    head_ = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (len_ < cap_)
+            buf_[len_++] = buf[i];
+        else
+            ++overflows_;
+    }
+}
+
+// ---- esp_timer ---- //
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out)
+{
+    esp_timer *t = new esp_timer{}; ///< Lives for the process, like a firmware timer.
+    t->cb = args->callback;
+    t->arg = args->arg;
+    t_timers.push_back(t);
+    *out = t;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t timeout_us)
+{
+    if (t->armed)
+        return ESP_ERR_INVALID_STATE;
+    t->due_us = t_now_us + timeout_us;
+    t->armed = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t t)
+{
+    if (!t->armed)
+        return ESP_ERR_INVALID_STATE;
+    t->armed = false;
+    return ESP_OK;
+}
+
+// ---- FreeRTOS ---- //
+
+TickType_t xTaskGetTickCount() { return static_cast<TickType_t>(t_now_us / 1000ULL / portTICK_PERIOD_MS); }
+void vTaskDelayUntil(TickType_t *, TickType_t) { no_rtos("vTaskDelayUntil"); }
+void vTaskDelay(TickType_t) { no_rtos("vTaskDelay"); }
+void delay(uint32_t) { no_rtos("delay"); }
+
+BaseType_t xTaskCreatePinnedToCore(void (*)(void *), const char *, uint32_t, void *arg, UBaseType_t, TaskHandle_t *handle,
+                                   BaseType_t)
+{
+    if (handle)
+        *handle = arg;
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    for (auto &n : t_notify)
+    {
+        if (n.first == task)
+        {
+            ++n.second;
+            return pdPASS;
+        }
+    }
+    t_notify.emplace_back(task, 1u);
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t, TickType_t) { no_rtos("ulTaskNotifyTake"); }
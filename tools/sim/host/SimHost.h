@@ -0,0 +1,35 @@
+/**
+ * MIT License
+ *
+ * @brief Host runtime controls: the simulated clock and console echo.
+ *
+ * @file SimHost.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace simhost
+{
+    /// @brief Simulated time (µs). Per thread, so parallel simulations keep their own clocks.
+    uint64_t now_us() noexcept;
+
+    /// @brief Set the simulated time (the rig advances it; nothing else does).
+    void set_now_us(uint64_t us) noexcept;
+
+    /// @brief Route Serial output to stdout (default: discarded). Per thread.
+    void set_echo(bool on) noexcept;
+
+    /// @brief True if Serial output is routed to stdout on this thread.
+    bool echo() noexcept;
+
+    /// @brief Fire every one-shot esp_timer due at now_us() (call after advancing the clock). Returns how many fired.
+    int run_timers() noexcept;
+
+    /// @brief Notifications given to @p task since the last call (xTaskNotifyGive), then cleared.
+    uint32_t take_notify(void *task) noexcept;
+} ///< Namespace simhost.
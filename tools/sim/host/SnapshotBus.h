@@ -0,0 +1,37 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for SnapshotBus (single-threaded: a copy in, a copy out).
+ *
+ * @file SnapshotBus.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace snapshot
+{
+    /**
+     * @brief Latest-value bus. Each simulation owns its buses and steps on one thread.
+     */
+    template <typename T>
+    class SnapshotBus
+    {
+    public:
+        void publish(const T &v) noexcept
+        {
+            value_ = v;
+            ++seq_;
+        }
+        [[nodiscard]] T peek() const noexcept { return value_; }
+        [[nodiscard]] uint32_t seq() const noexcept { return seq_; } ///< Publishes so far.
+
+    private:
+        T value_{};       ///< Last published.
+        uint32_t seq_{0}; ///< Publish count.
+    };
+} ///< Namespace snapshot.
@@ -0,0 +1,20 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for Universal_Button (types only; buttons come from the rig).
+ *
+ * @file Universal_Button.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/// @brief Button handler placeholder (StateManager is not simulated).
+template <size_t N>
+class ButtonHandler
+{
+};
@@ -0,0 +1,30 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for the Arduino-ESP32 I²C bus: nothing answers.
+ *
+ * @file Wire.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * @brief I²C master with no devices on it: every address NACKs, so a sensor's begin() fails cleanly.
+ */
+class TwoWire
+{
+public:
+    bool begin(int /*sda*/, int /*scl*/, uint32_t /*hz*/) noexcept { return true; }
+    void beginTransmission(uint8_t /*addr*/) noexcept {}
+    size_t write(uint8_t /*b*/) noexcept { return 1; }
+    uint8_t endTransmission(bool /*send_stop*/ = true) noexcept { return 2; } ///< Address NACK.
+    size_t requestFrom(uint8_t /*addr*/, size_t /*n*/) noexcept { return 0; }
+    size_t readBytes(uint8_t * /*buf*/, size_t /*n*/) noexcept { return 0; }
+};
+
+extern TwoWire Wire; ///< The one bus.
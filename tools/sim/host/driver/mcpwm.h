@@ -0,0 +1,27 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for the MCPWM types PwmControl.h names.
+ *
+ * @file mcpwm.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+
+typedef enum
+{
+    MCPWM_UNIT_0 = 0,
+    MCPWM_UNIT_1
+} mcpwm_unit_t;
+
+typedef enum
+{
+    MCPWM_TIMER_0 = 0,
+    MCPWM_TIMER_1,
+    MCPWM_TIMER_2
+} mcpwm_timer_t;
@@ -0,0 +1,20 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for the PCNT types WheelEncoder.h names.
+ *
+ * @file pcnt.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+typedef enum
+{
+    PCNT_UNIT_0 = 0,
+    PCNT_UNIT_1,
+    PCNT_UNIT_2,
+    PCNT_UNIT_3
+} pcnt_unit_t;
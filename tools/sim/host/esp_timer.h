@@ -0,0 +1,42 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for esp_timer: the simulation clock and one-shot timers fired by simhost::run_timers().
+ *
+ * @file esp_timer.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <SimHost.h>
+
+inline int64_t esp_timer_get_time() { return static_cast<int64_t>(simhost::now_us()); }
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_ERR_INVALID_STATE 0x103
+
+typedef struct esp_timer *esp_timer_handle_t;
+typedef void (*esp_timer_cb_t)(void *arg);
+
+typedef enum
+{
+    ESP_TIMER_TASK ///< Callback runs from the esp_timer task (on the host: inside simhost::run_timers()).
+} esp_timer_dispatch_t;
+
+typedef struct
+{
+    esp_timer_cb_t callback;
+    void *arg;
+    esp_timer_dispatch_t dispatch_method;
+    const char *name;
+    bool skip_unhandled_events;
+} esp_timer_create_args_t;
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out);
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us);
+esp_err_t esp_timer_stop(esp_timer_handle_t timer); ///< ESP_ERR_INVALID_STATE if not running, like the target.
@@ -0,0 +1,16 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for the port macros app_config.h uses.
+ *
+ * @file portmacro.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+inline bool xPortInIsrContext() { return false; }
+inline void taskYIELD() {}
+inline int xPortGetCoreID() { return 0; } ///< One host thread per simulated car.
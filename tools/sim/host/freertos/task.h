@@ -0,0 +1,24 @@
+/**
+ * MIT License
+ *
+ * @brief Host stand-in for FreeRTOS task calls (the simulator steps objects; tasks never run).
+ *
+ * @file task.h
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#pragma once
+
+#include <freertos/FreeRTOS.h>
+
+TickType_t xTaskGetTickCount();
+void vTaskDelayUntil(TickType_t *last_wake, TickType_t ticks); ///< Aborts: run loops are not for the host.
+void vTaskDelay(TickType_t ticks);                             ///< Aborts: run loops are not for the host.
+
+/// @brief Records nothing and never runs @p fn: the host steps the object instead. The handle is @p arg.
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void *), const char *name, uint32_t stack, void *arg,
+                                   UBaseType_t prio, TaskHandle_t *handle, BaseType_t core);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);                 ///< Counted per handle; nothing waits on the host.
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks); ///< Aborts: run loops are not for the host.
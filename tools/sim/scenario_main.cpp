@@ -0,0 +1,1053 @@
+/**
+ * MIT License
+ *
+ * @brief Scenario regression suite: golden motor command traces plus latency and cost budgets.
+ *
+ * Build from the repository root:
+ *
+ *   g++ -O2 -std=gnu++17 -Itools/sim/host -Itools/sim -Isrc/config -Isrc/include -Isrc/lib -Isrc/utils \
+ *       tools/sim/scenario_main.cpp tools/sim/SimRig.cpp tools/sim/host/SimHost.cpp \
+ *       src/lib/ControlCore/ControlCore.cpp src/lib/PowerDriveHandler/PowerDriveHandler.cpp \
+ *       src/lib/ImuService/ImuService.cpp src/lib/ImuSources/ImuSources.cpp \
+ *       src/lib/GainStore/GainStore.cpp tools/sim/VehicleSim.cpp -o vehicle_scenarios
+ *
+ * Usage: vehicle_scenarios [--golden DIR] [--only NAME] [--update] [--tol PCT] [--cost-scale X] [--warn-cost]
+ *                          [--verbose]
+ *
+ * Each scenario drives the unmodified ControlCore and PowerDriveHandler on a
+ * SimRig and records the motor command every tick (duty, direction, ramp
+ * phase, limiter bits; long runs keep every Nth tick). Three things must
+ * hold for a pass:
+ *
+ *  - Trace: every row matches DIR/<name>.csv (duty within --tol, the rest exact).
+ *  - Latency: each probe's stimulus → response time, in simulated time, is within budget.
+ *  - Values: each bound's quantity (speed, current, temperature, ...) stays in
+ *    range over its window.
+ *
+ * All three run on the simulated clock, so they are deterministic on any machine.
+ * The exit status is the number of failed scenarios (0 → all passed), so the
+ * suite can gate a build. After an intended behaviour change, rerun with
+ * --update to rewrite the golden files and review their diff like code.
+ *
+ * The mean and p99 wall time of the control stack per step (the tick, or
+ * one traction inner step) are checked too, and a miss fails the scenario.
+ * The budgets are host nanoseconds, sized for a desktop at -O2 with headroom;
+ * they catch a step that suddenly does far more work, not ESP32 cycle counts.
+ * Pass --cost-scale for slower machines or sanitizer builds, and --warn-cost
+ * on a shared, loaded runner to print a WARN line instead of failing.
+ *
+ * @file scenario_main.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <SimRig.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // ---- Budgets ---- //
+    constexpr float kTickMs = static_cast<float>(cfg::tick::LOOP_MS);
+    constexpr float kPressMs = 2.0f * kTickMs;                                               ///< Press → duty rising.
+    constexpr float kLimitMs = 2.0f * kTickMs;                                               ///< Mode / failsafe → cap applied.
+    constexpr float kStaleMs = static_cast<float>(cfg::tick::CMD_STALE_MS) + 2.0f * kTickMs; ///< Stall → stale flag.
+    constexpr float kBrakeAllMs = 1000.0f * 100.0f / 150.0f + kTickMs;                       ///< 100 % → 0 % on the brake ramp.
+    constexpr float kDeadMs = 250.0f;                                                        ///< Reversal dead time.
+    constexpr float kSteerBackMs = 1000.0f * 50.0f / 40.0f + kTickMs;                        ///< Inner wheel 50 → 100 % at the pull-away rate.
+    constexpr uint32_t kMeanNs = 1000;                                                       ///< Mean stack cost per step (fails; warns with --warn-cost).
+    constexpr uint32_t kP99Ns = 3000;                                                        ///< p99 stack cost per step (fails; warns with --warn-cost).
+
+    // ---- Scenario description ---- //
+
+    /// @brief Stimulus → response measurement.
+    struct Probe
+    {
+        const char *name;            ///< What is measured.
+        float from_s;                ///< Stimulus time (scenario clock).
+        bool (*hit)(const SimRig &); ///< Response seen this tick.
+        float budget_ms;             ///< Allowed stimulus → response.
+    };
+
+    /// @brief A quantity that must stay inside [lo, hi] over a window (checked at the end of every tick in it).
+    struct Bound
+    {
+        const char *name;               ///< What is bounded.
+        float from_s;                   ///< Window start (scenario clock).
+        float to_s;                     ///< Window end.
+        float (*value)(const SimRig &); ///< Quantity this tick.
+        float lo;                       ///< Lowest allowed.
+        float hi;                       ///< Highest allowed.
+    };
+
+    /// @brief One scripted drive.
+    struct Scenario
+    {
+        const char *name;                    ///< Golden file stem.
+        void (*setup)(SimRigSpec &);         ///< Rig options (nullptr → defaults).
+        float length_s;                      ///< Duration.
+        void (*inputs)(SimRig &, float t_s); ///< Apply inputs for time t_s (called before every tick).
+        std::vector<Probe> probes;           ///< Latency budgets.
+        std::vector<Bound> bounds{};         ///< Value budgets.
+        uint32_t trace_every{1};             ///< Golden row every this many ticks (long runs).
+    };
+
+    void with_rc(SimRigSpec &spec) noexcept { spec.rc = true; }
+
+    /// @brief RC with no battery sense: duty is exactly what the mode ramp allows.
+    void with_rc_only(SimRigSpec &spec) noexcept
+    {
+        spec.rc = true;
+        spec.battery = false;
+    }
+
+    /// @brief Closed-loop speed on the encoder, with the RC power knob setting the setpoint.
+    void with_speed_loop(SimRigSpec &spec, float mass_kg) noexcept
+    {
+        spec.rc = true;
+        spec.encoder = true;
+        spec.features.closed_loop = true;
+        spec.car.mass_kg = mass_kg;
+    }
+
+    /// @brief Pack at @p soc with @p r_int_ohm internal resistance, power knob on RC.
+    void with_pack(SimRigSpec &spec, float soc, float r_int_ohm) noexcept
+    {
+        spec.rc = true;
+        spec.car.soc = soc;
+        spec.car.r_int_ohm = r_int_ohm;
+    }
+
+    /// @brief Thermal run: encoder for the current proxy, RC for the power knob, logged once a second.
+    void with_thermal(SimRigSpec &spec) noexcept
+    {
+        spec.rc = true;
+        spec.encoder = true;
+    }
+
+    void with_pwm(SimRigSpec &spec) noexcept
+    {
+        spec.rc = true;
+        spec.pwm = true;
+    }
+
+    /// @brief Launch on a surface of friction @p mu, motor-side encoder, traction stage @p on.
+    void with_traction(SimRigSpec &spec, float mu, bool on) noexcept
+    {
+        spec.rc = true;
+        spec.encoder = true;
+        spec.features.traction = on;
+        spec.car.counts_per_rev = 1320.0f; ///< 11 PPR × 4 edges × 30:1 gearbox.
+        spec.car.mu = mu;
+        spec.car.mu_slide = 0.6f * mu;
+    }
+
+    /// @brief Hill-hold @p on, quadrature encoder, normal-mode knob on RC.
+    void with_hill_hold(SimRigSpec &spec, bool on) noexcept
+    {
+        spec.rc = true;
+        spec.encoder = true;
+        spec.features.hill_hold = on;
+    }
+
+    /// @brief Mixer checks: steering on RC, no battery sense, so supply compensation does not rescale the wheels.
+    void with_two_motors(SimRigSpec &spec) noexcept
+    {
+        spec.rc = true;
+        spec.motors = 2;
+        spec.battery = false;
+    }
+    void with_four_motors(SimRigSpec &spec) noexcept
+    {
+        spec.rc = true;
+        spec.motors = 4;
+        spec.battery = false;
+    }
+
+    /// @brief Live RC frame with the mode switch and power knob set.
+    RcSnapshot rc_frame(float mode, float power_pct) noexcept
+    {
+        RcSnapshot f{};
+        f.out[static_cast<size_t>(RC::mode)] = mode;
+        f.out[static_cast<size_t>(RC::power)] = power_pct;
+        f.source = RcSource::Primary;
+        f.link_quality = 100;
+        f.linked = true;
+        return f;
+    }
+
+    /// @brief Frame RcPublisher sends when the link drops.
+    RcSnapshot rc_failsafe() noexcept
+    {
+        RcSnapshot f = rc_frame(0.0f, 0.0f);
+        f.failsafe = true;
+        f.source = RcSource::None;
+        f.link_quality = 0;
+        return f;
+    }
+
+    /// @brief Frame RcPublisher sends from boot when no receiver has ever been heard.
+    RcSnapshot rc_no_receiver() noexcept
+    {
+        RcSnapshot f = rc_failsafe();
+        f.linked = false;
+        return f;
+    }
+
+    bool hold(float t_s, float from_s, float to_s) noexcept { return t_s >= from_s && t_s < to_s; }
+
+    bool driving(const SimRig &rig) noexcept { return rig.state().duty_pct > 0.0f; }
+    bool stopped(const SimRig &rig) noexcept { return rig.state().duty_pct <= 0.0f; }
+    bool mode_capped(const SimRig &rig) noexcept { return (rig.state().limits & MotorStateSnapshot::kLimitMode) != 0; }
+    bool at_toddler_cap(const SimRig &rig) noexcept
+    {
+        return rig.state().duty_pct <= cfg::drivemode::TODDLER_MAX_PCT + 0.5f;
+    }
+    bool stale(const SimRig &rig) noexcept { return (rig.state().limits & MotorStateSnapshot::kLimitStale) != 0; }
+    bool braking(const SimRig &rig) noexcept { return rig.state().phase == MotorStateSnapshot::RampPhase::Braking; }
+    bool dead_time(const SimRig &rig) noexcept { return rig.state().phase == MotorStateSnapshot::RampPhase::Reversing; }
+    bool reversed(const SimRig &rig) noexcept { return rig.state().dir == Dir::CCW; }
+    float speed_mps(const SimRig &rig) noexcept { return rig.car().speed_mps(); }
+    float current_a(const SimRig &rig) noexcept { return fabsf(rig.car().motor_current_a()); }
+    float left_pct(const SimRig &rig) noexcept { return rig.state().wheel_pct[0]; }
+    float right_pct(const SimRig &rig) noexcept { return rig.state().wheel_pct[rig.state().motors - 1]; }
+    float inner_ratio(const SimRig &rig) noexcept { return left_pct(rig) > 0.0f ? right_pct(rig) / left_pct(rig) : 1.0f; }
+    float side_split(const SimRig &rig) noexcept { return fabsf(left_pct(rig) - right_pct(rig)); }
+
+    /// @brief Largest duty difference between motors on the same side (4 motors: 0/1 left, 2/3 right).
+    float pair_split(const SimRig &rig) noexcept
+    {
+        const MotorStateSnapshot st = rig.state();
+        return fmaxf(fabsf(st.wheel_pct[0] - st.wheel_pct[1]), fabsf(st.wheel_pct[2] - st.wheel_pct[3]));
+    }
+
+    float wheel_rpm(const SimRig &rig) noexcept { return rig.car().wheel_rpm(); }
+
+    constexpr float kHoldPct = 60.0f;                                   ///< Power knob for the speed-hold runs.
+    constexpr float kHoldRpm = kHoldPct * cfg::speed::MAX_RPM / 100.0f; ///< Setpoint it gives.
+    constexpr float kHoldRiseMs = 1000.0f * kHoldPct / 40.0f + 1000.0f; ///< Setpoint ramp (normal mode) + 1 s for the car.
+
+    /// @brief Pedal down from 0.5 s, normal mode, power knob at kHoldPct.
+    void hold_inputs(SimRig &rig, float t) noexcept
+    {
+        rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+        rig.set_rc(rc_frame(1.0f, kHoldPct));
+    }
+
+    /// @brief Speed-hold run: reaches 90 % of the setpoint in time, small overshoot, settles within ±5 %.
+    Scenario speed_hold(const char *name, void (*setup)(SimRigSpec &))
+    {
+        return {name, setup, 10.0f, hold_inputs,
+                {{"press -> 90 % speed", 0.5f, [](const SimRig &r) { return wheel_rpm(r) >= 0.9f * kHoldRpm; },
+                  kHoldRiseMs}},
+                {{"peak (rpm)", 0.0f, 10.0f, wheel_rpm, 0.0f, 1.08f * kHoldRpm},
+                 {"settled (rpm)", 6.0f, 10.0f, wheel_rpm, 0.95f * kHoldRpm, 1.05f * kHoldRpm}}};
+    }
+
+    float pack_v(const SimRig &rig) noexcept { return rig.car().battery_v(); }
+    float motor_v(const SimRig &rig) noexcept { return fabsf(rig.car().duty_pct()) * 0.01f * rig.car().battery_v(); }
+    bool low_voltage(const SimRig &rig) noexcept
+    {
+        return (rig.state().limits & MotorStateSnapshot::kLimitLowVoltage) != 0;
+    }
+
+    constexpr float kHoldMotorV = kHoldPct * 0.01f * cfg::battery::NOMINAL_V; ///< Motor voltage kHoldPct asks for.
+
+    float motor_temp(const SimRig &rig) noexcept { return rig.state().motor_temp_c; }
+    float driver_temp(const SimRig &rig) noexcept { return rig.state().driver_temp_c; }
+    float duty_step(const SimRig &rig) noexcept { return fabsf(rig.state().duty_pct - rig.previous().duty_pct); }
+    bool derating(const SimRig &rig) noexcept { return (rig.state().limits & MotorStateSnapshot::kLimitThermal) != 0; }
+
+    constexpr float kClimbDeg = 8.0f;   ///< Thermal run: hill climbed at full power...
+    constexpr float kClimbS = 120.0f;   ///< ...for this long...
+    constexpr float kCruiseS = 60.0f;   ///< ...then this long on the flat at kCruisePct.
+    constexpr float kCruisePct = 30.0f; ///< Power knob on the flat.
+
+    /// @brief Sport mode, pedal down; repeated climb / cruise cycles.
+    void thermal_inputs(SimRig &rig, float t) noexcept
+    {
+        const bool climb = std::fmod(t, kClimbS + kCruiseS) < kClimbS;
+        rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 1e9f));
+        rig.set_rc(rc_frame(2.0f, climb ? 100.0f : kCruisePct));
+        rig.car().set_slope_deg(climb ? kClimbDeg : 0.0f);
+    }
+
+    float carrier_hz(const SimRig &rig) noexcept { return static_cast<float>(rig.state().pwm_hz); }
+    float late_carrier(const SimRig &rig) noexcept { return static_cast<float>(rig.pwm().late); }
+    float carrier_gap_ms(const SimRig &rig) noexcept
+    {
+        return rig.pwm().changes < 2 ? 1e6f : static_cast<float>(rig.pwm().min_gap_us) * 1e-3f;
+    }
+    bool fast_carrier(const SimRig &rig) noexcept { return rig.state().pwm_hz == cfg::motor::PWM_LOW_DUTY_HZ; }
+
+    constexpr float kHighHz = static_cast<float>(cfg::motor::PWM_HIGH_DUTY_HZ);
+    constexpr float kLowHz = static_cast<float>(cfg::motor::PWM_LOW_DUTY_HZ);
+    constexpr float kDwellMs = static_cast<float>(cfg::motor::PWM_MIN_DWELL) * kTickMs;
+
+    /// @brief Sport mode, pedal down; the knob walks the duty through both carrier thresholds, then swings it.
+    void carrier_inputs(SimRig &rig, float t) noexcept
+    {
+        float knob = 100.0f;
+        if (t >= 4.0f && t < 7.0f)
+            knob = 50.0f; ///< Inside the hysteresis band.
+        else if (t >= 7.0f && t < 9.0f)
+            knob = 30.0f;
+        else if (t >= 9.0f)
+            knob = std::fmod(t - 9.0f, 3.0f) < 1.5f ? 100.0f : 30.0f; ///< Swing across both thresholds.
+        rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+        rig.set_rc(rc_frame(2.0f, knob));
+    }
+
+    /// @brief Wheel surface speed over body speed (m/s; > 0 → spinning).
+    float slip_mps(const SimRig &rig) noexcept
+    {
+        const VehicleSim &c = rig.car();
+        return c.wheel_rpm() * 2.0f * static_cast<float>(M_PI) / 60.0f * c.params().wheel_r_m - c.speed_mps();
+    }
+    float traction_cut(const SimRig &rig) noexcept
+    {
+        return (rig.state().limits & MotorStateSnapshot::kLimitTraction) != 0 ? 1.0f : 0.0f;
+    }
+
+    /// @brief Plant slip onset → first traction cut (ms; 0 until both happened).
+    float slip_reaction_ms(const SimRig &rig) noexcept
+    {
+        const SimRig::SlipLog &s = rig.slip();
+        return (s.onset_us == 0 || s.cut_us == 0) ? 0.0f : static_cast<float>(s.cut_us - s.onset_us) * 1e-3f;
+    }
+
+    constexpr float kSlipReactMs = 30.0f; ///< Onset needs ~2 count windows (WINDOW_STEPS × SUBSTEP_MS each).
+
+    /// @brief Sport mode, full power, pedal down from 0.5 s.
+    void launch_inputs(SimRig &rig, float t) noexcept
+    {
+        rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+        rig.set_rc(rc_frame(2.0f, 100.0f));
+    }
+
+    float rollback_m(const SimRig &rig) noexcept { return rig.roll().max_back_m; }
+    float hold_pct(const SimRig &rig) noexcept
+    {
+        return rig.state().phase == MotorStateSnapshot::RampPhase::Holding ? rig.state().duty_pct : 0.0f;
+    }
+    bool holding(const SimRig &rig) noexcept { return rig.state().phase == MotorStateSnapshot::RampPhase::Holding; }
+
+    /// @brief Car first rolling back → drive holding (ms; 0 until both happened).
+    float hold_reaction_ms(const SimRig &rig) noexcept
+    {
+        const SimRig::RollLog &r = rig.roll();
+        return (r.back_us == 0 || r.hold_us == 0) ? 0.0f : static_cast<float>(r.hold_us - r.back_us) * 1e-3f;
+    }
+
+    constexpr float kHoldReactMs = 300.0f;                        ///< ROLL_COUNTS of travel from rest (≈ 3 cm at 20 counts/rev) + a tick.
+    constexpr float kHoldMaxM = 0.10f;                            ///< Rollback allowed before the hold catches the car.
+    constexpr float kHoldCapPct = 1.05f * cfg::hillhold::MAX_PCT; ///< Ceiling, after supply compensation.
+
+    /// @brief Pedal down on the flat, onto a Deg° hill at 2 s, pedal up at 4 s; the ramp-down leaves it at rest.
+    template <int Deg>
+    void hill_inputs(SimRig &rig, float t) noexcept
+    {
+        rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 4.0f));
+        rig.set_rc(rc_frame(1.0f, 100.0f));
+        rig.car().set_slope_deg(t < 2.0f ? 0.0f : static_cast<float>(Deg));
+    }
+
+    /// @brief Hill-hold on a Deg° hill: catches the rollback quickly and within kHoldMaxM, then stays put.
+    template <int Deg>
+    Scenario hill_hold(const char *name)
+    {
+        return {name, [](SimRigSpec &s) { with_hill_hold(s, true); }, 12.0f, hill_inputs<Deg>,
+                {{"release -> holding", 4.0f, holding, 3000.0f}},
+                {{"rolling back -> holding (ms)", 11.9f, 12.0f, hold_reaction_ms, 1.0f, kHoldReactMs},
+                 {"rollback (m)", 0.0f, 12.0f, rollback_m, 0.0f, kHoldMaxM},
+                 {"holding duty (%)", 0.0f, 12.0f, hold_pct, 0.0f, kHoldCapPct},
+                 {"held still (m/s)", 10.0f, 12.0f, speed_mps, -0.01f, 0.01f}}};
+    }
+
+    /// @brief Hill-hold car with an IMU sampling at Hz.
+    template <uint16_t Hz>
+    void with_imu(SimRigSpec &spec) noexcept
+    {
+        with_hill_hold(spec, true);
+        spec.imu_hz = Hz;
+    }
+
+    float imu_pitch(const SimRig &rig) noexcept { return rig.imu().pitch_deg; }
+    float imu_batch(const SimRig &rig) noexcept { return static_cast<float>(rig.imu().batch); }
+    float imu_overflows(const SimRig &rig) noexcept { return static_cast<float>(rig.imu().overflows); }
+    bool imu_valid(const SimRig &rig) noexcept { return rig.imu().valid; }
+
+    /// @brief IMU pitch minus the true slope (°).
+    float pitch_error(const SimRig &rig) noexcept { return rig.imu().pitch_deg - rig.car().params().slope_deg; }
+
+    constexpr float kImuFixMs = 2.0f * static_cast<float>(cfg::imu::PERIOD_MS); ///< First drain + a tick.
+    constexpr float kPitchRestDeg = 0.5f;                                       ///< At rest: noise only.
+    constexpr float kPitchLaunchDeg = 8.0f;                                     ///< Launch / stop: see imu<Hz>.
+    constexpr float kPitchHeldDeg = 1.0f;                                       ///< Held on the hill.
+
+    /**
+     * @brief The IMU on the hill-hold run (hill_inputs<8>) at Hz samples per second.
+     *
+     * Every drain folds Hz × PERIOD_MS samples with no FIFO overflow, and
+     * pitch reads the slope once the car is held on it. While the car speeds
+     * up or slows down the filter reads the acceleration as pitch: a 0.1 g
+     * push moves |a| by only 0.5 %, well inside ACCEL_GATE_G, so the gate
+     * cannot reject it. kPitchLaunchDeg records that error rather than hides it.
+     */
+    template <uint16_t Hz>
+    Scenario imu(const char *name)
+    {
+        constexpr float kBatch = static_cast<float>(Hz * cfg::imu::PERIOD_MS / 1000);
+        return {name, with_imu<Hz>, 12.0f, hill_inputs<8>,
+                {{"boot -> attitude", 0.0f, imu_valid, kImuFixMs}},
+                {{"batch", 0.1f, 12.0f, imu_batch, kBatch, kBatch},
+                 {"overflows", 0.0f, 12.0f, imu_overflows, 0.0f, 0.0f},
+                 {"pitch at rest (deg)", 0.1f, 0.5f, imu_pitch, -kPitchRestDeg, kPitchRestDeg},
+                 {"pitch error (deg)", 0.5f, 9.0f, pitch_error, -kPitchLaunchDeg, kPitchLaunchDeg},
+                 {"pitch held (deg)", 9.0f, 12.0f, imu_pitch, 8.0f - kPitchHeldDeg, 8.0f + kPitchHeldDeg}}};
+    }
+
+    /// @brief Wall 15 m ahead with a ranger on it, guard policy @p on (RC switch up when on).
+    template <bool On>
+    void with_wall(SimRigSpec &spec) noexcept
+    {
+        spec.rc = true;
+        spec.core.obstacle = On;
+        spec.wall_m = 15.0f;
+    }
+
+    float wall_gap_m(const SimRig &rig) noexcept { return rig.wall().min_gap_m; }
+    float wall_cut_events(const SimRig &rig) noexcept { return static_cast<float>(rig.events(Event::ObstacleStop).count); }
+
+    /// @brief Recorded cut: echo → cut delay (ms) the drive stored for EventLogger.
+    float wall_event_ms(const SimRig &rig) noexcept { return rig.events(Event::ObstacleStop).latency_us * 1e-3f; }
+
+    /// @brief Car inside its stopping distance → drive at 0 % (ms; -1 until both happened).
+    float wall_cut_ms(const SimRig &rig) noexcept
+    {
+        const SimRig::WallLog &w = rig.wall();
+        return (w.brake_us == 0 || w.cut_us == 0) ? -1.0f : static_cast<float>(w.cut_us - w.brake_us) * 1e-3f;
+    }
+
+    constexpr float kEchoMs = 2000.0f * cfg::obstacle::MAX_RANGE_M / cfg::obstacle::SOUND_MPS; ///< Longest echo.
+    constexpr float kWallCutMs = cfg::obstacle::PERIOD_MS + kEchoMs + kTickMs;                 ///< Ping + echo + a tick.
+
+    /// @brief Pedal down from 0.5 s in drive mode Mode, obstacle switch on.
+    template <int Mode>
+    void wall_inputs(SimRig &rig, float t) noexcept
+    {
+        rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+        RcSnapshot f = rc_frame(static_cast<float>(Mode), 100.0f);
+        f.out[static_cast<size_t>(RC::obstacle)] = 1.0f;
+        rig.set_rc(f);
+    }
+
+    /// @brief Flat out at a wall: the guard brakes in time and the car stops short of it.
+    template <int Mode>
+    Scenario wall_stop(const char *name)
+    {
+        return {name, with_wall<true>, 12.0f, wall_inputs<Mode>,
+                {{"press -> drive", 0.5f, driving, kPressMs}},
+                {{"brake point -> 0 % (ms)", 11.9f, 12.0f, wall_cut_ms, 0.0f, kWallCutMs},
+                 {"closest (m)", 11.9f, 12.0f, wall_gap_m, 0.5f * cfg::obstacle::STOP_M, cfg::obstacle::SLOW_M},
+                 {"stopped (m/s)", 11.0f, 12.0f, speed_mps, -0.01f, 0.01f},
+                 {"cut events recorded", 11.9f, 12.0f, wall_cut_events, 1.0f, 8.0f}, ///< Creeping on the held pedal re-cuts.
+                 {"recorded echo -> cut (ms)", 11.9f, 12.0f, wall_event_ms, 0.0f, kTickMs}}};
+    }
+
+    /// @brief Autotune policy @p On, encoder for the relay, normal mode on RC.
+    template <bool On>
+    void with_autotune(SimRigSpec &spec) noexcept
+    {
+        spec.rc = true;
+        spec.encoder = true;
+        spec.core.autotune = On;
+    }
+
+    bool tuning(const SimRig &rig) noexcept { return rig.state().phase == MotorStateSnapshot::RampPhase::Tuning; }
+    float tuning_flag(const SimRig &rig) noexcept { return tuning(rig) ? 1.0f : 0.0f; }
+
+    /// @brief The old Horn + Reverse chord from 1 s to 3 s, then the override switch up from 4 s to 6 s.
+    void tune_inputs(SimRig &rig, float t) noexcept
+    {
+        rig.set_button(ButtonIndex::Horn, hold(t, 1.0f, 3.0f));
+        rig.set_button(ButtonIndex::Reverse, hold(t, 1.0f, 3.0f));
+        RcSnapshot f = rc_frame(1.0f, 100.0f);
+        f.out[static_cast<size_t>(RC::override)] = hold(t, 4.0f, 6.0f) ? 1.0f : 0.0f;
+        rig.set_rc(f);
+    }
+
+    /// @brief Closed-loop speed at @p Kg with the autotune switch configured.
+    template <int Kg>
+    void with_tuned_loop(SimRigSpec &spec) noexcept
+    {
+        with_speed_loop(spec, static_cast<float>(Kg));
+        spec.core.autotune = true;
+    }
+
+    float tune_done(const SimRig &rig) noexcept { return static_cast<float>(rig.events(Event::AutotuneDone).count); }
+    float tune_failed(const SimRig &rig) noexcept { return static_cast<float>(rig.events(Event::AutotuneFailed).count); }
+    float tune_ku(const SimRig &rig) noexcept { return rig.events(Event::AutotuneDone).value[0]; }
+    float tune_tu_s(const SimRig &rig) noexcept { return rig.events(Event::AutotuneDone).value[1]; }
+
+    constexpr float kTuneUpS = 1.0f;                                             ///< Override switch up.
+    constexpr float kTunedDriveS = kTuneUpS + cfg::speed::TUNE_TIMEOUT_S + 2.0f; ///< Pedal down on the tuned gains.
+    constexpr float kTunedEndS = kTunedDriveS + 10.0f;                           ///< Run length.
+
+    /// @brief Switch up at kTuneUpS until the tune ends, then pedal down from kTunedDriveS at kHoldPct.
+    void tuned_inputs(SimRig &rig, float t) noexcept
+    {
+        const bool ended = rig.events(Event::AutotuneDone).count + rig.events(Event::AutotuneFailed).count > 0;
+        RcSnapshot f = rc_frame(1.0f, kHoldPct);
+        f.out[static_cast<size_t>(RC::override)] = (t >= kTuneUpS && !ended) ? 1.0f : 0.0f;
+        rig.set_rc(f);
+        rig.set_button(ButtonIndex::Accelerator, hold(t, kTunedDriveS, 99.0f));
+    }
+
+    /// @brief Autotune at one load: converges, Ku/Tu in range, then the tuned loop holds kHoldPct.
+    template <int Kg>
+    Scenario tune_converge(const char *name, float ku_lo, float ku_hi, float tu_lo, float tu_hi)
+    {
+        constexpr float kTuned = kTunedDriveS + kHoldRiseMs * 1e-3f; ///< Setpoint ramp done.
+        return {name, with_tuned_loop<Kg>, kTunedEndS, tuned_inputs,
+                {{"switch up -> tune done", kTuneUpS, [](const SimRig &r) { return tune_done(r) > 0.0f; },
+                  cfg::speed::TUNE_TIMEOUT_S * 1000.0f},
+                 {"pedal -> 90 % speed (tuned)", kTunedDriveS,
+                  [](const SimRig &r) { return wheel_rpm(r) >= 0.9f * kHoldRpm; }, kHoldRiseMs}},
+                {{"tunes done", kTunedDriveS, kTunedEndS, tune_done, 1.0f, 1.0f},
+                 {"tunes failed", 0.0f, kTunedEndS, tune_failed, 0.0f, 0.0f},
+                 {"Ku (%/rpm)", kTunedDriveS, kTunedEndS, tune_ku, ku_lo, ku_hi},
+                 {"Tu (s)", kTunedDriveS, kTunedEndS, tune_tu_s, tu_lo, tu_hi},
+                 {"peak (rpm, tuned)", kTunedDriveS, kTunedEndS, wheel_rpm, 0.0f, 1.08f * kHoldRpm},
+                 {"settled (rpm, tuned)", kTuned + 2.0f, kTunedEndS, wheel_rpm, 0.95f * kHoldRpm, 1.05f * kHoldRpm}},
+                10};
+    }
+
+    /// @brief Pedal down from 0.5 s; RC bus attached, fed no-receiver frames (@p Fed) or nothing at all.
+    template <bool Fed>
+    void no_receiver_inputs(SimRig &rig, float t) noexcept
+    {
+        rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+        if (Fed)
+            rig.set_rc(rc_no_receiver());
+    }
+
+    bool full_duty(const SimRig &rig) noexcept { return rig.state().duty_pct >= 99.5f; }
+    float mode_flag(const SimRig &rig) noexcept { return mode_capped(rig) ? 1.0f : 0.0f; }
+    float mode_events(const SimRig &rig) noexcept { return static_cast<float>(rig.events(Event::DriveMode).count); }
+    float recorded_mode(const SimRig &rig) noexcept { return static_cast<float>(rig.events(Event::DriveMode).code & 0xFFu); }
+    float drive_mode(const SimRig &rig) noexcept { return static_cast<float>(rig.control().drive_mode); }
+
+    constexpr float kNoRcMode = static_cast<float>(cfg::drivemode::NO_RC_MODE);
+    constexpr float kFullMs = 1000.0f * 100.0f / cfg::drivemode::NORMAL_ACCEL_PCT_S + kPressMs; ///< 0 → 100 % in normal.
+
+    /// @brief A receiver that never linked drives like a button-only car: normal mode, no cap.
+    template <bool Fed>
+    Scenario no_receiver(const char *name)
+    {
+        return {name, with_rc_only, 5.0f, no_receiver_inputs<Fed>,
+                {{"press -> full duty", 0.5f, full_duty, kFullMs}},
+                {{"mode cap", 0.0f, 5.0f, mode_flag, 0.0f, 0.0f},
+                 {"drive mode", 0.0f, 5.0f, drive_mode, kNoRcMode, kNoRcMode}}};
+    }
+
+    /// @brief Mixed bits of a tick index (deterministic, no state).
+    uint32_t tick_hash(float t) noexcept
+    {
+        uint32_t x = static_cast<uint32_t>(t * 1000.0f / kTickMs + 0.5f) * 2654435761u;
+        x ^= x >> 15;
+        x *= 2246822519u;
+        return x ^ (x >> 13);
+    }
+
+    /// @brief Pedal down; mode switch and knob move at random most ticks, with a live link that drops 1 tick in 16.
+    void toggle_inputs(SimRig &rig, float t) noexcept
+    {
+        const uint32_t h = tick_hash(t);
+        rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+        if ((h & 15u) == 0u)
+            rig.set_rc(rc_failsafe());
+        else
+            rig.set_rc(rc_frame(static_cast<float>((h >> 4) % 3u), 20.0f + static_cast<float>((h >> 8) % 81u)));
+    }
+
+    /// @brief Duty rise that ends above this tick's cap (%; 0 when not rising).
+    float rise_over_cap(const SimRig &rig) noexcept
+    {
+        const float d = rig.state().duty_pct;
+        return d > rig.previous().duty_pct ? fmaxf(d - rig.control().max_pct, 0.0f) : 0.0f;
+    }
+
+    /// @brief Rise rate beyond this tick's mode rate (%/s; 0 when within it or not rising).
+    float rise_over_rate(const SimRig &rig) noexcept
+    {
+        const float rate = (rig.state().duty_pct - rig.previous().duty_pct) * 1000.0f / kTickMs;
+        return fmaxf(rate - rig.control().accel_pct_s, 0.0f);
+    }
+
+    /// @brief Full throttle, full right lock on the RC stick from 4 s to 6 s, then straight again.
+    void steer_inputs(SimRig &rig, float t) noexcept
+    {
+        rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+        RcSnapshot f = rc_frame(1.0f, 100.0f);
+        f.out[static_cast<size_t>(RC::steering)] = hold(t, 4.0f, 6.0f) ? 100.0f : 0.0f;
+        rig.set_rc(f);
+    }
+
+    /// @brief The suite.
+    std::vector<Scenario> scenarios()
+    {
+        return {
+            {"accel_press", nullptr, 6.0f,
+             [](SimRig &rig, float t) { rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f)); },
+             {{"press -> drive", 0.5f, driving, kPressMs}}},
+
+            {"accel_release", nullptr, 8.0f,
+             [](SimRig &rig, float t) { rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 4.0f)); },
+             {{"press -> drive", 0.5f, driving, kPressMs}, {"release -> 0 %", 4.0f, stopped, 3000.0f}}},
+
+            {"rapid_taps", nullptr, 5.0f,
+             [](SimRig &rig, float t)
+             {
+                 const bool tap = t >= 0.5f && t < 2.9f && std::fmod(t - 0.5f, 0.3f) < 0.15f; ///< 8 taps, 150 ms.
+                 rig.set_button(ButtonIndex::Accelerator, tap);
+             },
+             {{"first tap -> drive", 0.5f, driving, kPressMs}, {"last tap -> 0 %", 2.75f, stopped, 1500.0f}}},
+
+            {"rc_override", with_rc, 8.0f,
+             [](SimRig &rig, float t)
+             {
+                 rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+                 if (t < 4.0f)
+                     rig.set_rc(rc_frame(2.0f, 100.0f)); ///< Sport, full power.
+                 else if (t < 6.0f)
+                     rig.set_rc(rc_frame(0.0f, 100.0f)); ///< Parent flips to toddler.
+                 else
+                     rig.set_rc(rc_frame(1.0f, 50.0f)); ///< Normal, knob at half.
+             },
+             {{"toddler -> cap flag", 4.0f, mode_capped, kLimitMs},
+              {"toddler -> 40 %", 4.0f, at_toddler_cap, 2000.0f}}},
+
+            {"rc_failsafe", with_rc, 7.0f,
+             [](SimRig &rig, float t)
+             {
+                 rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+                 rig.set_rc(t < 4.0f ? rc_frame(2.0f, 100.0f) : rc_failsafe());
+             },
+             {{"failsafe -> cap flag", 4.0f, mode_capped, kLimitMs},
+              {"failsafe -> 40 %", 4.0f, at_toddler_cap, 2000.0f}},
+             {{"mode events recorded", 6.9f, 7.0f, mode_events, 2.0f, 2.0f}, ///< 1 -> 2 at the first frame, 2 -> 0.
+              {"recorded mode", 6.9f, 7.0f, recorded_mode, 0.0f, 0.0f}}},
+
+            // A receiver that never linked is no receiver: normal mode, not the failsafe cap, fed or silent.
+            no_receiver<true>("rc_no_receiver"),
+            no_receiver<false>("rc_never_fed"),
+
+            // The mode switch and knob thrashed every tick, with link drops: never above the cap, never too fast.
+            {"rc_toggle", with_rc_only, 20.0f, toggle_inputs,
+             {{"press -> drive", 0.5f, driving, kPressMs}},
+             {{"rise over cap (%)", 0.0f, 20.0f, rise_over_cap, 0.0f, 0.0f},
+              {"rise over rate (%/s)", 0.0f, 20.0f, rise_over_rate, 0.0f, 0.5f}}},
+
+            {"stale_input", nullptr, 7.0f,
+             [](SimRig &rig, float t)
+             {
+                 rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+                 rig.set_input_stalled(hold(t, 3.0f, 5.0f)); ///< Input task hangs with the pedal down.
+             },
+             {{"stall -> stale flag", 3.0f, stale, kStaleMs}, {"stall -> 0 %", 3.0f, stopped, 3000.0f}}},
+
+            // Reverse selected at full speed: brake to 0 %, hold the dead time, flip, drive back.
+            {"reverse_underway", nullptr, 9.0f,
+             [](SimRig &rig, float t)
+             {
+                 rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+                 rig.set_button(ButtonIndex::Reverse, hold(t, 4.0f, 99.0f));
+             },
+             {{"reverse -> braking", 4.0f, braking, kPressMs},
+              {"reverse -> dead time", 4.0f, dead_time, kBrakeAllMs + kPressMs},
+              {"reverse -> flipped", 4.0f, reversed, kBrakeAllMs + kDeadMs + kPressMs},
+              {"reverse -> driving back", 4.0f, [](const SimRig &r) { return reversed(r) && driving(r); },
+               kBrakeAllMs + kDeadMs + 2.0f * kPressMs},
+              {"reverse -> car at rest", 4.0f, [](const SimRig &r) { return speed_mps(r) <= 0.0f; }, 2000.0f}},
+             {{"no flip before dead time", 4.0f, 4.0f + (kBrakeAllMs + kDeadMs - kTickMs) * 1e-3f,
+               [](const SimRig &r) { return reversed(r) ? 1.0f : 0.0f; }, 0.0f, 0.0f},
+              {"0 % in dead time", 4.0f, 9.0f, [](const SimRig &r) { return dead_time(r) ? r.state().duty_pct : 0.0f; },
+               0.0f, 0.0f},
+              {"motor current (A)", 0.0f, 9.0f, current_a, 0.0f, cfg::thermal::STALL_A},
+              {"backing up (m/s)", 8.5f, 9.0f, speed_mps, -3.5f, -2.5f}}},
+
+            // Reverse tapped and released before the car reached 0 %: back to driving forward, no flip.
+            {"reverse_withdrawn", nullptr, 7.0f,
+             [](SimRig &rig, float t)
+             {
+                 rig.set_button(ButtonIndex::Accelerator, hold(t, 0.5f, 99.0f));
+                 rig.set_button(ButtonIndex::Reverse, hold(t, 4.0f, 4.3f));
+             },
+             {{"reverse -> braking", 4.0f, braking, kPressMs},
+              {"withdrawn -> accelerating", 4.3f,
+               [](const SimRig &r) { return r.state().phase == MotorStateSnapshot::RampPhase::Accelerating; },
+               kPressMs}},
+             {{"never flipped", 0.0f, 7.0f, [](const SimRig &r) { return reversed(r) ? 1.0f : 0.0f; }, 0.0f, 0.0f},
+              {"still rolling forward", 4.0f, 7.0f, speed_mps, 0.5f, 99.0f}}},
+
+            // Differential mix, left/right motor: the outer wheel keeps throttle, the inner one drops to half.
+            {"mix_steer", with_two_motors, 9.0f, steer_inputs,
+             {{"steer -> inner slowing", 4.0f, [](const SimRig &r) { return right_pct(r) < left_pct(r); }, kPressMs},
+              {"straight -> matched", 6.0f, [](const SimRig &r) { return side_split(r) <= 0.0f; }, kSteerBackMs}},
+             {{"matched when straight", 0.0f, 4.0f, side_split, 0.0f, 0.0f},
+              {"outer keeps throttle", 4.0f, 6.0f, left_pct, 99.9f, 100.0f},
+              {"inner / outer", 5.5f, 6.0f, inner_ratio, 0.49f, 0.51f}}},
+
+            // Same mix on two motors per side, written from one step: each side's pair stays in lockstep.
+            {"mix_steer_4", with_four_motors, 9.0f, steer_inputs,
+             {{"steer -> inner slowing", 4.0f, [](const SimRig &r) { return right_pct(r) < left_pct(r); }, kPressMs}},
+             {{"pairs in lockstep", 0.0f, 9.0f, pair_split, 0.0f, 0.0f},
+              {"inner / outer", 5.5f, 6.0f, inner_ratio, 0.49f, 0.51f}}},
+
+            // Supply compensation: the same knob gives the same motor voltage on a fresh or a sagging pack.
+            {"battery_fresh", [](SimRigSpec &s) { with_pack(s, 1.0f, 0.06f); }, 10.0f, hold_inputs,
+             {{"press -> drive", 0.5f, driving, kPressMs}},
+             {{"motor volts", 6.0f, 10.0f, motor_v, 0.97f * kHoldMotorV, 1.03f * kHoldMotorV},
+              {"pack volts", 6.0f, 10.0f, pack_v, cfg::battery::NOMINAL_V, 13.0f}}},
+
+            {"battery_sagging", [](SimRigSpec &s) { with_pack(s, 0.3f, 0.12f); }, 10.0f, hold_inputs,
+             {{"press -> drive", 0.5f, driving, kPressMs}},
+             {{"motor volts", 6.0f, 10.0f, motor_v, 0.97f * kHoldMotorV, 1.03f * kHoldMotorV},
+              {"pack volts", 6.0f, 10.0f, pack_v, cfg::battery::LIMIT_START_V, cfg::battery::NOMINAL_V}}},
+
+            // Flat pack: the launch sags it into the low-voltage cap; cruising it recovers and compensation holds.
+            {"battery_flat", [](SimRigSpec &s) { with_pack(s, 0.0f, 0.15f); }, 10.0f, hold_inputs,
+             {{"launch sag -> LV cap", 0.5f, low_voltage, 1000.0f}},
+             {{"motor volts", 0.0f, 10.0f, motor_v, 0.0f, 1.03f * kHoldMotorV},
+              {"recovered (motor V)", 9.5f, 10.0f, motor_v, 0.97f * kHoldMotorV, 1.03f * kHoldMotorV}}},
+
+            // Carrier by region: 20 kHz at crawl, 10 kHz above PWM_UP_PCT, hysteresis, dwell, frequency before duty.
+            {"pwm_carrier", with_pwm, 15.0f, carrier_inputs,
+             {{"knob 30 -> 20 kHz", 7.0f, fast_carrier, 1000.0f * 5.0f / 40.0f + 2.0f * kTickMs}},
+             {{"crawl (Hz)", 0.0f, 1.0f, carrier_hz, kLowHz, kLowHz},
+              {"full power (Hz)", 2.5f, 4.0f, carrier_hz, kHighHz, kHighHz},
+              {"hysteresis band (Hz)", 5.5f, 7.0f, carrier_hz, kHighHz, kHighHz},
+              {"back at crawl (Hz)", 7.5f, 9.0f, carrier_hz, kLowHz, kLowHz},
+              {"carrier changes", 14.9f, 15.0f, [](const SimRig &r) { return static_cast<float>(r.pwm().changes); },
+               6.0f, 6.0f},
+              {"change gap (ms)", 0.0f, 15.0f, carrier_gap_ms, kDwellMs, 1e6f},
+              {"written after duty", 0.0f, 15.0f, late_carrier, 0.0f, 0.0f}}},
+
+            // Full-power launch on wet grass: the wheel spins up for ~2 s without traction control...
+            {"traction_off", [](SimRigSpec &s) { with_traction(s, 0.3f, false); }, 6.0f, launch_inputs,
+             {{"press -> drive", 0.5f, driving, kPressMs}},
+             {{"wheel spinning (m/s)", 1.8f, 2.4f, slip_mps, 1.0f, 99.0f}}},
+
+            // ...and is held just above the car with it, cut between ticks, without giving up the launch.
+            {"traction_wet_grass", [](SimRigSpec &s) { with_traction(s, 0.3f, true); }, 6.0f, launch_inputs,
+             {{"press -> drive", 0.5f, driving, kPressMs}},
+             {{"slip (m/s)", 0.0f, 6.0f, slip_mps, -0.05f, 0.25f},
+              {"slip -> cut (ms)", 5.9f, 6.0f, slip_reaction_ms, 1.0f, kSlipReactMs},
+              {"launch speed (m/s)", 5.5f, 6.0f, speed_mps, 3.0f, 99.0f}}},
+
+            // Dry grip: the stage never cuts.
+            {"traction_dry", [](SimRigSpec &s) { with_traction(s, 0.6f, true); }, 6.0f, launch_inputs,
+             {{"press -> drive", 0.5f, driving, kPressMs}},
+             {{"traction cut", 0.0f, 6.0f, traction_cut, 0.0f, 0.0f},
+              {"slip (m/s)", 0.0f, 6.0f, slip_mps, -0.05f, 0.05f}}},
+
+            // Pedal released on a hill: without hill-hold the car runs back down it...
+            {"hill_hold_off", [](SimRigSpec &s) { with_hill_hold(s, false); }, 12.0f, hill_inputs<8>,
+             {{"press -> drive", 0.5f, driving, kPressMs}},
+             {{"rollback (m)", 11.9f, 12.0f, rollback_m, 1.0f, 99.0f}}},
+
+            // ...with it the car is caught within a few centimetres and held on the least duty that does it.
+            hill_hold<5>("hill_hold_5deg"),
+            hill_hold<8>("hill_hold_8deg"),
+            hill_hold<12>("hill_hold_12deg"),
+
+            // The same run with an IMU: batching, no FIFO loss and a slope reading at each sample rate.
+            imu<100>("imu_100hz"),
+            imu<400>("imu_400hz"),
+            imu<1000>("imu_1000hz"),
+
+            // Flat out at a wall: without the guard the car hits it...
+            {"obstacle_off", with_wall<false>, 12.0f, wall_inputs<2>,
+             {{"press -> drive", 0.5f, driving, kPressMs}},
+             {{"closest (m)", 11.9f, 12.0f, wall_gap_m, -99.0f, 0.0f}}},
+
+            // ...with it the car brakes on its closing speed and stops short, in normal and sport.
+            wall_stop<1>("obstacle_normal"),
+            wall_stop<2>("obstacle_sport"),
+
+            // Autotune is off unless configured, and then only the parent's switch starts it.
+            {"autotune_off", with_autotune<false>, 8.0f, tune_inputs,
+             {},
+             {{"tuning", 0.0f, 8.0f, tuning_flag, 0.0f, 0.0f}}},
+            {"autotune_rc", with_autotune<true>, 8.0f, tune_inputs,
+             {{"switch up -> tuning", 4.0f, tuning, kPressMs}},
+             {{"chord: tuning", 0.0f, 4.0f, tuning_flag, 0.0f, 0.0f},
+              {"released: tuning", 6.0f + kLimitMs * 1e-3f, 8.0f, tuning_flag, 0.0f, 0.0f}}},
+
+            // Ten minutes of climb / cruise cycles: the I²t estimate derates smoothly and keeps both below max.
+            {"thermal_10min", with_thermal, 600.0f, thermal_inputs,
+             {{"climb -> derate", 0.5f, derating, 120000.0f}},
+             {{"motor (C)", 0.0f, 600.0f, motor_temp, 0.0f, cfg::thermal::MOTOR_MAX_C},
+              {"driver (C)", 0.0f, 600.0f, driver_temp, 0.0f, cfg::thermal::DRIVER_MAX_C},
+              {"derated step (%/tick)", 100.0f, 120.0f, duty_step, 0.0f, 0.1f},
+              {"derated step (%/tick)", 250.0f, 300.0f, duty_step, 0.0f, 0.1f},
+              {"derated step (%/tick)", 420.0f, 480.0f, duty_step, 0.0f, 0.1f},
+              {"still climbing (rpm)", 470.0f, 480.0f, wheel_rpm, 100.0f, 999.0f}},
+             100},
+
+            // Closed-loop speed holds the setpoint whatever the load (car + child).
+            speed_hold("speed_hold_30kg", [](SimRigSpec &s) { with_speed_loop(s, 30.0f); }),
+            speed_hold("speed_hold_45kg", [](SimRigSpec &s) { with_speed_loop(s, 45.0f); }),
+            speed_hold("speed_hold_60kg", [](SimRigSpec &s) { with_speed_loop(s, 60.0f); }),
+
+            // The relay autotune converges at every load, and the gains it finds hold the setpoint.
+            // A heavier car swings less on the same relay, so Ku rises with the load.
+            tune_converge<30>("autotune_30kg", 1.2f, 2.0f, 0.6f, 1.0f),
+            tune_converge<45>("autotune_45kg", 1.45f, 2.4f, 0.6f, 1.0f),
+            tune_converge<60>("autotune_60kg", 1.6f, 2.7f, 0.6f, 1.0f),
+        };
+    }
+
+    // ---- Trace ---- //
+
+    /// @brief One tick of motor command.
+    struct Row
+    {
+        float t_s{0.0f};      ///< Scenario time at the end of the tick.
+        float duty_pct{0.0f}; ///< Duty written.
+        unsigned dir{0};      ///< Direction.
+        unsigned phase{0};    ///< Ramp phase.
+        unsigned limits{0};   ///< Limiter bits.
+    };
+
+    constexpr const char *kHeader = "t_s,duty_pct,dir,phase,limits";
+
+    bool load(const std::string &path, std::vector<Row> &rows)
+    {
+        FILE *f = fopen(path.c_str(), "r");
+        if (f == nullptr)
+            return false;
+        char line[128];
+        bool ok = fgets(line, sizeof(line), f) != nullptr && strncmp(line, kHeader, strlen(kHeader)) == 0;
+        Row r{};
+        while (ok && fscanf(f, "%f,%f,%u,%u,%u", &r.t_s, &r.duty_pct, &r.dir, &r.phase, &r.limits) == 5)
+            rows.push_back(r);
+        fclose(f);
+        return ok;
+    }
+
+    bool save(const std::string &path, const std::vector<Row> &rows)
+    {
+        FILE *f = fopen(path.c_str(), "w");
+        if (f == nullptr)
+            return false;
+        fprintf(f, "%s\n", kHeader);
+        for (const Row &r : rows)
+            fprintf(f, "%.2f,%.3f,%u,%u,%u\n", r.t_s, r.duty_pct, r.dir, r.phase, r.limits);
+        return fclose(f) == 0;
+    }
+
+    // ---- Runner ---- //
+
+    struct Options
+    {
+        std::string golden{"tools/sim/golden"}; ///< Golden trace directory.
+        const char *only{nullptr};              ///< Run just this scenario.
+        bool update{false};                     ///< Rewrite golden files instead of comparing.
+        float tol_pct{0.05f};                   ///< Duty tolerance.
+        float cost_scale{1.0f};                 ///< Multiplier on the cost budgets.
+        bool warn_cost{false};                  ///< Only warn (not fail) on a cost budget miss.
+        bool verbose{false};                    ///< Print every probe and cost, not just failures.
+    };
+
+    /// @brief Run one scenario and check it; returns true on pass.
+    bool run(const Scenario &sc, const Options &opt)
+    {
+        SimRigSpec spec{};
+        if (sc.setup != nullptr)
+            sc.setup(spec);
+        SimRig rig(spec);
+
+        std::vector<Row> trace;
+        std::vector<uint32_t> cost;
+        std::vector<float> seen_ms(sc.probes.size(), -1.0f);
+        std::vector<float> lo(sc.bounds.size(), INFINITY);
+        std::vector<float> hi(sc.bounds.size(), -INFINITY);
+        const uint32_t ticks = static_cast<uint32_t>(sc.length_s * 1000.0f / kTickMs + 0.5f);
+        for (uint32_t k = 0; k < ticks; ++k)
+        {
+            const float t = static_cast<float>(k) * kTickMs * 1e-3f; ///< Inputs apply from the tick's start.
+            sc.inputs(rig, t);
+            rig.tick();
+            const float end_s = static_cast<float>(k + 1) * kTickMs * 1e-3f;
+
+            const MotorStateSnapshot st = rig.state();
+            if ((k + 1) % sc.trace_every == 0)
+                trace.push_back({end_s, st.duty_pct, static_cast<unsigned>(st.dir), static_cast<unsigned>(st.phase),
+                                 static_cast<unsigned>(st.limits)});
+            cost.push_back(rig.stack_ns() / rig.stack_steps()); ///< Traction ticks run ten steps, not one.
+
+            for (size_t p = 0; p < sc.probes.size(); ++p)
+                if (seen_ms[p] < 0.0f && t + 1e-4f >= sc.probes[p].from_s && sc.probes[p].hit(rig))
+                    seen_ms[p] = (end_s - sc.probes[p].from_s) * 1000.0f;
+
+            for (size_t b = 0; b < sc.bounds.size(); ++b)
+            {
+                const Bound &bd = sc.bounds[b];
+                if (t + 1e-4f >= bd.from_s && t + 1e-4f < bd.to_s)
+                {
+                    const float v = bd.value(rig);
+                    lo[b] = fminf(lo[b], v);
+                    hi[b] = fmaxf(hi[b], v);
+                }
+            }
+        }
+
+        bool pass = true;
+        const std::string path = opt.golden + "/" + sc.name + ".csv";
+
+        // Trace against golden.
+        if (opt.update)
+        {
+            if (!save(path, trace))
+            {
+                printf("  %s: cannot write %s\n", sc.name, path.c_str());
+                return false;
+            }
+        }
+        else
+        {
+            std::vector<Row> gold;
+            if (!load(path, gold))
+            {
+                printf("  %s: no golden trace at %s (run with --update)\n", sc.name, path.c_str());
+                pass = false;
+            }
+            else if (gold.size() != trace.size())
+            {
+                printf("  %s: trace has %zu rows, golden %zu\n", sc.name, trace.size(), gold.size());
+                pass = false;
+            }
+            else
+            {
+                for (size_t i = 0; i < trace.size(); ++i)
+                {
+                    const Row &a = trace[i];
+                    const Row &g = gold[i];
+                    if (fabsf(a.duty_pct - g.duty_pct) > opt.tol_pct || a.dir != g.dir || a.phase != g.phase ||
+                        a.limits != g.limits)
+                    {
+                        printf("  %s: diverges at t=%.2f s: duty %.3f/%.3f dir %u/%u phase %u/%u limits %u/%u "
+                               "(got/golden)\n",
+                               sc.name, a.t_s, a.duty_pct, g.duty_pct, a.dir, g.dir, a.phase, g.phase, a.limits,
+                               g.limits);
+                        pass = false;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Latency probes.
+        for (size_t p = 0; p < sc.probes.size(); ++p)
+        {
+            const Probe &pr = sc.probes[p];
+            const bool ok = seen_ms[p] >= 0.0f && seen_ms[p] <= pr.budget_ms;
+            if (!ok || opt.verbose)
+            {
+                if (seen_ms[p] < 0.0f)
+                    printf("  %s: %-22s never (budget %.0f ms)\n", sc.name, pr.name, pr.budget_ms);
+                else
+                    printf("  %s: %-22s %7.1f ms (budget %.0f ms)%s\n", sc.name, pr.name, seen_ms[p], pr.budget_ms,
+                           ok ? "" : "  OVER");
+            }
+            pass = pass && ok;
+        }
+
+        // Value budgets.
+        for (size_t b = 0; b < sc.bounds.size(); ++b)
+        {
+            const Bound &bd = sc.bounds[b];
+            const bool ok = lo[b] <= hi[b] && lo[b] >= bd.lo && hi[b] <= bd.hi;
+            if (!ok || opt.verbose)
+                printf("  %s: %-22s %.3g .. %.3g (allowed %.3g .. %.3g, %.1f-%.1f s)%s\n", sc.name, bd.name, lo[b],
+                       hi[b], bd.lo, bd.hi, bd.from_s, bd.to_s, ok ? "" : "  OUT");
+            pass = pass && ok;
+        }
+
+        // Control stack cost.
+        uint64_t sum = 0;
+        for (uint32_t c : cost)
+            sum += c;
+        const uint32_t mean = static_cast<uint32_t>(sum / cost.size());
+        std::sort(cost.begin(), cost.end());
+        const uint32_t p99 = cost[(cost.size() * 99) / 100];
+        const uint32_t max = cost.back();
+        const bool cost_ok = static_cast<float>(mean) <= kMeanNs * opt.cost_scale &&
+                             static_cast<float>(p99) <= kP99Ns * opt.cost_scale;
+        if (!cost_ok || opt.verbose)
+            printf("  %s: stack per step mean %u ns, p99 %u ns, max %u ns (budget %.0f / %.0f ns)%s\n", sc.name, mean,
+                   p99, max, kMeanNs * opt.cost_scale, kP99Ns * opt.cost_scale,
+                   cost_ok ? "" : (opt.warn_cost ? "  WARN" : "  OVER"));
+        if (rig.imu_ns() > 0 && opt.verbose)
+            printf("  %s: ImuService %.1f us per simulated s (host)\n", sc.name,
+                   static_cast<double>(rig.imu_ns()) * 1e-3 / static_cast<double>(sc.length_s));
+        return pass && (cost_ok || opt.warn_cost);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options opt{};
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--golden") && i + 1 < argc)
+            opt.golden = argv[++i];
+        else if (!strcmp(argv[i], "--only") && i + 1 < argc)
+            opt.only = argv[++i];
+        else if (!strcmp(argv[i], "--update"))
+            opt.update = true;
+        else if (!strcmp(argv[i], "--tol") && i + 1 < argc)
+            opt.tol_pct = static_cast<float>(atof(argv[++i]));
+        else if (!strcmp(argv[i], "--cost-scale") && i + 1 < argc)
+            opt.cost_scale = static_cast<float>(atof(argv[++i]));
+        else if (!strcmp(argv[i], "--warn-cost"))
+            opt.warn_cost = true;
+        else if (!strcmp(argv[i], "--verbose"))
+            opt.verbose = true;
+        else
+        {
+            fprintf(stderr,
+                    "usage: %s [--golden DIR] [--only NAME] [--update] [--tol PCT] [--cost-scale X] [--warn-cost] "
+                    "[--verbose]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    int failed = 0;
+    int ran = 0;
+    for (const Scenario &sc : scenarios())
+    {
+        if (opt.only != nullptr && strcmp(opt.only, sc.name) != 0)
+            continue;
+        const bool ok = run(sc, opt);
+        printf("%s %s\n", ok ? "PASS" : "FAIL", sc.name);
+        failed += ok ? 0 : 1;
+        ++ran;
+    }
+    if (ran == 0)
+    {
+        fprintf(stderr, "no scenario named %s\n", opt.only);
+        return 2;
+    }
+    printf("%d/%d scenarios passed%s\n", ran - failed, ran, opt.update ? " (golden traces rewritten)" : "");
+    return failed;
+}
@@ -0,0 +1,165 @@
+/**
+ * MIT License
+ *
+ * @brief Host vehicle simulation: drive scenario and real-time factor.
+ *
+ * Build from the repository root (no Arduino/ESP-IDF needed):
+ *
+ *   g++ -O2 -std=gnu++17 -Itools/sim/host -Itools/sim -Isrc/config -Isrc/include -Isrc/lib -Isrc/utils \
+ *       tools/sim/sim_main.cpp tools/sim/SimRig.cpp tools/sim/host/SimHost.cpp \
+ *       src/lib/ControlCore/ControlCore.cpp src/lib/PowerDriveHandler/PowerDriveHandler.cpp \
+ *       src/lib/ImuService/ImuService.cpp src/lib/ImuSources/ImuSources.cpp \
+ *       src/lib/GainStore/GainStore.cpp tools/sim/VehicleSim.cpp -o vehicle_sim
+ *
+ * Usage: vehicle_sim [--csv] [--log] [--slope DEG] [--soc 0..1] [--bench SECONDS] [--trace FILE]
+ *
+ * --trace needs -DTRACING=true on the build line: the drive scenario's work
+ * spans and bus events are captured exactly as on the car (until the buffer
+ * fills) and written in the serial dump format for tools/trace/trace_to_perfetto.
+ *
+ * @file sim_main.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <SimRig.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+    /// @brief One CSV row per tick.
+    void csv_row(const SimRig &rig)
+    {
+        const VehicleSim &car = rig.car();
+        const MotorStateSnapshot st = rig.state();
+        printf("%.3f,%.2f,%.1f,%.3f,%.2f,%.2f,%.2f,%u,%u,%d\n", rig.time_s(), st.duty_pct, car.wheel_rpm(),
+               car.speed_mps(), car.motor_current_a(), car.battery_v(), car.distance_m(),
+               static_cast<unsigned>(st.phase), static_cast<unsigned>(st.limits), car.slipping() ? 1 : 0);
+    }
+
+    /// @brief Launch, cruise, release; then the same on the slope.
+    void scenario(SimRig &rig, float slope_deg, bool csv)
+    {
+        struct Step
+        {
+            float at_s;  ///< Start time.
+            bool accel;  ///< Accelerator held.
+            float slope; ///< Slope (°).
+        };
+        const Step plan[] = {{0.0f, false, 0.0f}, {1.0f, true, 0.0f}, {9.0f, false, 0.0f},
+                             {14.0f, false, slope_deg}, {15.0f, true, slope_deg}, {21.0f, false, slope_deg}};
+        const float end_s = 26.0f;
+
+        float peak_a = 0.0f;
+        float top_mps = 0.0f;
+        float t_to_2mps = -1.0f;
+        float min_v = 99.0f;
+        size_t next = 0;
+        while (rig.time_s() < end_s)
+        {
+            while (next < sizeof(plan) / sizeof(plan[0]) && rig.time_s() >= plan[next].at_s)
+            {
+                rig.set_button(ButtonIndex::Accelerator, plan[next].accel);
+                rig.car().set_slope_deg(plan[next].slope);
+                ++next;
+            }
+            rig.tick();
+            const VehicleSim &car = rig.car();
+            peak_a = fmaxf(peak_a, fabsf(car.battery_current_a()));
+            top_mps = fmaxf(top_mps, car.speed_mps());
+            min_v = fminf(min_v, car.battery_v());
+            if (t_to_2mps < 0.0f && car.speed_mps() >= 2.0f)
+                t_to_2mps = rig.time_s() - 1.0f;
+            if (csv)
+                csv_row(rig);
+        }
+
+        if (!csv)
+            printf("top %.2f m/s (%.0f wheel RPM)  0-2 m/s %.2f s  peak pack %.1f A  min pack %.2f V  "
+                   "distance %.1f m  soc %.4f\n",
+                   top_mps, top_mps / rig.car().params().wheel_r_m * 9.5493f, t_to_2mps, peak_a, min_v,
+                   rig.car().distance_m(), rig.car().soc());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bool csv = false;
+    float slope = 8.0f;
+    float bench_s = 0.0f;
+    const char *trace_path = nullptr;
+    SimRigSpec spec{};
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--csv"))
+            csv = true;
+        else if (!strcmp(argv[i], "--log"))
+            simhost::set_echo(true);
+        else if (!strcmp(argv[i], "--slope") && i + 1 < argc)
+            slope = static_cast<float>(atof(argv[++i]));
+        else if (!strcmp(argv[i], "--soc") && i + 1 < argc)
+            spec.car.soc = static_cast<float>(atof(argv[++i]));
+        else if (!strcmp(argv[i], "--bench") && i + 1 < argc)
+            bench_s = static_cast<float>(atof(argv[++i]));
+        else if (!strcmp(argv[i], "--trace") && i + 1 < argc)
+            trace_path = argv[++i];
+        else
+        {
+            fprintf(stderr, "usage: %s [--csv] [--log] [--slope DEG] [--soc 0..1] [--bench SECONDS] [--trace FILE]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    if (bench_s > 0.0f)
+    {
+        // Stop-go cycles for bench_s of simulated time, timed on the wall clock.
+        SimRig rig(spec);
+        const auto t0 = std::chrono::steady_clock::now();
+        uint64_t ticks = 0;
+        while (rig.time_s() < bench_s)
+        {
+            rig.set_button(ButtonIndex::Accelerator, (ticks / 500) % 2 == 0); ///< 5 s on, 5 s off.
+            rig.tick();
+            ++ticks;
+        }
+        const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        printf("%.0f s simulated in %.3f s wall: %.0fx real time (%.2f us per tick)\n", bench_s, wall,
+               bench_s / wall, wall * 1e6 / static_cast<double>(ticks));
+        return 0;
+    }
+
+    if (trace_path != nullptr && !cfg::trace::ENABLED)
+    {
+        fprintf(stderr, "--trace: rebuild with -DTRACING=true\n");
+        return 2;
+    }
+
+    if (csv)
+        printf("t_s,duty_pct,wheel_rpm,speed_mps,motor_a,pack_v,distance_m,phase,limits,slip\n");
+    SimRig rig(spec);
+    if (trace_path != nullptr)
+        trace::recorder.start();
+    scenario(rig, slope, csv);
+
+    if (trace_path != nullptr)
+    {
+        trace::recorder.stop();
+        FILE *f = fopen(trace_path, "wb");
+        if (f == nullptr)
+        {
+            fprintf(stderr, "--trace: cannot write %s\n", trace_path);
+            return 1;
+        }
+        trace::recorder.dump([f](const uint8_t *p, size_t n) { fwrite(p, 1, n, f); });
+        fclose(f);
+        fprintf(stderr, "trace: %zu events (%u dropped) -> %s\n", trace::recorder.count(), trace::recorder.dropped(),
+                trace_path);
+    }
+    return 0;
+}
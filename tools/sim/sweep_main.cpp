@@ -0,0 +1,422 @@
+/**
+ * MIT License
+ *
+ * @brief Monte Carlo tuning sweeps: randomized drives over the host simulator, all cores.
+ *
+ * Build from the repository root:
+ *
+ *   g++ -O2 -std=gnu++17 -pthread -Itools/sim/host -Itools/sim -Isrc/config -Isrc/include -Isrc/lib -Isrc/utils \
+ *       tools/sim/sweep_main.cpp tools/sim/SimRig.cpp tools/sim/host/SimHost.cpp \
+ *       src/lib/ControlCore/ControlCore.cpp src/lib/PowerDriveHandler/PowerDriveHandler.cpp \
+ *       src/lib/ImuService/ImuService.cpp src/lib/ImuSources/ImuSources.cpp \
+ *       src/lib/GainStore/GainStore.cpp tools/sim/VehicleSim.cpp -o vehicle_sweep
+ *
+ * Usage: vehicle_sweep [--scenarios N] [--threads T] [--seed S] [--ramps 20,40,80] [--falls 40,80]
+ *                      [--debounce 0,20,50] [--deadband 0,8,16] [--scaling]
+ *
+ * Every candidate (rise rate × fall rate × debounce window × RC deadband)
+ * drives the same N randomized scenarios (common random numbers, so
+ * differences are the candidate, not the draw). A scenario fixes battery
+ * charge, slope, driver mass, the accelerator pattern (one hold, or taps then
+ * a hold), contact noise (bounce at every edge, plus short EMI glitches) and
+ * the parent's steering stick (trim offset, receiver jitter and a few gentle
+ * intended turns). Each simulation is seeded from its index alone, so results
+ * are identical for any thread count.
+ *
+ * The ramp and fall candidates are the rise and release rates
+ * PowerDriveHandler applies (they ride the accel_pct_s / decel_pct_s fields
+ * of ControlSnapshot). Debounce is modelled as the button library does it at
+ * the StateManager cadence: a level is accepted once it has been sampled
+ * unchanged for the window. The steering stick goes through the publisher's
+ * own path, the axis LUT with the candidate deadband then the stick filter,
+ * onto a left/right pair of motors, so jitter that leaks through slows the
+ * inner wheel. steer_err is the RMS gap between the steering applied and the
+ * turn intended: jitter leaks in with a narrow deadband, small turns are lost
+ * in a wide one.
+ *
+ * --scaling reruns the batch at 1, 2, 4, ... threads up to --threads and
+ * checks that every count up to the core count keeps at least
+ * kMinEfficiency of linear speed-up; the exit status is the number of counts
+ * below it.
+ *
+ * @file sweep_main.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <SimRig.h>
+#include <WorkPool.h>
+#include <RcFilter.h>
+#include <RcLut.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr float kDriveS = 12.0f; ///< Simulated length of one scenario.
+    constexpr uint32_t kMs = static_cast<uint32_t>(kDriveS * 1000.0f);
+    constexpr float kMovingMps = 0.25f;      ///< "Car responded" speed.
+    constexpr uint32_t kJerkWindowTicks = 5; ///< Acceleration averaged over this many ticks.
+    constexpr float kUsPerPct = 5.0f;        ///< Steering stick: ±500 µs → ±100 %.
+    constexpr double kMinEfficiency = 0.8;   ///< --scaling: sims/s per thread vs 1 thread.
+
+    /// @brief One candidate setting.
+    struct Candidate
+    {
+        float ramp_pct_s{40.0f}; ///< Rise rate (%/s).
+        float fall_pct_s{40.0f}; ///< Release rate (%/s).
+        uint32_t debounce_ms{0}; ///< Accept a level after this long unchanged.
+        int16_t deadband_us{8};  ///< Steering deadband (± µs around centre).
+    };
+
+    /// @brief One drive's outcome.
+    struct Result
+    {
+        float peak_a{0.0f};      ///< Peak pack current (A).
+        float peak_jerk{0.0f};   ///< Peak |jerk| (m/s³), window-averaged.
+        float response_s{-1.0f}; ///< First press → kMovingMps (−1 → never).
+        int32_t spurious{0};     ///< Accepted edges beyond the intended ones.
+        int32_t missed{0};       ///< Intended presses never accepted.
+        float steer_err{0.0f};   ///< RMS applied − intended steering (%).
+    };
+
+    /// @brief Randomized drive: conditions, intended presses, raw contact level per ms.
+    struct Scenario
+    {
+        float soc{1.0f};            ///< Pack charge.
+        float slope_deg{0.0f};      ///< Slope.
+        float mass_kg{45.0f};       ///< Car + driver.
+        uint32_t first_press_ms{0}; ///< First intended press.
+        uint32_t presses{0};        ///< Intended presses.
+        std::vector<uint8_t> raw{}; ///< Contact level, 1 ms resolution.
+        std::vector<int16_t> stick{}; ///< Steering stick as received (µs), 1 ms resolution.
+        std::vector<int16_t> turn{};  ///< Steering the parent meant (µs), 1 ms resolution.
+    };
+
+    /// @brief Draw scenario s (depends only on seed and s).
+    Scenario make_scenario(uint64_t seed, size_t s)
+    {
+        std::mt19937_64 rng(simtools::mix_seed(seed ^ (0x5ce1a210ULL + s)));
+        auto uni = [&rng](float lo, float hi)
+        { return std::uniform_real_distribution<float>(lo, hi)(rng); };
+        auto pick = [&rng](uint32_t lo, uint32_t hi)
+        { return std::uniform_int_distribution<uint32_t>(lo, hi)(rng); };
+
+        Scenario sc{};
+        sc.soc = uni(0.15f, 1.0f);
+        sc.slope_deg = uni(-4.0f, 10.0f);
+        sc.mass_kg = uni(30.0f, 55.0f);
+        sc.raw.assign(kMs, 0);
+
+        // Intended presses: [start, end) in ms.
+        std::vector<std::pair<uint32_t, uint32_t>> press;
+        uint32_t t = pick(200, 1000);
+        sc.first_press_ms = t;
+        const uint32_t taps = (pick(0, 2) == 0) ? 0 : pick(2, 5);
+        for (uint32_t k = 0; k < taps; ++k)
+        {
+            const uint32_t len = pick(100, 600);
+            press.push_back({t, t + len});
+            t += len + pick(100, 500);
+        }
+        press.push_back({t, std::min(kMs - 1000, t + pick(2000, 7000))});
+        sc.presses = static_cast<uint32_t>(press.size());
+
+        for (const auto &p : press)
+            std::fill(sc.raw.begin() + p.first, sc.raw.begin() + p.second, 1);
+
+        // Bounce: every edge chatters for a few ms.
+        for (const auto &p : press)
+        {
+            for (uint32_t edge : {p.first, p.second})
+            {
+                const uint32_t n = pick(0, 6);
+                uint32_t at = edge;
+                for (uint32_t b = 0; b < n && at + 5 < kMs; ++b)
+                {
+                    const uint32_t len = pick(1, 4);
+                    for (uint32_t m = at; m < at + len && m < kMs; ++m)
+                        sc.raw[m] ^= 1;
+                    at += len + pick(0, 3);
+                }
+            }
+        }
+
+        // EMI glitches: ~0.3 per second, 1–15 ms each.
+        std::exponential_distribution<float> gap(0.3f);
+        for (float g = gap(rng); g < kDriveS; g += gap(rng))
+        {
+            const uint32_t at = static_cast<uint32_t>(g * 1000.0f);
+            const uint32_t len = pick(1, 15);
+            for (uint32_t m = at; m < at + len && m < kMs; ++m)
+                sc.raw[m] ^= 1;
+        }
+
+        // Steering: centred with trim, 0–3 gentle turns, receiver jitter on top.
+        const float trim_us = uni(-6.0f, 6.0f);
+        sc.turn.assign(kMs, static_cast<int16_t>(rcmap::kRawCenter));
+        const uint32_t turns = pick(0, 3);
+        for (uint32_t k = 0; k < turns; ++k)
+        {
+            const uint32_t at = pick(500, kMs - 3500);
+            const uint32_t len = pick(1000, 3000);
+            const int16_t us = static_cast<int16_t>(rcmap::kRawCenter + (pick(0, 1) ? 1 : -1) * static_cast<int>(pick(10, 60)));
+            std::fill(sc.turn.begin() + at, sc.turn.begin() + at + len, us);
+        }
+        std::normal_distribution<float> jitter(0.0f, uni(1.0f, 4.0f));
+        sc.stick.resize(kMs);
+        for (uint32_t m = 0; m < kMs; ++m)
+            sc.stick[m] = static_cast<int16_t>(std::lround(sc.turn[m] + trim_us + jitter(rng)));
+        return sc;
+    }
+
+    /// @brief Drive one scenario with one candidate.
+    Result simulate(const Scenario &sc, const Candidate &c)
+    {
+        SimRigSpec spec{};
+        spec.car.soc = sc.soc;
+        spec.car.slope_deg = sc.slope_deg;
+        spec.car.mass_kg = sc.mass_kg;
+        spec.rc = true;
+        spec.motors = 2; ///< Left/right: steering reaches the wheels.
+        SimRig rig(spec);
+        rig.set_accel_override(c.ramp_pct_s);
+        rig.set_decel_override(c.fall_pct_s);
+
+        // The publisher's steering path: LUT with the candidate deadband, then the stick filter.
+        constexpr size_t kSteer = static_cast<size_t>(RC::steering);
+        rcmap::Bank<1> lut;
+        lut.set_axis(0, {1000, 2000, 1500, c.deadband_us, -100.0f, 100.0f});
+        const rcmap::FilterSpec stick = rcmap::stick_filter(1000.0f / static_cast<float>(cfg::tick::LOOP_MS));
+        rcmap::Filter steer;
+        RcSnapshot frame{};
+        frame.linked = true;
+        frame.out[static_cast<size_t>(RC::mode)] = static_cast<float>(cfg::drivemode::NO_RC_MODE); ///< Same limits as no RC.
+        frame.out[static_cast<size_t>(RC::power)] = 100.0f;
+        double steer_sq = 0.0;
+
+        const uint32_t tick_ms = SimRig::kTickUs / 1000u;
+        const uint32_t need = (c.debounce_ms + tick_ms - 1) / tick_ms; ///< Samples unchanged before accepting.
+        bool accepted = false;
+        uint8_t last_sample = 0;
+        uint32_t stable = 0;
+        int32_t edges = 0;
+        int32_t accepted_presses = 0;
+
+        Result r{};
+        float v_hist[kJerkWindowTicks + 1] = {};
+        float a_prev = 0.0f;
+        bool a_valid = false;
+        uint32_t tick = 0;
+
+        for (uint32_t ms = 0; ms + tick_ms <= kMs; ms += tick_ms, ++tick)
+        {
+            // StateManager sample + debounce.
+            const uint8_t sample = sc.raw[ms];
+            stable = (sample == last_sample) ? stable + 1 : 1;
+            last_sample = sample;
+            if (static_cast<bool>(sample) != accepted && stable >= need)
+            {
+                accepted = sample;
+                ++edges;
+                accepted_presses += accepted ? 1 : 0;
+            }
+            rig.set_button(ButtonIndex::Accelerator, accepted);
+            frame.out[kSteer] = rcmap::kLsb * static_cast<float>(steer.apply(lut.map(0, sc.stick[ms]), stick));
+            rig.set_rc(frame);
+            rig.tick();
+            const float want = static_cast<float>(sc.turn[ms] - rcmap::kRawCenter) / kUsPerPct;
+            const float err = rig.control().steer_cmd_pct - want;
+            steer_sq += static_cast<double>(err) * err;
+
+            const VehicleSim &car = rig.car();
+            r.peak_a = std::max(r.peak_a, std::fabs(car.battery_current_a()));
+            if (r.response_s < 0.0f && car.speed_mps() >= kMovingMps)
+                r.response_s = static_cast<float>(ms + tick_ms - sc.first_press_ms) * 1e-3f;
+
+            // Jerk from window-averaged acceleration (stick/slip steps are real, tick noise is not).
+            v_hist[tick % (kJerkWindowTicks + 1)] = car.speed_mps();
+            if (tick >= kJerkWindowTicks)
+            {
+                const float win_s = static_cast<float>(kJerkWindowTicks * tick_ms) * 1e-3f;
+                const float a = (car.speed_mps() - v_hist[(tick + 1) % (kJerkWindowTicks + 1)]) / win_s;
+                if (a_valid)
+                    r.peak_jerk = std::max(r.peak_jerk, std::fabs(a - a_prev) / (static_cast<float>(tick_ms) * 1e-3f));
+                a_prev = a;
+                a_valid = true;
+            }
+        }
+
+        r.spurious = std::max(0, edges - 2 * static_cast<int32_t>(sc.presses));
+        r.missed = std::max(0, static_cast<int32_t>(sc.presses) - accepted_presses);
+        r.steer_err = static_cast<float>(std::sqrt(steer_sq / std::max(tick, 1u)));
+        return r;
+    }
+
+    /// @brief q-quantile of v (sorted in place).
+    float quantile(std::vector<float> &v, float q)
+    {
+        if (v.empty())
+            return 0.0f;
+        std::sort(v.begin(), v.end());
+        const size_t i = static_cast<size_t>(q * static_cast<float>(v.size() - 1) + 0.5f);
+        return v[i];
+    }
+
+    /// @brief Comma-separated list → values.
+    template <typename T>
+    std::vector<T> parse_list(const char *s)
+    {
+        std::vector<T> out;
+        std::string tok;
+        for (const char *p = s;; ++p)
+        {
+            if (*p == ',' || *p == '\0')
+            {
+                if (!tok.empty())
+                    out.push_back(static_cast<T>(atof(tok.c_str())));
+                tok.clear();
+                if (*p == '\0')
+                    break;
+            }
+            else
+                tok += *p;
+        }
+        return out;
+    }
+
+    /// @brief Run every (candidate, scenario) pair; returns wall seconds.
+    double run_all(const std::vector<Scenario> &scs, const std::vector<Candidate> &cands, unsigned threads,
+                   std::vector<Result> &out)
+    {
+        const size_t n = scs.size() * cands.size();
+        out.assign(n, Result{});
+        const auto t0 = std::chrono::steady_clock::now();
+        simtools::parallel_for(n, threads,
+                               [&](size_t i)
+                               { out[i] = simulate(scs[i % scs.size()], cands[i / scs.size()]); });
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t scenarios = 300;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    uint64_t seed = 1;
+    bool scaling = false;
+    std::vector<float> ramps{20.0f, 40.0f, 80.0f};
+    std::vector<float> falls{40.0f, 80.0f};
+    std::vector<uint32_t> debounces{0, 20, 50};
+    std::vector<int16_t> deadbands{0, 8, 16};
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--scenarios") && i + 1 < argc)
+            scenarios = static_cast<size_t>(atol(argv[++i]));
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            threads = static_cast<unsigned>(atoi(argv[++i]));
+        else if (!strcmp(argv[i], "--seed") && i + 1 < argc)
+            seed = static_cast<uint64_t>(atoll(argv[++i]));
+        else if (!strcmp(argv[i], "--ramps") && i + 1 < argc)
+            ramps = parse_list<float>(argv[++i]);
+        else if (!strcmp(argv[i], "--falls") && i + 1 < argc)
+            falls = parse_list<float>(argv[++i]);
+        else if (!strcmp(argv[i], "--debounce") && i + 1 < argc)
+            debounces = parse_list<uint32_t>(argv[++i]);
+        else if (!strcmp(argv[i], "--deadband") && i + 1 < argc)
+            deadbands = parse_list<int16_t>(argv[++i]);
+        else if (!strcmp(argv[i], "--scaling"))
+            scaling = true;
+        else
+        {
+            fprintf(stderr,
+                    "usage: %s [--scenarios N] [--threads T] [--seed S] [--ramps a,b,..] [--falls a,b,..] "
+                    "[--debounce a,b,..] [--deadband a,b,..] [--scaling]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<Scenario> scs(scenarios);
+    simtools::parallel_for(scenarios, threads, [&](size_t s) { scs[s] = make_scenario(seed, s); });
+
+    std::vector<Candidate> cands;
+    for (float r : ramps)
+        for (float f : falls)
+            for (uint32_t d : debounces)
+                for (int16_t db : deadbands)
+                    cands.push_back({r, f, d, db});
+
+    std::vector<Result> res;
+    if (scaling)
+    {
+        // Same batch at 1, 2, 4, ... threads: sims/s should grow with cores.
+        const unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+        std::vector<unsigned> counts;
+        for (unsigned t = 1; t < threads; t *= 2)
+            counts.push_back(t);
+        counts.push_back(threads); ///< Finish on the requested count.
+        double base = 0.0;
+        int low = 0;
+        printf("%zu sims per run, %u hardware threads\n", scs.size() * cands.size(), cores);
+        for (unsigned t : counts)
+        {
+            const double wall = run_all(scs, cands, t, res);
+            const double rate = static_cast<double>(res.size()) / wall;
+            base = (t == 1) ? rate : base;
+            const double eff = rate / (base * t);
+            const char *verdict = (t > cores) ? "oversubscribed" : (eff >= kMinEfficiency) ? "ok" : "LOW";
+            low += (t <= cores && eff < kMinEfficiency) ? 1 : 0;
+            printf("%2u threads: %8.0f sims/s  (%.2fx of 1 thread, %3.0f %% efficient) %s\n", t, rate, rate / base,
+                   eff * 100.0, verdict);
+        }
+        return low;
+    }
+
+    const double wall = run_all(scs, cands, threads, res);
+
+    printf("%zu scenarios x %zu candidates = %zu sims (%.0f s simulated) in %.2f s on %u threads: %.0f sims/s\n\n",
+           scs.size(), cands.size(), res.size(), static_cast<double>(res.size()) * kDriveS, wall, threads,
+           static_cast<double>(res.size()) / wall);
+    printf("ramp%%/s fall%%/s deb_ms db_us | peak_A mean   p95 | jerk p50   p95  max | resp_s p50   p95 never | "
+           "spurious missed | steer_err\n");
+    for (size_t c = 0; c < cands.size(); ++c)
+    {
+        std::vector<float> amps, jerk, resp;
+        float amps_sum = 0.0f;
+        float jerk_max = 0.0f;
+        float steer_sum = 0.0f;
+        int32_t never = 0, spurious = 0, missed = 0;
+        for (size_t s = 0; s < scs.size(); ++s)
+        {
+            const Result &r = res[c * scs.size() + s];
+            amps.push_back(r.peak_a);
+            amps_sum += r.peak_a;
+            jerk.push_back(r.peak_jerk);
+            jerk_max = std::max(jerk_max, r.peak_jerk);
+            if (r.response_s >= 0.0f)
+                resp.push_back(r.response_s);
+            else
+                ++never;
+            spurious += r.spurious;
+            missed += r.missed;
+            steer_sum += r.steer_err;
+        }
+        const float n = static_cast<float>(scs.size());
+        printf("%7.0f %7.0f %6u %5d | %11.1f %5.1f | %9.1f %5.1f %4.0f | %10.2f %5.2f %5d | %8.3f %6.3f | %9.2f\n",
+               cands[c].ramp_pct_s, cands[c].fall_pct_s, cands[c].debounce_ms, cands[c].deadband_us, amps_sum / n,
+               quantile(amps, 0.95f), quantile(jerk, 0.5f), quantile(jerk, 0.95f), jerk_max, quantile(resp, 0.5f),
+               quantile(resp, 0.95f), never, spurious / n, missed / n, steer_sum / n);
+    }
+    return 0;
+}
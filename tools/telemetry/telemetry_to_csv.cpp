@@ -0,0 +1,455 @@
+/**
+ * MIT License
+ *
+ * @brief Decode the binary telemetry stream (COBS-framed delta records) to CSV.
+ *
+ * Build from the repository root:
+ *
+ *   g++ -O2 -std=gnu++17 -pthread -Isrc/include -Isrc/utils -Itools/sim \
+ *       tools/telemetry/telemetry_to_csv.cpp -o telemetry_to_csv
+ *
+ * Usage: telemetry_to_csv CAPTURE|- [-o PREFIX] [--stream NAME] [--threads T]
+ *        telemetry_to_csv --bench [--records N] [--threads T]
+ *
+ * CAPTURE is raw bytes from the port, e.g. `cat /dev/ttyACM0 > run.bin`, or
+ * stdin with "-" to decode live. Debug text on the same port fails the frame
+ * CRC and is skipped. Every stream gets PREFIX_<stream>.csv (PREFIX defaults
+ * to "telemetry"); --stream NAME writes just that one, to stdout unless -o is
+ * given. Columns are t_s then the fields in TelemetryFormat.h order.
+ *
+ * Decoding is one delta chain and stays on the main thread; it fills a batch
+ * of records per stream. Text formatting is most of the work and each stream's
+ * CSV is independent, so while the next batch decodes, the previous one is
+ * formatted and written one stream per worker.
+ *
+ * --bench encodes a synthetic capture (N records, default 8 M, round-robin
+ * over the motor, control, battery, IMU and obstacle streams) to a temporary
+ * file. It then times the decode alone, and the full conversion into
+ * temporary CSVs at 1, 2, 4, ... threads up to T, in MB of capture per second.
+ *
+ * @file telemetry_to_csv.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <TelemetryFormat.h>
+#include <WorkPool.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr size_t kChunk = 1u << 22;   ///< Input read size.
+    constexpr size_t kFlushAt = 1u << 20; ///< Output buffered per stream before fwrite.
+    constexpr size_t kBatch = 1u << 16;   ///< Records per stream before a batch goes to the writers.
+    constexpr size_t kStreamCount = static_cast<size_t>(telemetry::Stream::Count);
+
+    /// @brief One decoded sample.
+    struct Record
+    {
+        uint64_t t_us;                    ///< Sample time.
+        int32_t v[telemetry::kMaxFields]; ///< Field values (fixed point).
+    };
+
+    /// @brief Decoded records awaiting formatting, per stream.
+    using Batch = std::array<std::vector<Record>, kStreamCount>;
+
+    /// @brief Buffered CSV writer for one stream.
+    struct Sink
+    {
+        FILE *f{nullptr};      ///< Output (nullptr → stream not wanted).
+        std::vector<char> buf; ///< Pending text.
+        size_t used{0};        ///< Bytes pending.
+        uint64_t rows{0};      ///< Rows written.
+
+        void flush()
+        {
+            if (used > 0)
+                fwrite(buf.data(), 1, used, f);
+            used = 0;
+        }
+    };
+
+    /**
+     * @brief Fixed-point value as text ("-12.34", "0.05", "7").
+     *
+     * Digits are produced right to left by constant /10 (a multiply), with the
+     * point dropped in after `decimals` of them: no per-field divisor, no printf.
+     */
+    inline char *put_fixed(char *p, uint64_t m, bool neg, uint8_t decimals)
+    {
+        char tmp[24];
+        char *q = tmp + sizeof(tmp);
+        for (uint8_t k = 0; k < decimals; ++k)
+        {
+            *--q = static_cast<char>('0' + m % 10);
+            m /= 10;
+        }
+        if (decimals > 0)
+            *--q = '.';
+        do
+        {
+            *--q = static_cast<char>('0' + m % 10);
+            m /= 10;
+        } while (m != 0);
+        if (neg)
+            *--q = '-';
+        const size_t len = static_cast<size_t>(tmp + sizeof(tmp) - q);
+        memcpy(p, q, len);
+        return p + len;
+    }
+
+    inline char *put_fixed(char *p, int32_t raw, uint8_t decimals)
+    {
+        const uint32_t m = (raw < 0) ? 0u - static_cast<uint32_t>(raw) : static_cast<uint32_t>(raw);
+        return put_fixed(p, m, raw < 0, decimals);
+    }
+
+    /// @brief One decoded sample → CSV row.
+    inline void row(Sink &s, const telemetry::StreamSpec &spec, uint64_t t_us, const int32_t *v)
+    {
+        if (s.used + 32 + spec.count * 13 > s.buf.size())
+            s.flush();
+        char *p = s.buf.data() + s.used;
+        p = put_fixed(p, t_us, false, 6);
+        for (size_t i = 0; i < spec.count; ++i)
+        {
+            *p++ = ',';
+            p = put_fixed(p, v[i], spec.fields[i].decimals);
+        }
+        *p++ = '\n';
+        s.used = static_cast<size_t>(p - s.buf.data());
+        ++s.rows;
+        if (s.used >= kFlushAt)
+            s.flush();
+    }
+
+    /// @brief What one conversion read.
+    struct Totals
+    {
+        uint64_t bytes{0};             ///< Capture bytes.
+        uint64_t ok{0};                ///< Records decoded.
+        uint64_t corrupt{0};           ///< Frames failing COBS/CRC (noise, debug text).
+        uint64_t unsynced{0};          ///< Deltas held back until a keyframe.
+        int32_t last_stats[3]{0, 0, 0}; ///< Last Stats record.
+        bool have_stats{false};        ///< True once a Stats record arrived.
+    };
+
+    /**
+     * @brief Decode @p in and write every record into its stream's sink.
+     *
+     * @param in Capture (read to EOF).
+     * @param sinks kStreamCount sinks; a null FILE skips the stream.
+     * @param threads Formatting workers (1 → all on this thread).
+     */
+    Totals convert(FILE *in, Sink *sinks, unsigned threads)
+    {
+        // ---- Writers: format one batch, a stream per worker ---- //
+        Batch batches[2];
+        int fill = 0;       ///< Batch the decoder is filling.
+        std::thread writer; ///< Formatting the other batch.
+        auto write = [sinks, threads](Batch *b)
+        {
+            simtools::parallel_for(kStreamCount, threads,
+                                   [&](size_t s)
+                                   {
+                                       for (const Record &r : (*b)[s])
+                                           row(sinks[s], telemetry::kStreams[s], r.t_us, r.v);
+                                   });
+        };
+        auto hand_off = [&]()
+        {
+            if (writer.joinable())
+                writer.join();
+            if (threads > 1)
+                writer = std::thread(write, &batches[fill]);
+            else
+                write(&batches[fill]);
+            fill ^= 1;
+            for (std::vector<Record> &q : batches[fill])
+                q.clear(); ///< Its writer was joined above.
+        };
+        for (Batch &b : batches)
+            for (size_t s = 0; s < kStreamCount; ++s)
+                if (sinks[s].f != nullptr)
+                    b[s].reserve(kBatch);
+
+        // ---- Decode: split on 0x00, one record per frame ---- //
+        telemetry::Decoder dec;
+        std::vector<uint8_t> buf(kChunk + telemetry::kMaxFrame);
+        size_t carry = 0; ///< Unterminated frame bytes kept from the last chunk.
+        Totals tot{};
+
+        for (size_t got; (got = fread(buf.data() + carry, 1, kChunk, in)) > 0;)
+        {
+            tot.bytes += got;
+            uint8_t *p = buf.data();
+            uint8_t *end = p + carry + got;
+            for (;;)
+            {
+                uint8_t *z = static_cast<uint8_t *>(memchr(p, 0, static_cast<size_t>(end - p)));
+                if (z == nullptr)
+                    break;
+                const size_t n = static_cast<size_t>(z - p);
+                if (n > 0)
+                {
+                    telemetry::Stream s{};
+                    Record r;
+                    const telemetry::Decoder::Result res = (n <= telemetry::kMaxFrame)
+                                                               ? dec.decode(p, n, s, r.t_us, r.v)
+                                                               : telemetry::Decoder::Result::Corrupt;
+                    if (res == telemetry::Decoder::Result::Ok)
+                    {
+                        ++tot.ok;
+                        const size_t id = static_cast<size_t>(s);
+                        if (s == telemetry::Stream::Stats)
+                        {
+                            memcpy(tot.last_stats, r.v, sizeof(tot.last_stats));
+                            tot.have_stats = true;
+                        }
+                        if (sinks[id].f != nullptr)
+                        {
+                            batches[fill][id].push_back(r);
+                            if (batches[fill][id].size() >= kBatch)
+                                hand_off();
+                        }
+                    }
+                    else if (res == telemetry::Decoder::Result::Corrupt)
+                        ++tot.corrupt;
+                    else
+                        ++tot.unsynced;
+                }
+                p = z + 1;
+            }
+
+            // Keep a partial frame; anything longer than a frame is noise (text): drop it.
+            carry = static_cast<size_t>(end - p);
+            if (carry > telemetry::kMaxFrame)
+                carry = 0;
+            memmove(buf.data(), p, carry);
+        }
+        hand_off();
+        if (writer.joinable())
+            writer.join();
+        return tot;
+    }
+
+    /// @brief Point @p s at @p f and write the CSV header.
+    void start(Sink &s, FILE *f, const telemetry::StreamSpec &spec)
+    {
+        s.f = f;
+        s.buf.resize(kFlushAt + 4096);
+        std::string head = "t_s";
+        for (size_t i = 0; i < spec.count; ++i)
+            head += std::string(",") + spec.fields[i].name;
+        head += '\n';
+        fwrite(head.data(), 1, head.size(), s.f);
+    }
+
+    /// @brief Flush and close (stdout stays open).
+    void finish(Sink &s)
+    {
+        if (s.f == nullptr)
+            return;
+        s.flush();
+        if (s.f != stdout)
+            fclose(s.f);
+    }
+
+    /**
+     * @brief Encode a synthetic capture into @p out: @p records records, round-robin over five streams.
+     *
+     * Values are slow random walks sampled at 50 Hz per stream, as the streamer sends them.
+     */
+    void synth(FILE *out, size_t records)
+    {
+        constexpr telemetry::Stream kMix[] = {telemetry::Stream::Motor, telemetry::Stream::Control,
+                                              telemetry::Stream::Battery, telemetry::Stream::Imu,
+                                              telemetry::Stream::Obstacle};
+        constexpr size_t kMixCount = sizeof(kMix) / sizeof(kMix[0]);
+        std::mt19937 rng(75);
+        std::uniform_int_distribution<int32_t> step(-40, 40);
+        telemetry::Encoder enc;
+        int32_t v[kMixCount][telemetry::kMaxFields] = {};
+        std::vector<uint8_t> buf;
+        buf.reserve(kChunk + telemetry::kMaxFrame);
+        uint64_t t_us = 1000000;
+        for (size_t k = 0; k < records; ++k)
+        {
+            const size_t m = k % kMixCount;
+            if (m == 0)
+                t_us += 20000; ///< 50 Hz.
+            const telemetry::Stream st = kMix[m];
+            for (size_t i = 0; i < telemetry::kStreams[static_cast<size_t>(st)].count; ++i)
+                v[m][i] += step(rng);
+            uint8_t frame[telemetry::kMaxFrame];
+            const size_t n = enc.encode(st, t_us + m * 100, v[m], frame);
+            buf.insert(buf.end(), frame, frame + n);
+            if (buf.size() >= kChunk)
+            {
+                fwrite(buf.data(), 1, buf.size(), out);
+                buf.clear();
+            }
+        }
+        fwrite(buf.data(), 1, buf.size(), out);
+    }
+
+    /**
+     * @brief --bench: synthetic capture, then decode-only and full conversion at 1, 2, 4, ... threads.
+     *
+     * @return 0, or 1 if the temporary files cannot be created or a run drops records.
+     */
+    int bench(size_t records, unsigned threads)
+    {
+        FILE *cap = tmpfile();
+        if (cap == nullptr)
+        {
+            fprintf(stderr, "cannot create a temporary capture\n");
+            return 1;
+        }
+        synth(cap, records);
+        const double mb = static_cast<double>(ftell(cap)) / 1e6;
+        printf("synthetic capture: %zu records, 5 streams, %.1f MB\n", records, mb);
+
+        using clock = std::chrono::steady_clock;
+        auto run = [&](bool csv, unsigned t) -> double
+        {
+            Sink sinks[kStreamCount];
+            for (size_t s = 0; csv && s < kStreamCount; ++s)
+            {
+                FILE *f = tmpfile();
+                if (f == nullptr)
+                    return -1.0;
+                start(sinks[s], f, telemetry::kStreams[s]);
+            }
+            rewind(cap);
+            const auto t0 = clock::now();
+            const Totals tot = convert(cap, sinks, t);
+            for (Sink &s : sinks)
+                finish(s);
+            const double wall = std::chrono::duration<double>(clock::now() - t0).count();
+            return (tot.ok == records) ? wall : -1.0;
+        };
+
+        int failed = 0;
+        const double dec = run(false, 1);
+        failed += (dec < 0.0) ? 1 : 0;
+        printf("decode only:        %7.0f MB/s\n", mb / dec);
+        for (unsigned t = 1;; t = std::min(t * 2, threads))
+        {
+            const double wall = run(true, t);
+            failed += (wall < 0.0) ? 1 : 0;
+            printf("CSV, %2u thread%s:     %7.0f MB/s (%.2f s)\n", t, t == 1 ? " " : "s", mb / wall, wall);
+            if (t == threads)
+                break;
+        }
+        fclose(cap);
+        printf("%u hardware threads\n", std::max(1u, std::thread::hardware_concurrency()));
+        return failed == 0 ? 0 : 1;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *in_path = nullptr;
+    const char *prefix = nullptr;
+    const char *only = nullptr;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    bool bench_mode = false;
+    size_t records = 8000000;
+    bool usage = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-o") && i + 1 < argc)
+            prefix = argv[++i];
+        else if (!strcmp(argv[i], "--stream") && i + 1 < argc)
+            only = argv[++i];
+        else if (!strcmp(argv[i], "--threads") && i + 1 < argc)
+            threads = static_cast<unsigned>(std::max(1, atoi(argv[++i])));
+        else if (!strcmp(argv[i], "--bench"))
+            bench_mode = true;
+        else if (!strcmp(argv[i], "--records") && i + 1 < argc)
+            records = static_cast<size_t>(std::max(1LL, atoll(argv[++i])));
+        else if (in_path == nullptr && (argv[i][0] != '-' || !strcmp(argv[i], "-")))
+            in_path = argv[i];
+        else
+            usage = true;
+    }
+    if (bench_mode && !usage && in_path == nullptr && only == nullptr && prefix == nullptr)
+        return bench(records, threads);
+    if (usage || in_path == nullptr)
+    {
+        fprintf(stderr,
+                "usage: %s CAPTURE|- [-o PREFIX] [--stream NAME] [--threads T]\n"
+                "       %s --bench [--records N] [--threads T]\n",
+                argv[0], argv[0]);
+        return 2;
+    }
+
+    // ---- Outputs ---- //
+    Sink sinks[kStreamCount];
+    bool any = false;
+    for (size_t s = 0; s < kStreamCount; ++s)
+    {
+        const telemetry::StreamSpec &spec = telemetry::kStreams[s];
+        if (only != nullptr && strcmp(only, spec.name) != 0)
+            continue;
+        FILE *f = stdout;
+        if (only == nullptr || prefix != nullptr)
+        {
+            const std::string path = std::string(prefix ? prefix : "telemetry") + "_" + spec.name + ".csv";
+            f = fopen(path.c_str(), "w");
+            if (f == nullptr)
+            {
+                fprintf(stderr, "cannot write %s\n", path.c_str());
+                return 1;
+            }
+        }
+        start(sinks[s], f, spec);
+        any = true;
+    }
+    if (!any)
+    {
+        fprintf(stderr, "no stream named %s\n", only);
+        return 2;
+    }
+
+    FILE *in = strcmp(in_path, "-") ? fopen(in_path, "rb") : stdin;
+    if (in == nullptr)
+    {
+        fprintf(stderr, "cannot read %s\n", in_path);
+        return 1;
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    const Totals tot = convert(in, sinks, threads);
+    if (in != stdin)
+        fclose(in);
+    for (Sink &s : sinks)
+        finish(s);
+
+    const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    fprintf(stderr,
+            "%.1f MB in %.3f s (%.0f MB/s, %u threads): %llu records, %llu corrupt/noise, %llu awaiting keyframe\n",
+            static_cast<double>(tot.bytes) / 1e6, wall,
+            static_cast<double>(tot.bytes) / 1e6 / (wall > 0 ? wall : 1e-9), threads,
+            static_cast<unsigned long long>(tot.ok), static_cast<unsigned long long>(tot.corrupt),
+            static_cast<unsigned long long>(tot.unsynced));
+    if (tot.have_stats)
+        fprintf(stderr, "device: %d frames sent, %d dropped (port full), %d bytes\n", tot.last_stats[0],
+                tot.last_stats[1], tot.last_stats[2]);
+    for (size_t s = 0; s < kStreamCount; ++s)
+        if (sinks[s].f != nullptr && sinks[s].rows > 0 && sinks[s].f != stdout)
+            fprintf(stderr, "  %-8s %llu rows\n", telemetry::kStreams[s].name,
+                    static_cast<unsigned long long>(sinks[s].rows));
+    return 0;
+}
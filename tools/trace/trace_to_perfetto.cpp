@@ -0,0 +1,313 @@
+/**
+ * MIT License
+ *
+ * @brief Convert a task/bus trace dump (serial capture or host sim file) to Chrome/Perfetto JSON.
+ *
+ * Build: g++ -O2 -std=gnu++17 tools/trace/trace_to_perfetto.cpp -o trace_to_perfetto
+ *
+ * Usage: trace_to_perfetto CAPTURE [--dump N] [-o OUT.json]
+ *
+ * CAPTURE is the raw serial log (debug text around the dump is skipped) or
+ * a file from vehicle_sim --trace. Open the JSON in ui.perfetto.dev or
+ * chrome://tracing:
+ *
+ *  - "CPU n": which task each core ran (TraceDump's task sampler, to cfg::trace::SAMPLE_US).
+ *  - "Tasks": one track per work span (StateManager, ControlCore, PDHandler, ...).
+ *  - "Buses": publish/peek instants per bus, tagged with the span that made them.
+ *
+ * @file trace_to_perfetto.cpp
+ * @author Little Man Builds (Darren Osborne)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2026 Little Man Builds
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+    enum Kind : uint8_t
+    {
+        kTaskIn = 0,
+        kTaskOut,
+        kBegin,
+        kEnd,
+        kPublish,
+        kPeek
+    };
+
+    constexpr int kPidCpu = 1;    ///< CPU n → pid kPidCpu + n.
+    constexpr int kPidTasks = 10; ///< Work spans.
+    constexpr int kPidBuses = 20; ///< Bus events.
+
+    /// @brief One parsed dump.
+    struct Dump
+    {
+        uint32_t dropped{0};                 ///< Events lost after the buffer filled.
+        std::map<int, std::string> names[3]; ///< Task slot / Track / Bus → name.
+        std::vector<uint8_t> events;         ///< Raw 8-byte records.
+    };
+
+    uint32_t le32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24); }
+
+    /// @brief Find and parse dump number `which` in buf; false with a message on failure.
+    bool parse(const std::vector<uint8_t> &buf, int which, Dump &d)
+    {
+        static const char kMagic[] = "LMTRACE1";
+        static const char kEnd[] = "LMTREND\n";
+        size_t at = 0;
+        for (int seen = -1;;)
+        {
+            const uint8_t *hit = nullptr;
+            for (size_t i = at; i + 8 <= buf.size(); ++i)
+                if (memcmp(&buf[i], kMagic, 8) == 0)
+                {
+                    hit = &buf[i];
+                    break;
+                }
+            if (hit == nullptr)
+            {
+                fprintf(stderr, "dump %d not found (capture holds %d)\n", which, seen + 1);
+                return false;
+            }
+            at = static_cast<size_t>(hit - buf.data()) + 8;
+            if (++seen == which)
+                break;
+        }
+
+        auto need = [&](size_t n)
+        {
+            if (at + n > buf.size())
+            {
+                fprintf(stderr, "dump truncated\n");
+                return false;
+            }
+            return true;
+        };
+        if (!need(9))
+            return false;
+        const uint32_t count = le32(&buf[at]);
+        d.dropped = le32(&buf[at + 4]);
+        const uint8_t names = buf[at + 8];
+        at += 9;
+        for (uint8_t i = 0; i < names; ++i)
+        {
+            if (!need(3))
+                return false;
+            const uint8_t kind = buf[at];
+            const uint8_t id = buf[at + 1];
+            const uint8_t len = buf[at + 2];
+            at += 3;
+            if (!need(len) || kind > 2)
+                return false;
+            d.names[kind][id] = std::string(reinterpret_cast<const char *>(&buf[at]), len);
+            at += len;
+        }
+        if (!need(static_cast<size_t>(count) * 8 + 8))
+            return false;
+        d.events.assign(buf.begin() + at, buf.begin() + at + count * 8);
+        at += count * 8;
+        if (memcmp(&buf[at], kEnd, 8) != 0)
+        {
+            fprintf(stderr, "end marker missing: other output was printed during the dump\n");
+            return false;
+        }
+        return true;
+    }
+
+    std::string name_of(const Dump &d, int kind, int id)
+    {
+        const auto it = d.names[kind].find(id);
+        return (it != d.names[kind].end()) ? it->second : ("#" + std::to_string(id));
+    }
+
+    /// @brief JSON-safe copy (names are short ASCII; escape just in case).
+    std::string esc(const std::string &s)
+    {
+        std::string o;
+        for (char c : s)
+        {
+            if (c == '"' || c == '\\')
+                o += '\\';
+            if (static_cast<unsigned char>(c) >= 0x20)
+                o += c;
+        }
+        return o;
+    }
+
+    void write_json(const Dump &d, FILE *out)
+    {
+        std::vector<std::string> ev;
+        auto meta = [&](int pid, int tid, const char *what, const std::string &name)
+        {
+            char b[160];
+            snprintf(b, sizeof(b), "{\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"name\":\"%s\",\"args\":{\"name\":\"%s\"}}", pid,
+                     tid, what, esc(name).c_str());
+            ev.push_back(b);
+        };
+
+        meta(kPidTasks, 0, "process_name", "Tasks");
+        meta(kPidBuses, 0, "process_name", "Buses");
+        for (const auto &t : d.names[1])
+            meta(kPidTasks, t.first + 1, "thread_name", t.second);
+        for (const auto &b : d.names[2])
+            meta(kPidBuses, b.first + 1, "thread_name", b.second);
+
+        std::map<int, bool> cpu_seen;
+        std::map<int, bool> running;            ///< Core → a TaskIn is open.
+        std::map<int, bool> span_open;          ///< Track → Begin without End.
+        std::map<int, std::vector<int>> active; ///< Core → open spans, innermost last.
+
+        uint64_t t = 0;
+        uint32_t prev = 0;
+        for (size_t i = 0; i < d.events.size(); i += 8)
+        {
+            const uint8_t *p = &d.events[i];
+            const uint32_t raw = le32(p);
+            const uint8_t kind = p[4];
+            const int core = p[5];
+            const int id = p[6] | (p[7] << 8);
+
+            // 32-bit µs stamps, nearly ordered (two cores claim slots concurrently): unwrap by signed delta.
+            t = (i == 0) ? 0 : static_cast<uint64_t>(static_cast<int64_t>(t) + static_cast<int32_t>(raw - prev));
+            prev = raw;
+
+            char b[256];
+            switch (kind)
+            {
+            case kTaskIn:
+            case kTaskOut:
+                if (!cpu_seen[core])
+                {
+                    meta(kPidCpu + core, 0, "process_name", "CPU " + std::to_string(core));
+                    meta(kPidCpu + core, 1, "thread_name", "running");
+                    cpu_seen[core] = true;
+                }
+                if (kind == kTaskIn)
+                {
+                    if (running[core])
+                    {
+                        snprintf(b, sizeof(b), "{\"ph\":\"E\",\"pid\":%d,\"tid\":1,\"ts\":%llu}", kPidCpu + core,
+                                 static_cast<unsigned long long>(t));
+                        ev.push_back(b); ///< Switch-out missed (hook raced the capture start).
+                    }
+                    snprintf(b, sizeof(b), "{\"ph\":\"B\",\"pid\":%d,\"tid\":1,\"ts\":%llu,\"name\":\"%s\"}",
+                             kPidCpu + core, static_cast<unsigned long long>(t), esc(name_of(d, 0, id)).c_str());
+                    running[core] = true;
+                }
+                else
+                {
+                    if (!running[core])
+                        continue; ///< Capture began mid-slice.
+                    snprintf(b, sizeof(b), "{\"ph\":\"E\",\"pid\":%d,\"tid\":1,\"ts\":%llu}", kPidCpu + core,
+                             static_cast<unsigned long long>(t));
+                    running[core] = false;
+                }
+                break;
+
+            case kBegin:
+                snprintf(b, sizeof(b), "{\"ph\":\"B\",\"pid\":%d,\"tid\":%d,\"ts\":%llu,\"name\":\"%s\",\"args\":{\"core\":%d}}",
+                         kPidTasks, id + 1, static_cast<unsigned long long>(t), esc(name_of(d, 1, id)).c_str(), core);
+                span_open[id] = true;
+                active[core].push_back(id);
+                break;
+
+            case kEnd:
+            {
+                if (!span_open[id])
+                    continue;
+                snprintf(b, sizeof(b), "{\"ph\":\"E\",\"pid\":%d,\"tid\":%d,\"ts\":%llu}", kPidTasks, id + 1,
+                         static_cast<unsigned long long>(t));
+                span_open[id] = false;
+                std::vector<int> &a = active[core];
+                for (size_t k = a.size(); k-- > 0;)
+                    if (a[k] == id)
+                    {
+                        a.erase(a.begin() + static_cast<std::ptrdiff_t>(k));
+                        break;
+                    }
+                break;
+            }
+
+            case kPublish:
+            case kPeek:
+            {
+                const std::vector<int> &a = active[core];
+                const std::string by = a.empty() ? "?" : name_of(d, 1, a.back());
+                snprintf(b, sizeof(b),
+                         "{\"ph\":\"i\",\"s\":\"t\",\"pid\":%d,\"tid\":%d,\"ts\":%llu,\"name\":\"%s\",\"args\":{\"by\":\"%s\",\"core\":%d}}",
+                         kPidBuses, id + 1, static_cast<unsigned long long>(t), kind == kPublish ? "publish" : "peek",
+                         esc(by).c_str(), core);
+                break;
+            }
+
+            default:
+                continue;
+            }
+            ev.push_back(b);
+        }
+
+        fprintf(out, "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"events\":%zu,\"dropped\":%u},\"traceEvents\":[\n",
+                d.events.size() / 8, d.dropped);
+        for (size_t i = 0; i < ev.size(); ++i)
+            fprintf(out, "%s%s\n", ev[i].c_str(), (i + 1 < ev.size()) ? "," : "");
+        fprintf(out, "]}\n");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *in_path = nullptr;
+    const char *out_path = nullptr;
+    int which = 0;
+    bool usage = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "--dump") && i + 1 < argc)
+            which = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+            out_path = argv[++i];
+        else if (in_path == nullptr && argv[i][0] != '-')
+            in_path = argv[i];
+        else
+            usage = true;
+    }
+    if (usage || in_path == nullptr)
+    {
+        fprintf(stderr, "usage: %s CAPTURE [--dump N] [-o OUT.json]\n", argv[0]);
+        return 2;
+    }
+
+    FILE *f = fopen(in_path, "rb");
+    if (f == nullptr)
+    {
+        fprintf(stderr, "cannot read %s\n", in_path);
+        return 1;
+    }
+    std::vector<uint8_t> buf;
+    uint8_t chunk[4096];
+    for (size_t n; (n = fread(chunk, 1, sizeof(chunk), f)) > 0;)
+        buf.insert(buf.end(), chunk, chunk + n);
+    fclose(f);
+
+    Dump d{};
+    if (!parse(buf, which, d))
+        return 1;
+
+    FILE *out = (out_path != nullptr) ? fopen(out_path, "w") : stdout;
+    if (out == nullptr)
+    {
+        fprintf(stderr, "cannot write %s\n", out_path);
+        return 1;
+    }
+    write_json(d, out);
+    if (out != stdout)
+        fclose(out);
+    fprintf(stderr, "%zu events, %u dropped after the buffer filled\n", d.events.size() / 8, d.dropped);
+    return 0;
+}